@@ -0,0 +1,1589 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 exhaustive ALU check.
+
+  Extracts the ALU circuit of poc.circ (or poc_mini.circ, which has the
+  same ALU) with its subcircuits (Shifter16, Adder16, ZeroDetector16,
+  etc) down to the 7400-series chips, splitters and wires into a flat
+  netlist. The netlist is then compiled, for each of the 14 opcodes (all
+  but the reserved 5 and 6) and each carry-in (CI) value, into a
+  straight-line program of bitwise operations: OP and CI are folded in as
+  constants and the logic that doesn't contribute to the outputs under
+  them is dropped (e.g. the shifter and its output buffer for add).
+
+  The programs are run bit-sliced: every bit of a vector of machine words
+  (GCC vector extensions, so the compiler uses SIMD instructions) carries
+  its own operand pair, all DIR values for one DIL value in 256-pair
+  slices. All 2^32 DIL/DIR pairs are checked with both CI values and the
+  results (DO, CO, Z, S, OVF) are compared with the ALU model of emu.h,
+  alu(), which is evaluated bit-sliced as well (the bit-sliced version is
+  checked against alu() itself first). The tri-state buses are checked
+  too: every bus the compiled logic reads must have exactly one driver
+  (a net without drivers, e.g. a cut wire, is a floating bus).
+
+  The DIL values are split among -j threads. -n checks n random DIL values
+  instead of all of them for a quicker run.
+
+  Only what the ALU consists of is supported: pins, splitters, ground,
+  the 7400, 7404, 7408, 7410, 7411, 7427, 7432, 7486, 74157, 74244 and
+  74283 chips (without VCC/GND pins) and subcircuits with the default
+  appearance (fixed size box). Ports that connect to nothing are listed
+  with -v.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread aluchk.c -o aluchk.exe
+  (add -march=native for the widest SIMD instructions of the CPU)
+*/
+
+#include <pthread.h>
+#include "emu.h"
+
+enum
+{
+  MAX_NAME     = 32,
+  MAX_BITS     = 32,  // splitter width
+  BOX_WIDTH    = 220, // subcircuit box (fixed size appearance)
+  PIN_DY       = 20,  // subcircuit pin spacing
+  MAX_EXAMPLES = 4,   // mismatches shown per opcode
+  MAX_PROBLEMS = 8    // floating/conflicting buses shown per opcode
+};
+
+enum
+{
+  FACE_E,
+  FACE_S,
+  FACE_W,
+  FACE_N
+};
+
+enum
+{
+  K_PIN,
+  K_SPLITTER,
+  K_GROUND,
+  K_TTL,
+  K_SUB,
+  K_TEXT
+};
+
+// TTL chip functions.
+enum
+{
+  G_NOT, G_AND, G_NAND, G_OR, G_NOR, G_XOR,
+  G_MUX, // 74157
+  G_BUF, // 74244
+  G_ADD  // 74283
+};
+
+typedef struct
+{
+  const char* name;
+  int pins;
+  int func;
+  int inputs; // of the gates
+} Ttl;
+
+const Ttl ttls[] =
+{
+  { "7400", 14, G_NAND, 2 }, { "7404", 14, G_NOT, 1 }, { "7408", 14, G_AND, 2 },
+  { "7410", 14, G_NAND, 3 }, { "7411", 14, G_AND, 3 }, { "7427", 14, G_NOR, 3 },
+  { "7432", 14, G_OR, 2 }, { "7486", 14, G_XOR, 2 },
+  { "74157", 16, G_MUX, 0 }, { "74244", 20, G_BUF, 0 }, { "74283", 16, G_ADD, 0 }
+};
+
+// Pins (inputs..., output) of the gates of the 14-pin chips.
+const int gates1[6][2] = { { 1, 2 }, { 3, 4 }, { 5, 6 }, { 9, 8 }, { 11, 10 }, { 13, 12 } };
+const int gates2[4][3] = { { 1, 2, 3 }, { 4, 5, 6 }, { 9, 10, 8 }, { 12, 13, 11 } };
+const int gates3[3][4] = { { 1, 2, 13, 12 }, { 3, 4, 5, 6 }, { 9, 10, 11, 8 } };
+
+typedef struct
+{
+  char name[MAX_NAME];
+  int kind;               // K_*
+  int sub;                // K_SUB: circuit
+  const Ttl* ttl;         // K_TTL
+  int x, y, facing;
+  int width, output;      // K_PIN, K_GROUND
+  char label[MAX_NAME];   // K_PIN
+  int fanout, incoming;   // K_SPLITTER
+  int bitend[MAX_BITS];   // K_SPLITTER: end of every bit, -1 if none
+  char bad[80];           // unsupported attribute, if any
+  int nports;
+  int* pnet;              // net of every port
+} Comp;
+
+typedef struct
+{
+  char name[MAX_NAME];
+  Comp* comps;
+  int ncomps;
+  int (*wires)[4];
+  int nwires;
+  // Derived by prep():
+  int prepped;
+  int* pins;              // comps of the pins in port order: inputs, outputs
+  int nins, nouts;
+  int nnets;
+  int* netwidth;
+  int* netoff;            // first bit of a net in an instance
+  int* netx;              // a point of a net, for messages
+  int* nety;
+  int nbits;
+} Circ;
+
+Circ* circs;
+int ncircs;
+
+// The flat netlist: the nodes compute the values of bits, which are
+// joined into nets by union-find and driven by node outputs.
+enum
+{
+  N_IN,  // a: input (IN_*)
+  N_C0,
+  N_C1,
+  N_BIT, // a: bit, b: the node driving its net (after resolve())
+  N_NOT,
+  N_AND,
+  N_OR,
+  N_XOR,
+  N_MUX, // c ? b : a
+  N_BUS  // a: bus
+};
+
+enum
+{
+  IN_DIL = 0,
+  IN_DIR = 16,
+  IN_OP  = 32,
+  IN_CI  = 36,
+  IN_CNT
+};
+
+enum
+{
+  OUT_DO  = 0,
+  OUT_CO  = 16,
+  OUT_Z,
+  OUT_S,
+  OUT_OVF,
+  OUT_CNT
+};
+
+typedef struct
+{
+  uchar op;
+  int a, b, c;
+} Node;
+
+typedef struct
+{
+  int bit, node, en; // en: active high enable node, -1 if always driving
+} Driver;
+
+typedef struct
+{
+  int val, flt, cnf; // value, floating (no drivers), conflict (> 1 driver)
+  int bit;
+} Bus;
+
+typedef struct
+{
+  const char* circ;
+  int x, y, i;
+} BitInfo;
+
+Node* nodes;
+int nnodes, cnodes;
+Driver* drivers;
+int ndrivers, cdrivers;
+Bus* buses;
+int nbuses, cbuses;
+int* bitpar;
+BitInfo* bitinfo;
+int nbits, cbits;
+int outbits[OUT_CNT];
+int verbose;
+
+void* grow(void* p, int* cap, int n, size_t size)
+{
+  if (n >= *cap)
+  {
+    *cap = *cap ? *cap * 2 : 1024;
+    if ((p = realloc(p, *cap * size)) == NULL)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  return p;
+}
+
+int mk(int op, int a, int b, int c)
+{
+  nodes = grow(nodes, &cnodes, nnodes, sizeof *nodes);
+  nodes[nnodes].op = op;
+  nodes[nnodes].a = a;
+  nodes[nnodes].b = b;
+  nodes[nnodes].c = c;
+  return nnodes++;
+}
+
+void drive(int bit, int node, int en)
+{
+  drivers = grow(drivers, &cdrivers, ndrivers, sizeof *drivers);
+  drivers[ndrivers].bit = bit;
+  drivers[ndrivers].node = node;
+  drivers[ndrivers].en = en;
+  ndrivers++;
+}
+
+int find(int bit)
+{
+  while (bitpar[bit] != bit)
+    bit = bitpar[bit] = bitpar[bitpar[bit]];
+  return bit;
+}
+
+void unite(int a, int b)
+{
+  bitpar[find(a)] = find(b);
+}
+
+// Gets the value of attribute key from an XML tag in line.
+int getattr(const char* line, const char* key, char* val, size_t size)
+{
+  char pat[MAX_NAME + 4];
+  const char* p;
+  size_t n = 0;
+  sprintf(pat, " %s=\"", key);
+  if ((p = strstr(line, pat)) == NULL)
+    return 0;
+  for (p += strlen(pat); *p && *p != '"' && n + 1 < size; p++)
+    val[n++] = *p;
+  val[n] = '\0';
+  return 1;
+}
+
+int findcirc(const char* name)
+{
+  int i;
+  for (i = 0; i < ncircs; i++)
+    if (!strcmp(circs[i].name, name))
+      return i;
+  return -1;
+}
+
+// Finishes a component after its attributes have been read.
+void endcomp(Comp* c)
+{
+  int i, k;
+  if (c->kind == K_SPLITTER)
+  {
+    // Default distribution of the bits: contiguous groups, the first ends
+    // getting an extra bit.
+    int per = c->incoming / c->fanout, extra = c->incoming % c->fanout, end = -1, left = 0;
+    if (c->incoming > MAX_BITS)
+    {
+      fprintf(stderr, "Splitter too wide\n");
+      exit(EXIT_FAILURE);
+    }
+    for (i = 0; i < c->incoming; i++)
+    {
+      if (c->bitend[i] != -2)
+        continue;
+      if (c->fanout >= c->incoming)
+      {
+        c->bitend[i] = i;
+        continue;
+      }
+      for (k = 0, end = -1, left = 0; k <= i; k++)
+        if (!left--)
+        {
+          end++;
+          left = per - 1 + (end < extra);
+        }
+      c->bitend[i] = end;
+    }
+  }
+}
+
+void parse(const char* name)
+{
+  FILE* f;
+  char line[4096], val[256];
+  Circ* cur = NULL;
+  Comp* comp = NULL;
+  int capc = 0, capcomps = 0, capwires = 0, i;
+
+  if ((f = fopen(name, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  while (fgets(line, sizeof line, f))
+  {
+    const char* tag = line + strspn(line, " \t");
+    if (!strncmp(tag, "<circuit ", 9))
+    {
+      circs = grow(circs, &capc, ncircs, sizeof *circs);
+      cur = &circs[ncircs++];
+      memset(cur, 0, sizeof *cur);
+      getattr(tag, "name", cur->name, sizeof cur->name);
+      capcomps = capwires = 0;
+    }
+    else if (!strncmp(tag, "</circuit>", 10))
+      cur = NULL;
+    else if (cur && !strncmp(tag, "<wire ", 6))
+    {
+      int (*w)[4];
+      cur->wires = grow(cur->wires, &capwires, cur->nwires, sizeof *cur->wires);
+      w = &cur->wires[cur->nwires++];
+      if (!getattr(tag, "from", val, sizeof val) || sscanf(val, "(%d,%d)", &(*w)[0], &(*w)[1]) != 2 ||
+          !getattr(tag, "to", val, sizeof val) || sscanf(val, "(%d,%d)", &(*w)[2], &(*w)[3]) != 2)
+        goto lbad;
+    }
+    else if (cur && !strncmp(tag, "<comp ", 6))
+    {
+      cur->comps = grow(cur->comps, &capcomps, cur->ncomps, sizeof *cur->comps);
+      comp = &cur->comps[cur->ncomps++];
+      memset(comp, 0, sizeof *comp);
+      if (!getattr(tag, "name", comp->name, sizeof comp->name) ||
+          !getattr(tag, "loc", val, sizeof val) || sscanf(val, "(%d,%d)", &comp->x, &comp->y) != 2)
+        goto lbad;
+      comp->sub = -1;
+      comp->width = 1;
+      comp->fanout = comp->incoming = 2;
+      for (i = 0; i < MAX_BITS; i++)
+        comp->bitend[i] = -2; // default
+      if (!getattr(tag, "lib", val, sizeof val))
+        comp->kind = K_SUB;
+      else if (!strcmp(comp->name, "Pin"))
+        comp->kind = K_PIN;
+      else if (!strcmp(comp->name, "Splitter"))
+        comp->kind = K_SPLITTER;
+      else if (!strcmp(comp->name, "Ground"))
+        comp->kind = K_GROUND;
+      else if (!strcmp(comp->name, "Text"))
+        comp->kind = K_TEXT;
+      else
+      {
+        comp->kind = K_TTL;
+        for (i = 0; i < (int)(sizeof ttls / sizeof ttls[0]); i++)
+          if (!strcmp(comp->name, ttls[i].name))
+            comp->ttl = &ttls[i];
+        // Unsupported components are only an error if used.
+      }
+      if (strstr(tag, "/>"))
+      {
+        endcomp(comp);
+        comp = NULL;
+      }
+    }
+    else if (comp && !strncmp(tag, "</comp>", 7))
+    {
+      endcomp(comp);
+      comp = NULL;
+    }
+    else if (comp && !strncmp(tag, "<a ", 3))
+    {
+      char key[MAX_NAME];
+      if (!getattr(tag, "name", key, sizeof key) || !getattr(tag, "val", val, sizeof val))
+        continue;
+      if (!strcmp(key, "facing"))
+        comp->facing = !strcmp(val, "south") ? FACE_S : !strcmp(val, "west") ? FACE_W :
+                       !strcmp(val, "north") ? FACE_N : FACE_E;
+      else if (!strcmp(key, "width"))
+        comp->width = atoi(val);
+      else if (!strcmp(key, "output"))
+        comp->output = !strcmp(val, "true");
+      else if (!strcmp(key, "label"))
+        sprintf(comp->label, "%.*s", MAX_NAME - 1, val);
+      else if (!strcmp(key, "fanout"))
+        comp->fanout = atoi(val);
+      else if (!strcmp(key, "incoming"))
+        comp->incoming = atoi(val);
+      else if (!strncmp(key, "bit", 3) && (i = atoi(key + 3)) >= 0 && i < MAX_BITS)
+        comp->bitend[i] = strcmp(val, "none") ? atoi(val) : -1;
+      else if ((!strcmp(key, "appear") && strcmp(val, "left")) ||
+               (!strcmp(key, "spacing") && strcmp(val, "1")) ||
+               (!strcmp(key, "circuitnamedboxfixedsize") && strcmp(val, "true")))
+        sprintf(comp->bad, "%.31s=\"%.31s\"", key, val);
+    }
+  }
+
+  fclose(f);
+  return;
+
+lbad:
+  fprintf(stderr, "Can't parse \"%s\" in file \"%s\"\n", line, name);
+  exit(EXIT_FAILURE);
+}
+
+// Rotates the offset of a port of an east-facing component.
+void rotate(int facing, int* dx, int* dy)
+{
+  int x = *dx, y = *dy;
+  switch (facing)
+  {
+  case FACE_S: *dx = -y; *dy = x; break;
+  case FACE_W: *dx = -x; *dy = -y; break;
+  case FACE_N: *dx = y; *dy = -x; break;
+  }
+}
+
+int nports(const Comp* c)
+{
+  switch (c->kind)
+  {
+  case K_PIN:
+  case K_GROUND: return 1;
+  case K_SPLITTER: return 1 + c->fanout;
+  case K_TTL: return c->ttl->pins + 1; // port k is pin k, port 0 is unused
+  case K_SUB: return circs[c->sub].nins + circs[c->sub].nouts;
+  }
+  return 0;
+}
+
+// Location and width of port k of component c. Returns 0 if there's no
+// such port (TTL VCC and GND).
+int port(const Comp* c, int k, int* x, int* y, int* width)
+{
+  int dx = 0, dy = 0, i;
+  *width = 1;
+  switch (c->kind)
+  {
+  case K_PIN:
+  case K_GROUND:
+    *width = c->width;
+    break;
+  case K_SPLITTER:
+    if (!k)
+    {
+      *width = c->incoming;
+      break;
+    }
+    k--;
+    for (*width = i = 0; i < c->incoming; i++)
+      *width += c->bitend[i] == k;
+    if (!*width)
+      return 0;
+    // Left-handed appearance, spacing 1.
+    switch (c->facing)
+    {
+    case FACE_E: dx = 20; dy = -10 * c->fanout + 10 * k; break;
+    case FACE_W: dx = -20; dy = 10 + 10 * k; break;
+    case FACE_S: dx = 10 * c->fanout - 10 * k; dy = 20; break;
+    case FACE_N: dx = -10 - 10 * k; dy = -20; break;
+    }
+    *x = c->x + dx;
+    *y = c->y + dy;
+    return 1;
+  case K_TTL:
+  {
+    int n = c->ttl->pins;
+    if (k == 0 || k == n || k == n / 2)
+      return 0;
+    if (k <= n / 2)
+      dx = 10 + 20 * (k - 1), dy = 30;
+    else
+      dx = 10 + 20 * (n - k), dy = -30;
+    break;
+  }
+  case K_SUB:
+  {
+    const Circ* s = &circs[c->sub];
+    *width = s->comps[s->pins[k]].width;
+    // Inputs on the west side, outputs on the east side, each from the
+    // top in the order of their locations, the anchor at the first output.
+    if (k < s->nins)
+      dx = s->nouts ? -BOX_WIDTH : 0, dy = PIN_DY * k;
+    else
+      dx = 0, dy = PIN_DY * (k - s->nins);
+    break;
+  }
+  default:
+    return 0;
+  }
+  rotate(c->facing, &dx, &dy);
+  *x = c->x + dx;
+  *y = c->y + dy;
+  return 1;
+}
+
+// Points (wire ends and ports) of a circuit, joined by the wires.
+typedef struct
+{
+  int x, y, par, nports, nwires;
+} Point;
+
+Point* pts;
+int npts, cpts;
+int* ptab;
+int ptabsize;
+
+int point(int x, int y)
+{
+  uint h = ((uint)x * 31337u + (uint)y * 7919u) & (ptabsize - 1);
+  while (ptab[h] >= 0)
+  {
+    if (pts[ptab[h]].x == x && pts[ptab[h]].y == y)
+      return ptab[h];
+    h = (h + 1) & (ptabsize - 1);
+  }
+  pts = grow(pts, &cpts, npts, sizeof *pts);
+  pts[npts].x = x;
+  pts[npts].y = y;
+  pts[npts].par = npts;
+  pts[npts].nports = pts[npts].nwires = 0;
+  return ptab[h] = npts++;
+}
+
+int ptfind(int p)
+{
+  while (pts[p].par != p)
+    p = pts[p].par = pts[pts[p].par].par;
+  return p;
+}
+
+int pincmp(const void* a, const void* b);
+const Circ* sortcirc;
+
+int pincmp(const void* a, const void* b)
+{
+  const Comp* p = &sortcirc->comps[*(const int*)a];
+  const Comp* q = &sortcirc->comps[*(const int*)b];
+  if (p->output != q->output)
+    return p->output - q->output;
+  if (p->y != q->y)
+    return (p->y > q->y) - (p->y < q->y);
+  return (p->x > q->x) - (p->x < q->x);
+}
+
+void prep(int ci);
+
+// Joins the points of circuit ci into nets and finds the nets of the ports.
+void prep(int ci)
+{
+  Circ* c = &circs[ci];
+  int i, k, n;
+  int* netof;
+
+  if (c->prepped)
+    return;
+  c->prepped = 1;
+
+  // Port order of the pins.
+  if ((c->pins = malloc((c->ncomps + 1) * sizeof *c->pins)) == NULL)
+    goto lnomem;
+  for (n = i = 0; i < c->ncomps; i++)
+    if (c->comps[i].kind == K_PIN)
+    {
+      c->pins[n++] = i;
+      if (c->comps[i].output)
+        c->nouts++;
+      else
+        c->nins++;
+    }
+  sortcirc = c;
+  qsort(c->pins, n, sizeof *c->pins, pincmp);
+
+  for (i = 0; i < c->ncomps; i++)
+  {
+    Comp* comp = &c->comps[i];
+    if (comp->bad[0])
+    {
+      fprintf(stderr, "Unsupported attribute %s of %s at (%d,%d) in %s\n",
+              comp->bad, comp->name, comp->x, comp->y, c->name);
+      exit(EXIT_FAILURE);
+    }
+    if (comp->kind == K_SUB)
+    {
+      if ((comp->sub = findcirc(comp->name)) < 0)
+      {
+        fprintf(stderr, "Unknown component %s at (%d,%d) in %s\n", comp->name, comp->x, comp->y, c->name);
+        exit(EXIT_FAILURE);
+      }
+      prep(comp->sub);
+    }
+    else if (comp->kind == K_TTL && !comp->ttl)
+    {
+      fprintf(stderr, "Unsupported component %s at (%d,%d) in %s\n", comp->name, comp->x, comp->y, c->name);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  // Points.
+  npts = 0;
+  for (ptabsize = 1024; ptabsize < 4 * (2 * c->nwires + 32 * c->ncomps); ptabsize *= 2)
+    ;
+  free(ptab);
+  if ((ptab = malloc(ptabsize * sizeof *ptab)) == NULL)
+    goto lnomem;
+  memset(ptab, -1, ptabsize * sizeof *ptab);
+  for (i = 0; i < c->nwires; i++)
+  {
+    int a = point(c->wires[i][0], c->wires[i][1]);
+    int b = point(c->wires[i][2], c->wires[i][3]);
+    pts[a].nwires++;
+    pts[b].nwires++;
+    pts[ptfind(a)].par = ptfind(b);
+  }
+  for (i = 0; i < c->ncomps; i++)
+  {
+    Comp* comp = &c->comps[i];
+    comp->nports = nports(comp);
+    if ((comp->pnet = malloc((comp->nports + 1) * sizeof *comp->pnet)) == NULL)
+      goto lnomem;
+    for (k = 0; k < comp->nports; k++)
+    {
+      int x, y, w;
+      comp->pnet[k] = -1;
+      if (port(comp, k, &x, &y, &w))
+        pts[comp->pnet[k] = point(x, y)].nports++;
+    }
+  }
+
+  // Nets.
+  if ((netof = malloc(npts * sizeof *netof)) == NULL ||
+      (c->netwidth = calloc(npts, sizeof *c->netwidth)) == NULL ||
+      (c->netoff = calloc(npts, sizeof *c->netoff)) == NULL ||
+      (c->netx = calloc(npts, sizeof *c->netx)) == NULL ||
+      (c->nety = calloc(npts, sizeof *c->nety)) == NULL)
+    goto lnomem;
+  for (i = 0; i < npts; i++)
+    netof[i] = -1;
+  for (i = 0; i < npts; i++)
+  {
+    int r = ptfind(i);
+    if (netof[r] < 0)
+    {
+      netof[r] = c->nnets++;
+      c->netx[netof[r]] = pts[i].x;
+      c->nety[netof[r]] = pts[i].y;
+    }
+    netof[i] = netof[r];
+  }
+  for (i = 0; i < c->ncomps; i++)
+  {
+    Comp* comp = &c->comps[i];
+    for (k = 0; k < comp->nports; k++)
+    {
+      int x, y, w, p = comp->pnet[k], net;
+      if (p < 0)
+        continue;
+      port(comp, k, &x, &y, &w);
+      if (verbose && pts[p].nports == 1 && !pts[p].nwires)
+        printf("Unconnected: %s port %d (%d,%d) of %s at (%d,%d)\n",
+               c->name, k, x, y, comp->name, comp->x, comp->y);
+      net = comp->pnet[k] = netof[p];
+      if (c->netwidth[net] && c->netwidth[net] != w)
+      {
+        fprintf(stderr, "Width mismatch at (%d,%d) in %s: %d vs %d\n", x, y, c->name, c->netwidth[net], w);
+        exit(EXIT_FAILURE);
+      }
+      c->netwidth[net] = w;
+    }
+  }
+  for (i = 0; i < c->nnets; i++)
+  {
+    c->netoff[i] = c->nbits;
+    c->nbits += c->netwidth[i];
+  }
+  free(netof);
+  return;
+
+lnomem:
+  fprintf(stderr, "Out of memory\n");
+  exit(EXIT_FAILURE);
+}
+
+// Node reading bit i of port k of a component whose nets start at bit base.
+int in(const Circ* c, const Comp* comp, int base, int k, int i)
+{
+  if (comp->pnet[k] < 0)
+    return mk(N_C0, 0, 0, 0);
+  return mk(N_BIT, base + c->netoff[comp->pnet[k]] + i, -1, 0);
+}
+
+int pbit(const Circ* c, const Comp* comp, int base, int k, int i)
+{
+  return base + c->netoff[comp->pnet[k]] + i;
+}
+
+// Adds the logic of a TTL chip.
+void ttl(const Circ* c, const Comp* comp, int base)
+{
+  const Ttl* t = comp->ttl;
+  int i, k;
+  switch (t->func)
+  {
+  case G_MUX:
+  {
+    // 74157: Y = !G & (S ? B : A), pins (A, B, Y) per selector, S = 1, G = 15.
+    static const int p[4][3] = { { 2, 3, 4 }, { 5, 6, 7 }, { 11, 10, 9 }, { 14, 13, 12 } };
+    int s = in(c, comp, base, 1, 0), g = mk(N_NOT, in(c, comp, base, 15, 0), 0, 0);
+    for (i = 0; i < 4; i++)
+      drive(pbit(c, comp, base, p[i][2], 0),
+            mk(N_AND, g, mk(N_MUX, in(c, comp, base, p[i][0], 0), in(c, comp, base, p[i][1], 0), s), 0), -1);
+    return;
+  }
+  case G_BUF:
+  {
+    // 74244: 1Y = 1A if !1G (1), 2Y = 2A if !2G (19), tri-state.
+    static const int p[8][2] = { { 2, 18 }, { 4, 16 }, { 6, 14 }, { 8, 12 }, { 11, 9 }, { 13, 7 }, { 15, 5 }, { 17, 3 } };
+    int g1 = mk(N_NOT, in(c, comp, base, 1, 0), 0, 0), g2 = mk(N_NOT, in(c, comp, base, 19, 0), 0, 0);
+    for (i = 0; i < 8; i++)
+      drive(pbit(c, comp, base, p[i][1], 0), in(c, comp, base, p[i][0], 0), (i < 4) ? g1 : g2);
+    return;
+  }
+  case G_ADD:
+  {
+    // 74283: A1-A4 = 5, 3, 14, 12, B1-B4 = 6, 2, 15, 11, S1-S4 = 4, 1, 13, 10, C0 = 7, C4 = 9.
+    static const int p[4][3] = { { 5, 6, 4 }, { 3, 2, 1 }, { 14, 15, 13 }, { 12, 11, 10 } };
+    int cy = in(c, comp, base, 7, 0);
+    for (i = 0; i < 4; i++)
+    {
+      int a = in(c, comp, base, p[i][0], 0), b = in(c, comp, base, p[i][1], 0), h = mk(N_XOR, a, b, 0);
+      drive(pbit(c, comp, base, p[i][2], 0), mk(N_XOR, h, cy, 0), -1);
+      cy = mk(N_OR, mk(N_AND, a, b, 0), mk(N_AND, h, cy, 0), 0);
+    }
+    drive(pbit(c, comp, base, 9, 0), cy, -1);
+    return;
+  }
+  }
+
+  for (i = 0; i < 6; i++)
+  {
+    const int* p = (t->inputs == 1) ? gates1[i] : (t->inputs == 2) ? gates2[i] : gates3[i];
+    int op = (t->func == G_AND || t->func == G_NAND) ? N_AND : (t->func == G_XOR) ? N_XOR : N_OR;
+    int v;
+    if ((t->inputs == 2 && i >= 4) || (t->inputs == 3 && i >= 3))
+      break;
+    v = in(c, comp, base, p[0], 0);
+    for (k = 1; k < t->inputs; k++)
+      v = mk(op, v, in(c, comp, base, p[k], 0), 0);
+    if (t->func == G_NOT || t->func == G_NAND || t->func == G_NOR)
+      v = mk(N_NOT, v, 0, 0);
+    drive(pbit(c, comp, base, p[t->inputs], 0), v, -1);
+  }
+}
+
+// Instantiates circuit ci. pinbits[] has the bits of the pins (indexed by
+// component) connected to the parent circuit, NULL at the top level.
+void flatten(int ci, int** pinbits)
+{
+  const Circ* c = &circs[ci];
+  int base = nbits, i, k, j, n;
+
+  for (i = 0; i < c->nnets; i++)
+    for (k = 0; k < c->netwidth[i]; k++)
+    {
+      bitpar = grow(bitpar, &cbits, nbits, sizeof *bitpar);
+      bitinfo = realloc(bitinfo, cbits * sizeof *bitinfo);
+      if (!bitinfo)
+      {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+      }
+      bitpar[nbits] = nbits;
+      bitinfo[nbits].circ = c->name;
+      bitinfo[nbits].x = c->netx[i];
+      bitinfo[nbits].y = c->nety[i];
+      bitinfo[nbits].i = k;
+      nbits++;
+    }
+
+  for (i = 0; i < c->ncomps; i++)
+  {
+    const Comp* comp = &c->comps[i];
+    switch (comp->kind)
+    {
+    case K_PIN:
+      for (k = 0; k < comp->width; k++)
+      {
+        int b = pbit(c, comp, base, 0, k);
+        if (pinbits)
+          unite(b, pinbits[i][k]);
+        else if (!comp->output)
+        {
+          int inp = !strcmp(comp->label, "DIL") ? IN_DIL : !strcmp(comp->label, "DIR") ? IN_DIR :
+                    !strcmp(comp->label, "OP") ? IN_OP : !strcmp(comp->label, "CI") ? IN_CI : -1;
+          if (inp < 0)
+          {
+            fprintf(stderr, "Unknown input pin %s\n", comp->label);
+            exit(EXIT_FAILURE);
+          }
+          drive(b, mk(N_IN, inp + k, 0, 0), -1);
+        }
+        else
+        {
+          int out = !strcmp(comp->label, "DO") ? OUT_DO : !strcmp(comp->label, "CO") ? OUT_CO :
+                    !strcmp(comp->label, "Z") ? OUT_Z : !strcmp(comp->label, "S") ? OUT_S :
+                    !strcmp(comp->label, "OVF") ? OUT_OVF : -1;
+          if (out < 0)
+          {
+            fprintf(stderr, "Unknown output pin %s\n", comp->label);
+            exit(EXIT_FAILURE);
+          }
+          outbits[out + k] = b;
+        }
+      }
+      break;
+    case K_GROUND:
+      for (k = 0; k < comp->width; k++)
+        drive(pbit(c, comp, base, 0, k), mk(N_C0, 0, 0, 0), -1);
+      break;
+    case K_SPLITTER:
+      for (k = 0; k < comp->incoming; k++)
+      {
+        int e = comp->bitend[k];
+        if (e < 0 || e >= comp->fanout)
+          continue;
+        for (n = j = 0; j < k; j++)
+          n += comp->bitend[j] == e;
+        unite(pbit(c, comp, base, 0, k), pbit(c, comp, base, 1 + e, n));
+      }
+      break;
+    case K_TTL:
+      ttl(c, comp, base);
+      break;
+    case K_SUB:
+    {
+      const Circ* s = &circs[comp->sub];
+      int** sub = calloc(s->ncomps, sizeof *sub);
+      if (!sub)
+      {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+      }
+      for (k = 0; k < comp->nports; k++)
+      {
+        int p = s->pins[k], w = s->comps[p].width;
+        if ((sub[p] = malloc(w * sizeof **sub)) == NULL)
+        {
+          fprintf(stderr, "Out of memory\n");
+          exit(EXIT_FAILURE);
+        }
+        for (j = 0; j < w; j++)
+          sub[p][j] = pbit(c, comp, base, k, j);
+      }
+      flatten(comp->sub, sub);
+      for (k = 0; k < s->ncomps; k++)
+        free(sub[k]);
+      free(sub);
+      break;
+    }
+    }
+  }
+}
+
+// Points the N_BIT nodes to the nodes driving their nets, making buses of
+// the nets with tri-state drivers (or none).
+void resolve(void)
+{
+  int* head = malloc(nbits * sizeof *head);
+  int* next = malloc((ndrivers + 1) * sizeof *next);
+  int* val = malloc(nbits * sizeof *val);
+  int i, n;
+
+  if (!head || !next || !val)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < nbits; i++)
+    head[i] = val[i] = -1;
+  for (i = 0; i < ndrivers; i++)
+  {
+    int r = find(drivers[i].bit);
+    next[i] = head[r];
+    head[r] = i;
+  }
+
+  for (n = nnodes, i = 0; i < n; i++)
+  {
+    int r, d, always = 0, cnt = 0;
+    if (nodes[i].op != N_BIT)
+      continue;
+    r = find(nodes[i].a);
+    if (val[r] < 0)
+    {
+      for (d = head[r]; d >= 0; d = next[d])
+      {
+        cnt++;
+        always += drivers[d].en < 0;
+      }
+      if (cnt == 1 && always)
+        val[r] = drivers[head[r]].node;
+      else if (always)
+      {
+        fprintf(stderr, "Several outputs drive %s (%d,%d) bit %d\n",
+                bitinfo[r].circ, bitinfo[r].x, bitinfo[r].y, bitinfo[r].i);
+        exit(EXIT_FAILURE);
+      }
+      else
+      {
+        Bus* u;
+        int v = mk(N_C0, 0, 0, 0), f = mk(N_C1, 0, 0, 0), k = mk(N_C0, 0, 0, 0), any = mk(N_C0, 0, 0, 0);
+        for (d = head[r]; d >= 0; d = next[d])
+        {
+          int en = drivers[d].en;
+          v = mk(N_OR, v, mk(N_AND, en, drivers[d].node, 0), 0);
+          f = mk(N_AND, f, mk(N_NOT, en, 0, 0), 0);
+          k = mk(N_OR, k, mk(N_AND, any, en, 0), 0);
+          any = mk(N_OR, any, en, 0);
+        }
+        buses = grow(buses, &cbuses, nbuses, sizeof *buses);
+        u = &buses[nbuses];
+        u->val = v;
+        u->flt = f;
+        u->cnf = k;
+        u->bit = r;
+        val[r] = mk(N_BUS, nbuses++, 0, 0);
+      }
+    }
+    nodes[i].b = val[r];
+  }
+
+  free(head);
+  free(next);
+  free(val);
+}
+
+// Bit-sliced evaluation.
+typedef ulong Vec __attribute__((vector_size(32)));
+
+enum
+{
+  WBITS = 8 * sizeof(ulong),
+  LANES = 8 * sizeof(Vec),
+  REG_ZERO = 0,
+  REG_ONES,
+  REG_DIL,
+  REG_DIR = REG_DIL + 16,
+  REG_TEMP = REG_DIR + 16
+};
+
+typedef struct
+{
+  uchar op;
+  int d, a, b, c;
+} Ins;
+
+typedef struct
+{
+  uint op, ci;
+  Ins* ins;
+  int nins, cins, nregs;
+  int out[OUT_CNT];
+  int* chk;          // regs of the runtime bus checks (non-constant enables)
+  int nchk, cchk;
+  char problems[MAX_PROBLEMS][96];
+  int nproblems;
+  int* reg;          // per node, -1 if not compiled yet
+} Prog;
+
+const uint ops[] = { 0, 1, 2, 3, 4, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+const char* const opnames[16] =
+{
+  "sr", "sl", "rr", "rl", "asr", "", "", "xor",
+  "add", "sub", "adc", "sbb", "zxt", "sxt", "and", "or"
+};
+
+enum
+{
+  NOPS = sizeof ops / sizeof ops[0],
+  NPROGS = 2 * NOPS
+};
+
+Prog progs[NPROGS];
+
+int emit(Prog* p, int op, int a, int b, int c)
+{
+  p->ins = grow(p->ins, &p->cins, p->nins, sizeof *p->ins);
+  p->ins[p->nins].op = op;
+  p->ins[p->nins].d = p->nregs;
+  p->ins[p->nins].a = a;
+  p->ins[p->nins].b = b;
+  p->ins[p->nins].c = c;
+  p->nins++;
+  return p->nregs++;
+}
+
+void problem(Prog* p, const Bus* u, const char* what)
+{
+  const BitInfo* b = &bitinfo[u->bit];
+  if (p->nproblems < MAX_PROBLEMS)
+    sprintf(p->problems[p->nproblems++], "%s bus: %.32s (%d,%d) bit %d", what, b->circ, b->x, b->y, b->i);
+}
+
+// Inverts register x.
+int inv(Prog* p, int x)
+{
+  if (x == REG_ZERO || x == REG_ONES)
+    return REG_ZERO + REG_ONES - x;
+  if (x >= REG_TEMP && p->ins[x - REG_TEMP].op == N_NOT)
+    return p->ins[x - REG_TEMP].a;
+  return emit(p, N_NOT, x, 0, 0);
+}
+
+// Compiles node n into p, folding constants; returns its register.
+int fold(Prog* p, int n)
+{
+  const Node* nd = &nodes[n];
+  int r, x, y, s;
+
+  if (p->reg[n] >= 0)
+    return p->reg[n];
+
+  switch (nd->op)
+  {
+  case N_IN:
+    if (nd->a < IN_DIR)
+      r = REG_DIL + nd->a - IN_DIL;
+    else if (nd->a < IN_OP)
+      r = REG_DIR + nd->a - IN_DIR;
+    else if (nd->a < IN_CI)
+      r = ((p->op >> (nd->a - IN_OP)) & 1) ? REG_ONES : REG_ZERO;
+    else
+      r = p->ci ? REG_ONES : REG_ZERO;
+    break;
+  case N_C0: r = REG_ZERO; break;
+  case N_C1: r = REG_ONES; break;
+  case N_BIT:
+    if (nd->b < 0)
+    {
+      fprintf(stderr, "Internal error\n");
+      exit(EXIT_FAILURE);
+    }
+    r = fold(p, nd->b);
+    break;
+  case N_NOT:
+    r = inv(p, fold(p, nd->a));
+    break;
+  case N_AND:
+  case N_OR:
+  {
+    int absorb = (nd->op == N_AND) ? REG_ZERO : REG_ONES;
+    if ((x = fold(p, nd->a)) == absorb || (y = fold(p, nd->b)) == absorb)
+      r = absorb;
+    else if (x == REG_ZERO + REG_ONES - absorb || x == y)
+      r = y;
+    else if (y == REG_ZERO + REG_ONES - absorb)
+      r = x;
+    else
+      r = emit(p, nd->op, x, y, 0);
+    break;
+  }
+  case N_XOR:
+    x = fold(p, nd->a);
+    y = fold(p, nd->b);
+    if (x == y)
+      r = REG_ZERO;
+    else if (x == REG_ZERO || y == REG_ZERO)
+      r = x + y - REG_ZERO;
+    else if (x == REG_ONES || y == REG_ONES)
+      r = inv(p, x + y - REG_ONES);
+    else
+      r = emit(p, N_XOR, x, y, 0);
+    break;
+  case N_MUX:
+    s = fold(p, nd->c);
+    if (s == REG_ZERO)
+      r = fold(p, nd->a);
+    else if (s == REG_ONES)
+      r = fold(p, nd->b);
+    else if ((x = fold(p, nd->a)) == (y = fold(p, nd->b)))
+      r = x;
+    else
+      r = emit(p, N_MUX, x, y, s);
+    break;
+  case N_BUS:
+  {
+    const Bus* u = &buses[nd->a];
+    x = fold(p, u->flt);
+    y = fold(p, u->cnf);
+    if (x == REG_ONES)
+      problem(p, u, "Floating");
+    else if (x != REG_ZERO)
+    {
+      p->chk = grow(p->chk, &p->cchk, p->nchk, sizeof *p->chk);
+      p->chk[p->nchk++] = x;
+    }
+    if (y == REG_ONES)
+      problem(p, u, "Conflicting");
+    else if (y != REG_ZERO)
+    {
+      p->chk = grow(p->chk, &p->cchk, p->nchk, sizeof *p->chk);
+      p->chk[p->nchk++] = y;
+    }
+    r = fold(p, u->val);
+    break;
+  }
+  default:
+    fprintf(stderr, "Internal error\n");
+    exit(EXIT_FAILURE);
+  }
+
+  return p->reg[n] = r;
+}
+
+void run(const Prog* p, Vec* v)
+{
+  const Ins* in = p->ins;
+  const Ins* end = in + p->nins;
+  for (; in < end; in++)
+    switch (in->op)
+    {
+    case N_NOT: v[in->d] = ~v[in->a]; break;
+    case N_AND: v[in->d] = v[in->a] & v[in->b]; break;
+    case N_OR: v[in->d] = v[in->a] | v[in->b]; break;
+    case N_XOR: v[in->d] = v[in->a] ^ v[in->b]; break;
+    case N_MUX: v[in->d] = v[in->a] ^ ((v[in->a] ^ v[in->b]) & v[in->c]); break;
+    }
+}
+
+// alu() of emu.h, bit-sliced: a is the same in all lanes, b[] and the
+// results (o[], indexed by OUT_*) are per lane.
+void ref(uint op, uint a, uint ci, const Vec* b, Vec* o)
+{
+  Vec zero = { 0 }, ones = ~zero, x[16], y[16], c, t;
+  int i, s;
+
+  for (i = 0; i < 16; i++)
+    x[i] = ((a >> i) & 1) ? ones : zero;
+  o[OUT_CO] = o[OUT_OVF] = zero;
+
+  switch (op)
+  {
+  case 0: case 1: case 2: case 3: case 4: // sr, sl, rr, rl, asr by b & 15
+    for (s = 0; s < 4; s++)
+    {
+      int n = 1 << s;
+      for (i = 0; i < 16; i++)
+        switch (op)
+        {
+        case 0: y[i] = (i + n < 16) ? x[i + n] : zero; break;
+        case 1: y[i] = (i >= n) ? x[i - n] : zero; break;
+        case 2: y[i] = x[(i + n) & 15]; break;
+        case 3: y[i] = x[(i - n) & 15]; break;
+        case 4: y[i] = (i + n < 16) ? x[i + n] : x[15]; break;
+        }
+      for (i = 0; i < 16; i++)
+        x[i] ^= (x[i] ^ y[i]) & b[s];
+    }
+    memcpy(o, x, sizeof x);
+    break;
+  case 7:
+    for (i = 0; i < 16; i++)
+      o[i] = x[i] ^ b[i];
+    break;
+  case 8: case 10: // add, adc
+  case 9: case 11: // sub/cmp, sbb: a + ~b + !borrow
+    c = (op == 10) ? (ci ? ones : zero) : (op == 11) ? (ci ? zero : ones) : (op == 9) ? ones : zero;
+    for (i = 0; i < 16; i++)
+    {
+      Vec bi = (op & 1) ? ~b[i] : b[i];
+      t = x[i] ^ bi;
+      o[i] = t ^ c;
+      c = (x[i] & bi) | (t & c);
+    }
+    if (op & 1)
+    {
+      o[OUT_CO] = ~c;
+      o[OUT_OVF] = (x[15] ^ b[15]) & (x[15] ^ o[15]);
+    }
+    else
+    {
+      o[OUT_CO] = c;
+      o[OUT_OVF] = (x[15] ^ o[15]) & (b[15] ^ o[15]);
+    }
+    break;
+  case 12: case 13: // zxt, sxt
+    for (i = 0; i < 16; i++)
+      o[i] = (i < 8) ? x[i] : (op == 13) ? x[7] : zero;
+    break;
+  case 14:
+    for (i = 0; i < 16; i++)
+      o[i] = x[i] & b[i];
+    break;
+  case 15:
+    for (i = 0; i < 16; i++)
+      o[i] = x[i] | b[i];
+    break;
+  }
+
+  t = zero;
+  for (i = 0; i < 16; i++)
+    t |= o[i];
+  o[OUT_Z] = ~t;
+  o[OUT_S] = o[15];
+}
+
+int lane(const Vec* v, int l)
+{
+  return ((*v)[l / WBITS] >> (l % WBITS)) & 1;
+}
+
+int nonzero(const Vec* v)
+{
+  int i;
+  for (i = 0; i < LANES / WBITS; i++)
+    if ((*v)[i])
+      return 1;
+  return 0;
+}
+
+unsigned long long popcnt(const Vec* v)
+{
+  unsigned long long n = 0;
+  int i;
+  for (i = 0; i < LANES / WBITS; i++)
+    n += __builtin_popcountll((*v)[i]);
+  return n;
+}
+
+// The DO, CO, Z, S, OVF outputs of lane l packed as DO | CO << 16 | Z << 17...
+ulong outputs(const Vec* v, const int* regs, int l)
+{
+  ulong r = 0;
+  int i;
+  for (i = 0; i < OUT_CNT; i++)
+    r |= (ulong)lane(regs ? &v[regs[i]] : &v[i], l) << i;
+  return r;
+}
+
+// Mismatch categories.
+enum
+{
+  CAT_DO,
+  CAT_CO,
+  CAT_Z,
+  CAT_S,
+  CAT_OVF,
+  CAT_BUS,
+  CAT_ANY,
+  CAT_CNT
+};
+
+typedef struct
+{
+  uint a, b, ci;
+  ulong got, exp;
+} Example;
+
+typedef struct
+{
+  uint first, step;
+  unsigned long long cnt[NOPS][CAT_CNT];
+  Example ex[NOPS][MAX_EXAMPLES];
+  int nex[NOPS];
+} Job;
+
+uint* alist; // DIL values to check
+uint na;
+int maxregs;
+
+// Sets the DIR registers for the slice of DIR values starting at b0.
+void setdir(Vec* v, uint b0)
+{
+  Vec zero = { 0 }, ones = ~zero;
+  int i, l;
+  for (i = 0; i < 16; i++)
+  {
+    if ((1 << i) < LANES)
+    {
+      v[REG_DIR + i] = zero;
+      for (l = 0; l < LANES; l++)
+        if ((l >> i) & 1)
+          v[REG_DIR + i][l / WBITS] |= 1UL << (l % WBITS);
+    }
+    else
+      v[REG_DIR + i] = ((b0 >> i) & 1) ? ones : zero;
+  }
+}
+
+Vec* allocvec(int n, void** mem)
+{
+  char* p = malloc(n * sizeof(Vec) + sizeof(Vec));
+  if (!p)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  *mem = p;
+  return (Vec*)(p + sizeof(Vec) - (size_t)p % sizeof(Vec));
+}
+
+// Checks DIL values alist[first], alist[first + step], ...
+void* job(void* arg)
+{
+  Job* j = arg;
+  void* mem;
+  Vec* v = allocvec(maxregs, &mem);
+  Vec zero = { 0 }, ones = ~zero, o[OUT_CNT], d[CAT_CNT];
+  uint ai, b0, a, k;
+  int pi, i, l;
+
+  v[REG_ZERO] = zero;
+  v[REG_ONES] = ones;
+  for (ai = j->first; ai < na; ai += j->step)
+  {
+    a = alist[ai];
+    for (i = 0; i < 16; i++)
+      v[REG_DIL + i] = ((a >> i) & 1) ? ones : zero;
+    for (b0 = 0; b0 < 0x10000; b0 += LANES)
+    {
+      setdir(v, b0);
+      for (pi = 0; pi < NPROGS; pi++)
+      {
+        const Prog* p = &progs[pi];
+        run(p, v);
+        ref(p->op, a, p->ci, &v[REG_DIR], o);
+
+        d[CAT_DO] = zero;
+        for (i = 0; i < 16; i++)
+          d[CAT_DO] |= v[p->out[i]] ^ o[i];
+        d[CAT_CO] = v[p->out[OUT_CO]] ^ o[OUT_CO];
+        d[CAT_Z] = v[p->out[OUT_Z]] ^ o[OUT_Z];
+        d[CAT_S] = v[p->out[OUT_S]] ^ o[OUT_S];
+        d[CAT_OVF] = v[p->out[OUT_OVF]] ^ o[OUT_OVF];
+        d[CAT_BUS] = zero;
+        for (i = 0; i < p->nchk; i++)
+          d[CAT_BUS] |= v[p->chk[i]];
+        d[CAT_ANY] = d[CAT_DO] | d[CAT_CO] | d[CAT_Z] | d[CAT_S] | d[CAT_OVF] | d[CAT_BUS];
+        if (!nonzero(&d[CAT_ANY]))
+          continue;
+
+        for (k = 0; k < CAT_CNT; k++)
+          j->cnt[pi / 2][k] += popcnt(&d[k]);
+        for (l = 0; l < LANES && j->nex[pi / 2] < MAX_EXAMPLES; l++)
+          if (lane(&d[CAT_ANY], l))
+          {
+            Example* e = &j->ex[pi / 2][j->nex[pi / 2]++];
+            e->a = a;
+            e->b = b0 + l;
+            e->ci = p->ci;
+            e->got = outputs(v, p->out, l);
+            e->exp = outputs(o, NULL, l);
+          }
+      }
+    }
+  }
+  free(mem);
+  return NULL;
+}
+
+// Checks ref() against alu() for some operands.
+void selftest(void)
+{
+  static const uint as[] = { 0x0000, 0x0001, 0x007F, 0x0080, 0x00FF, 0x7FFF, 0x8000, 0xFFFF, 0x1234, 0xA5C3 };
+  static const uint bs[] = { 0x0000, 0x7F00, 0x8000, 0xFF00 };
+  void* mem;
+  Vec* v = allocvec(REG_TEMP, &mem);
+  Vec o[OUT_CNT];
+  uint ai, bi, k, ci;
+  int l;
+  for (k = 0; k < NOPS; k++)
+    for (ci = 0; ci < 2; ci++)
+      for (ai = 0; ai < sizeof as / sizeof as[0]; ai++)
+        for (bi = 0; bi < sizeof bs / sizeof bs[0]; bi++)
+        {
+          uint b0 = bs[bi] & ~(LANES - 1U);
+          setdir(v, b0);
+          ref(ops[k], as[ai], ci, &v[REG_DIR], o);
+          for (l = 0; l < LANES; l++)
+          {
+            uint fl, r = alu(ops[k], as[ai], b0 + l, ci, &fl);
+            ulong exp = r | (ulong)(fl & 1) << OUT_CO | (ulong)((fl >> 1) & 1) << OUT_Z |
+                        (ulong)((fl >> 2) & 1) << OUT_S | (ulong)((fl >> 3) & 1) << OUT_OVF;
+            if (outputs(o, NULL, l) != exp)
+            {
+              fprintf(stderr, "Internal error: bit-sliced alu() differs (%s %04X %04X %u)\n",
+                      opnames[ops[k]], as[ai], b0 + l, ci);
+              exit(EXIT_FAILURE);
+            }
+          }
+        }
+  free(mem);
+}
+
+void prout(ulong v)
+{
+  printf("DO=%04lX CO=%lu Z=%lu S=%lu OVF=%lu",
+         v & 0xFFFF, (v >> OUT_CO) & 1, (v >> OUT_Z) & 1, (v >> OUT_S) & 1, (v >> OUT_OVF) & 1);
+}
+
+int main(int argc, char* argv[])
+{
+  int nthreads = 4, top, outnode[OUT_CNT];
+  ulong n = 0x10000, seed = 0;
+  unsigned long long cnt[NOPS][CAT_CNT] = { { 0 } }, total = 0;
+  uint i, k;
+  int t, e;
+  Job* jobs;
+  pthread_t* thr;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-n") && i + 1 < (uint)argc)
+      n = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-seed") && i + 1 < (uint)argc)
+      seed = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else if (!strcmp(argv[i], "-v"))
+      verbose = 1;
+    else
+      goto lusage;
+  }
+  if (argc - i != 1 || n < 1 || n > 0x10000)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  aluchk [options] <circ_file>\n"
+            "Options:\n"
+            "  -n <n>      check n DIL values (default: all 65536)\n"
+            "  -seed <n>   first DIL value to check (default: 0)\n"
+            "  -j <n>      number of threads (default: 4)\n"
+            "  -v          list the unconnected ports\n");
+    exit(EXIT_FAILURE);
+  }
+
+  selftest();
+
+  parse(argv[i]);
+  if ((top = findcirc("ALU")) < 0)
+  {
+    fprintf(stderr, "No ALU circuit in file \"%s\"\n", argv[i]);
+    exit(EXIT_FAILURE);
+  }
+  for (k = 0; k < OUT_CNT; k++)
+    outbits[k] = -1;
+  prep(top);
+  flatten(top, NULL);
+  for (k = 0; k < OUT_CNT; k++)
+  {
+    if (outbits[k] < 0)
+    {
+      fprintf(stderr, "Missing ALU output\n");
+      exit(EXIT_FAILURE);
+    }
+    outnode[k] = mk(N_BIT, outbits[k], -1, 0);
+  }
+  resolve();
+
+  maxregs = REG_TEMP;
+  for (t = 0; t < NPROGS; t++)
+  {
+    Prog* p = &progs[t];
+    p->op = ops[t / 2];
+    p->ci = t & 1;
+    p->nregs = REG_TEMP;
+    if ((p->reg = malloc(nnodes * sizeof *p->reg)) == NULL)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    memset(p->reg, -1, nnodes * sizeof *p->reg);
+    for (k = 0; k < OUT_CNT; k++)
+      p->out[k] = fold(p, outnode[k]);
+    free(p->reg);
+    if (p->nregs > maxregs)
+      maxregs = p->nregs;
+  }
+  printf("Netlist: %d nodes, %d bits, %d drivers, %d buses; %d lanes\n\n",
+         nnodes, nbits, ndrivers, nbuses, LANES);
+
+  // DIL values: seed, seed + 40503, ... (all of them if n = 65536).
+  if ((alist = malloc(n * sizeof *alist)) == NULL)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (na = 0; na < n; na++)
+    alist[na] = (seed + na * 40503UL) & 0xFFFF;
+
+  jobs = calloc(nthreads, sizeof *jobs);
+  thr = calloc(nthreads, sizeof *thr);
+  if (!jobs || !thr)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (t = 0; t < nthreads; t++)
+  {
+    jobs[t].first = t;
+    jobs[t].step = nthreads;
+    if (pthread_create(&thr[t], NULL, job, &jobs[t]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (t = 0; t < nthreads; t++)
+    pthread_join(thr[t], NULL);
+
+  printf("%-4s %-5s %-11s %12s %12s %12s %12s %12s %12s %12s\n",
+         "op", "name", "ins (CI=0/1)", "checked", "DO", "CO", "Z", "S", "OVF", "bus");
+  for (k = 0; k < NOPS; k++)
+  {
+    char ins[32];
+    for (t = 0; t < nthreads; t++)
+      for (e = 0; e < CAT_CNT; e++)
+        cnt[k][e] += jobs[t].cnt[k][e];
+    total += cnt[k][CAT_ANY];
+    sprintf(ins, "%d/%d", progs[2 * k].nins, progs[2 * k + 1].nins);
+    printf("%-4u %-5s %-11s %12llu %12llu %12llu %12llu %12llu %12llu %12llu\n",
+           ops[k], opnames[ops[k]], ins, 2ULL * 0x10000 * na,
+           cnt[k][CAT_DO], cnt[k][CAT_CO], cnt[k][CAT_Z], cnt[k][CAT_S], cnt[k][CAT_OVF], cnt[k][CAT_BUS]);
+  }
+
+  for (k = 0; k < NOPS; k++)
+  {
+    int shown = 0;
+    for (t = 0; t < 2; t++)
+      for (e = 0; e < progs[2 * k + t].nproblems; e++)
+        printf("%s CI=%d: %s\n", opnames[ops[k]], t, progs[2 * k + t].problems[e]);
+    for (t = 0; t < nthreads; t++)
+      for (e = 0; e < jobs[t].nex[k] && shown < MAX_EXAMPLES; e++, shown++)
+      {
+        const Example* x = &jobs[t].ex[k][e];
+        printf("%s DIL=%04X DIR=%04X CI=%u: ", opnames[ops[k]], x->a, x->b, x->ci);
+        prout(x->got);
+        printf(", alu(): ");
+        prout(x->exp);
+        printf("\n");
+      }
+  }
+
+  printf("\nChecked %u DIL x 65536 DIR x 2 CI values of %d opcodes: %llu mismatches\n",
+         na, NOPS, total);
+
+  return total ? EXIT_FAILURE : 0;
+}
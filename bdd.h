@@ -0,0 +1,254 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  A small binary decision diagram (BDD) package.
+
+  Reduced ordered BDDs with a unique table (so equal functions are equal
+  node numbers) and a computed table for the if-then-else operation, on
+  which all the other operations are based. Variable 0 is the topmost.
+
+  A manager (BddMgr) has a fixed number of nodes and isn't thread-safe;
+  use one per thread. Nodes aren't garbage-collected, instead bddreset()
+  frees all of them at once, which suits building a set of functions,
+  checking them and starting over. When the nodes run out, the manager
+  sets overflow and the results are meaningless from then on.
+
+  The header is meant to be included after emu.h.
+*/
+
+#ifndef BDD_H
+#define BDD_H
+
+typedef uint Bdd;
+
+enum
+{
+  BDD_FALSE,
+  BDD_TRUE,
+  BDD_TERMVAR = 0xFFFF // variable "number" of the terminals
+};
+
+typedef struct
+{
+  uint var, lo, hi;
+  uint next; // unique table chain
+} BddNode;
+
+typedef struct
+{
+  uint f, g, h, r;
+  uint gen;
+} BddCacheEntry;
+
+typedef struct
+{
+  BddNode* nodes;
+  uint cnt, max, peak;
+  uint* heads; // unique table
+  uint* hgen;  // heads[i] is valid if hgen[i] == gen
+  uint hmask;
+  BddCacheEntry* cache;
+  uint cmask;
+  uint gen;
+  int overflow;
+} BddMgr;
+
+// Makes a manager with 2**bits nodes.
+void bddinit(BddMgr* m, uint bits)
+{
+  m->max = 1U << bits;
+  m->hmask = m->max - 1;
+  m->cmask = (m->max >> 1) - 1;
+  m->nodes = malloc(m->max * sizeof *m->nodes);
+  m->heads = malloc(m->max * sizeof *m->heads);
+  m->hgen = calloc(m->max, sizeof *m->hgen);
+  m->cache = calloc(m->cmask + 1, sizeof *m->cache);
+  if (!m->nodes || !m->heads || !m->hgen || !m->cache)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  m->nodes[BDD_FALSE].var = m->nodes[BDD_TRUE].var = BDD_TERMVAR;
+  m->nodes[BDD_FALSE].lo = m->nodes[BDD_FALSE].hi = BDD_FALSE;
+  m->nodes[BDD_TRUE].lo = m->nodes[BDD_TRUE].hi = BDD_TRUE;
+  m->peak = 0;
+  m->gen = 0;
+  m->cnt = 2;
+  m->overflow = 0;
+}
+
+void bddfree(BddMgr* m)
+{
+  free(m->nodes);
+  free(m->heads);
+  free(m->hgen);
+  free(m->cache);
+}
+
+// Frees all nodes but the terminals.
+void bddreset(BddMgr* m)
+{
+  if (m->cnt > m->peak)
+    m->peak = m->cnt;
+  if (++m->gen == 0)
+  {
+    memset(m->hgen, 0, m->max * sizeof *m->hgen);
+    memset(m->cache, 0, (m->cmask + 1) * sizeof *m->cache);
+    m->gen = 1;
+  }
+  m->cnt = 2;
+  m->overflow = 0;
+}
+
+uint bddhash(uint a, uint b, uint c)
+{
+  uint h = a * 0x9E3779B1U;
+  h = (h ^ (h >> 15) ^ b) * 0x85EBCA77U;
+  h = (h ^ (h >> 13) ^ c) * 0xC2B2AE3DU;
+  return h ^ (h >> 16);
+}
+
+// The node (var ? hi : lo).
+Bdd bddmk(BddMgr* m, uint var, Bdd lo, Bdd hi)
+{
+  uint h, n;
+  if (lo == hi)
+    return lo;
+  h = bddhash(var, lo, hi) & m->hmask;
+  if (m->hgen[h] == m->gen)
+    for (n = m->heads[h]; n; n = m->nodes[n].next)
+      if (m->nodes[n].var == var && m->nodes[n].lo == lo && m->nodes[n].hi == hi)
+        return n;
+  if (m->cnt == m->max)
+  {
+    m->overflow = 1;
+    return BDD_FALSE;
+  }
+  n = m->cnt++;
+  m->nodes[n].var = var;
+  m->nodes[n].lo = lo;
+  m->nodes[n].hi = hi;
+  m->nodes[n].next = (m->hgen[h] == m->gen) ? m->heads[h] : 0;
+  m->heads[h] = n;
+  m->hgen[h] = m->gen;
+  return n;
+}
+
+Bdd bddvar(BddMgr* m, uint var)
+{
+  return bddmk(m, var, BDD_FALSE, BDD_TRUE);
+}
+
+// f ? g : h
+Bdd bddite(BddMgr* m, Bdd f, Bdd g, Bdd h)
+{
+  BddCacheEntry* e;
+  uint v, vf, vg, vh;
+  Bdd lo, hi, r;
+
+  if (f == BDD_TRUE || g == h)
+    return g;
+  if (f == BDD_FALSE)
+    return h;
+  if (g == BDD_TRUE && h == BDD_FALSE)
+    return f;
+  if (m->overflow)
+    return BDD_FALSE;
+
+  e = &m->cache[bddhash(f, g, h) & m->cmask];
+  if (e->gen == m->gen && e->f == f && e->g == g && e->h == h)
+    return e->r;
+
+  vf = m->nodes[f].var, vg = m->nodes[g].var, vh = m->nodes[h].var;
+  v = vf;
+  if (vg < v)
+    v = vg;
+  if (vh < v)
+    v = vh;
+  lo = bddite(m, (vf == v) ? m->nodes[f].lo : f,
+                 (vg == v) ? m->nodes[g].lo : g,
+                 (vh == v) ? m->nodes[h].lo : h);
+  hi = bddite(m, (vf == v) ? m->nodes[f].hi : f,
+                 (vg == v) ? m->nodes[g].hi : g,
+                 (vh == v) ? m->nodes[h].hi : h);
+  r = bddmk(m, v, lo, hi);
+
+  // The entry may have been reused by the recursive calls.
+  e = &m->cache[bddhash(f, g, h) & m->cmask];
+  e->f = f, e->g = g, e->h = h, e->r = r, e->gen = m->gen;
+  return r;
+}
+
+Bdd bddnot(BddMgr* m, Bdd f)
+{
+  return bddite(m, f, BDD_FALSE, BDD_TRUE);
+}
+
+Bdd bddand(BddMgr* m, Bdd f, Bdd g)
+{
+  return bddite(m, f, g, BDD_FALSE);
+}
+
+Bdd bddor(BddMgr* m, Bdd f, Bdd g)
+{
+  return bddite(m, f, BDD_TRUE, g);
+}
+
+Bdd bddxor(BddMgr* m, Bdd f, Bdd g)
+{
+  return bddite(m, f, bddnot(m, g), g);
+}
+
+// Finds an assignment (asg[var] = 0 or 1, nvars variables) satisfying f.
+// Variables f doesn't depend on get 0. Returns 0 if f is unsatisfiable.
+int bddsat(const BddMgr* m, Bdd f, uchar* asg, uint nvars)
+{
+  memset(asg, 0, nvars);
+  if (f == BDD_FALSE)
+    return 0;
+  while (f != BDD_TRUE)
+  {
+    const BddNode* n = &m->nodes[f];
+    if (n->lo != BDD_FALSE)
+      f = n->lo;
+    else
+    {
+      asg[n->var] = 1;
+      f = n->hi;
+    }
+  }
+  return 1;
+}
+
+// The value of f under the assignment asg.
+int bddeval(const BddMgr* m, Bdd f, const uchar* asg)
+{
+  while (f > BDD_TRUE)
+    f = asg[m->nodes[f].var] ? m->nodes[f].hi : m->nodes[f].lo;
+  return f == BDD_TRUE;
+}
+
+#endif
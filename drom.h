@@ -0,0 +1,1037 @@
+// Generated by mkdrom.c, do not edit.
+// The decoder ROM (drom.bin) built into the emulator, include after emu.h.
+
+#ifndef DROM_H
+#define DROM_H
+
+const ulong drom_rom[4096] =
+{
+  // execute1
+  DROM_ROW(0xA0028088UL), DROM_ROW(0xA0028088UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL),
+  DROM_ROW(0xA00280A8UL), DROM_ROW(0xA00280A8UL), DROM_ROW(0xA00280B8UL), DROM_ROW(0xA00280B8UL),
+  DROM_ROW(0xA00280C8UL), DROM_ROW(0xA00280C8UL), DROM_ROW(0xA00280D8UL), DROM_ROW(0xA00280D8UL),
+  DROM_ROW(0xA00180E8UL), DROM_ROW(0xA00180E8UL), DROM_ROW(0xA00280F8UL), DROM_ROW(0xA00280F8UL),
+  DROM_ROW(0xA0029088UL), DROM_ROW(0xA0029088UL), DROM_ROW(0xA0029098UL), DROM_ROW(0xA0029098UL),
+  DROM_ROW(0xA00290A8UL), DROM_ROW(0xA00290A8UL), DROM_ROW(0xA00290B8UL), DROM_ROW(0xA00290B8UL),
+  DROM_ROW(0xA00290C8UL), DROM_ROW(0xA00290C8UL), DROM_ROW(0xA00290D8UL), DROM_ROW(0xA00290D8UL),
+  DROM_ROW(0xA00190E8UL), DROM_ROW(0xA00190E8UL), DROM_ROW(0xA00290F8UL), DROM_ROW(0xA00290F8UL),
+  DROM_ROW(0xA002A088UL), DROM_ROW(0xA002A088UL), DROM_ROW(0xA002A098UL), DROM_ROW(0xA002A098UL),
+  DROM_ROW(0xA002A0A8UL), DROM_ROW(0xA002A0A8UL), DROM_ROW(0xA002A0B8UL), DROM_ROW(0xA002A0B8UL),
+  DROM_ROW(0xA002A0C8UL), DROM_ROW(0xA002A0C8UL), DROM_ROW(0xA002A0D8UL), DROM_ROW(0xA002A0D8UL),
+  DROM_ROW(0xA001A0E8UL), DROM_ROW(0xA001A0E8UL), DROM_ROW(0xA002A0F8UL), DROM_ROW(0xA002A0F8UL),
+  DROM_ROW(0xA002B088UL), DROM_ROW(0xA002B088UL), DROM_ROW(0xA002B098UL), DROM_ROW(0xA002B098UL),
+  DROM_ROW(0xA002B0A8UL), DROM_ROW(0xA002B0A8UL), DROM_ROW(0xA002B0B8UL), DROM_ROW(0xA002B0B8UL),
+  DROM_ROW(0xA002B0C8UL), DROM_ROW(0xA002B0C8UL), DROM_ROW(0xA002B0D8UL), DROM_ROW(0xA002B0D8UL),
+  DROM_ROW(0xA001B0E8UL), DROM_ROW(0xA001B0E8UL), DROM_ROW(0xA002B0F8UL), DROM_ROW(0xA002B0F8UL),
+  DROM_ROW(0xA002C088UL), DROM_ROW(0xA002C088UL), DROM_ROW(0xA002C098UL), DROM_ROW(0xA002C098UL),
+  DROM_ROW(0xA002C0A8UL), DROM_ROW(0xA002C0A8UL), DROM_ROW(0xA002C0B8UL), DROM_ROW(0xA002C0B8UL),
+  DROM_ROW(0xA002C0C8UL), DROM_ROW(0xA002C0C8UL), DROM_ROW(0xA002C0D8UL), DROM_ROW(0xA002C0D8UL),
+  DROM_ROW(0xA001C0E8UL), DROM_ROW(0xA001C0E8UL), DROM_ROW(0xA002C0F8UL), DROM_ROW(0xA002C0F8UL),
+  DROM_ROW(0xA002D088UL), DROM_ROW(0xA002D088UL), DROM_ROW(0xA002D098UL), DROM_ROW(0xA002D098UL),
+  DROM_ROW(0xA002D0A8UL), DROM_ROW(0xA002D0A8UL), DROM_ROW(0xA002D0B8UL), DROM_ROW(0xA002D0B8UL),
+  DROM_ROW(0xA002D0C8UL), DROM_ROW(0xA002D0C8UL), DROM_ROW(0xA002D0D8UL), DROM_ROW(0xA002D0D8UL),
+  DROM_ROW(0xA001D0E8UL), DROM_ROW(0xA001D0E8UL), DROM_ROW(0xA002D0F8UL), DROM_ROW(0xA002D0F8UL),
+  DROM_ROW(0x8051808EUL), DROM_ROW(0x8051808EUL), DROM_ROW(0x8051909EUL), DROM_ROW(0x8051909EUL),
+  DROM_ROW(0x8051A0AEUL), DROM_ROW(0x8051A0AEUL), DROM_ROW(0x8051B0BEUL), DROM_ROW(0x8051B0BEUL),
+  DROM_ROW(0x8051C0CEUL), DROM_ROW(0x8051C0CEUL), DROM_ROW(0x8051D0DEUL), DROM_ROW(0x8051D0DEUL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x8051808FUL), DROM_ROW(0x8051808FUL), DROM_ROW(0x8051909FUL), DROM_ROW(0x8051909FUL),
+  DROM_ROW(0x8051A0AFUL), DROM_ROW(0x8051A0AFUL), DROM_ROW(0x8051B0BFUL), DROM_ROW(0x8051B0BFUL),
+  DROM_ROW(0x8051C0CFUL), DROM_ROW(0x8051C0CFUL), DROM_ROW(0x8051D0DFUL), DROM_ROW(0x8051D0DFUL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0xE0028088UL), DROM_ROW(0xE0028088UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL),
+  DROM_ROW(0xE00280A8UL), DROM_ROW(0xE00280A8UL), DROM_ROW(0xE00280B8UL), DROM_ROW(0xE00280B8UL),
+  DROM_ROW(0xE00280C8UL), DROM_ROW(0xE00280C8UL), DROM_ROW(0xE00280D8UL), DROM_ROW(0xE00280D8UL),
+  DROM_ROW(0xE00180E8UL), DROM_ROW(0x6000808EUL), DROM_ROW(0xE00280F8UL), DROM_ROW(0x8850880AUL),
+  DROM_ROW(0xE0029088UL), DROM_ROW(0xE0029088UL), DROM_ROW(0xE0029098UL), DROM_ROW(0xE0029098UL),
+  DROM_ROW(0xE00290A8UL), DROM_ROW(0xE00290A8UL), DROM_ROW(0xE00290B8UL), DROM_ROW(0xE00290B8UL),
+  DROM_ROW(0xE00290C8UL), DROM_ROW(0xE00290C8UL), DROM_ROW(0xE00290D8UL), DROM_ROW(0xE00290D8UL),
+  DROM_ROW(0xE00190E8UL), DROM_ROW(0x6000909EUL), DROM_ROW(0xE00290F8UL), DROM_ROW(0x8850990AUL),
+  DROM_ROW(0xE002A088UL), DROM_ROW(0xE002A088UL), DROM_ROW(0xE002A098UL), DROM_ROW(0xE002A098UL),
+  DROM_ROW(0xE002A0A8UL), DROM_ROW(0xE002A0A8UL), DROM_ROW(0xE002A0B8UL), DROM_ROW(0xE002A0B8UL),
+  DROM_ROW(0xE002A0C8UL), DROM_ROW(0xE002A0C8UL), DROM_ROW(0xE002A0D8UL), DROM_ROW(0xE002A0D8UL),
+  DROM_ROW(0xE001A0E8UL), DROM_ROW(0x6000A0AEUL), DROM_ROW(0xE002A0F8UL), DROM_ROW(0x8850AA0AUL),
+  DROM_ROW(0xE002B088UL), DROM_ROW(0xE002B088UL), DROM_ROW(0xE002B098UL), DROM_ROW(0xE002B098UL),
+  DROM_ROW(0xE002B0A8UL), DROM_ROW(0xE002B0A8UL), DROM_ROW(0xE002B0B8UL), DROM_ROW(0xE002B0B8UL),
+  DROM_ROW(0xE002B0C8UL), DROM_ROW(0xE002B0C8UL), DROM_ROW(0xE002B0D8UL), DROM_ROW(0xE002B0D8UL),
+  DROM_ROW(0xE001B0E8UL), DROM_ROW(0x6000B0BEUL), DROM_ROW(0xE002B0F8UL), DROM_ROW(0x8850BB0AUL),
+  DROM_ROW(0xE002C088UL), DROM_ROW(0xE002C088UL), DROM_ROW(0xE002C098UL), DROM_ROW(0xE002C098UL),
+  DROM_ROW(0xE002C0A8UL), DROM_ROW(0xE002C0A8UL), DROM_ROW(0xE002C0B8UL), DROM_ROW(0xE002C0B8UL),
+  DROM_ROW(0xE002C0C8UL), DROM_ROW(0xE002C0C8UL), DROM_ROW(0xE002C0D8UL), DROM_ROW(0xE002C0D8UL),
+  DROM_ROW(0xE001C0E8UL), DROM_ROW(0x6000C0CEUL), DROM_ROW(0xE002C0F8UL), DROM_ROW(0x8850CC0AUL),
+  DROM_ROW(0xE002D088UL), DROM_ROW(0xE002D088UL), DROM_ROW(0xE002D098UL), DROM_ROW(0xE002D098UL),
+  DROM_ROW(0xE002D0A8UL), DROM_ROW(0xE002D0A8UL), DROM_ROW(0xE002D0B8UL), DROM_ROW(0xE002D0B8UL),
+  DROM_ROW(0xE002D0C8UL), DROM_ROW(0xE002D0C8UL), DROM_ROW(0xE002D0D8UL), DROM_ROW(0xE002D0D8UL),
+  DROM_ROW(0xE001D0E8UL), DROM_ROW(0x6000D0DEUL), DROM_ROW(0xE002D0F8UL), DROM_ROW(0x8850DD0AUL),
+  DROM_ROW(0xE002E088UL), DROM_ROW(0xE002E088UL), DROM_ROW(0xE002E098UL), DROM_ROW(0xE002E098UL),
+  DROM_ROW(0xE002E0A8UL), DROM_ROW(0xE002E0A8UL), DROM_ROW(0xE002E0B8UL), DROM_ROW(0xE002E0B8UL),
+  DROM_ROW(0xE002E0C8UL), DROM_ROW(0xE002E0C8UL), DROM_ROW(0xE002E0D8UL), DROM_ROW(0xE002E0D8UL),
+  DROM_ROW(0xE001E0E8UL), DROM_ROW(0xE001E0E8UL), DROM_ROW(0xE002E0F8UL), DROM_ROW(0xE002E0F8UL),
+  DROM_ROW(0xE002F088UL), DROM_ROW(0xE002F088UL), DROM_ROW(0xE002F098UL), DROM_ROW(0xE002F098UL),
+  DROM_ROW(0xE002F0A8UL), DROM_ROW(0xE002F0A8UL), DROM_ROW(0xE002F0B8UL), DROM_ROW(0xE002F0B8UL),
+  DROM_ROW(0xE002F0C8UL), DROM_ROW(0xE002F0C8UL), DROM_ROW(0xE002F0D8UL), DROM_ROW(0xE002F0D8UL),
+  DROM_ROW(0xE001F0E8UL), DROM_ROW(0xE001F0E8UL), DROM_ROW(0xE002F0F8UL), DROM_ROW(0xE002F0F8UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL),
+  DROM_ROW(0x900A00A8UL), DROM_ROW(0x900A00A8UL), DROM_ROW(0x900A00B8UL), DROM_ROW(0x900A00B8UL),
+  DROM_ROW(0x900A00C8UL), DROM_ROW(0x900A00C8UL), DROM_ROW(0x900A00D8UL), DROM_ROW(0x900A00D8UL),
+  DROM_ROW(0x900900E8UL), DROM_ROW(0x900900E8UL), DROM_ROW(0x900A00F8UL), DROM_ROW(0x900A00F8UL),
+  DROM_ROW(0x900A0188UL), DROM_ROW(0x900A0188UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x900A01A8UL), DROM_ROW(0x900A01A8UL), DROM_ROW(0x900A01B8UL), DROM_ROW(0x900A01B8UL),
+  DROM_ROW(0x900A01C8UL), DROM_ROW(0x900A01C8UL), DROM_ROW(0x900A01D8UL), DROM_ROW(0x900A01D8UL),
+  DROM_ROW(0x900901E8UL), DROM_ROW(0x900901E8UL), DROM_ROW(0x900A01F8UL), DROM_ROW(0x900A01F8UL),
+  DROM_ROW(0x900A0288UL), DROM_ROW(0x900A0288UL), DROM_ROW(0x900A0298UL), DROM_ROW(0x900A0298UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x900A02B8UL), DROM_ROW(0x900A02B8UL),
+  DROM_ROW(0x900A02C8UL), DROM_ROW(0x900A02C8UL), DROM_ROW(0x900A02D8UL), DROM_ROW(0x900A02D8UL),
+  DROM_ROW(0x900902E8UL), DROM_ROW(0x900902E8UL), DROM_ROW(0x900A02F8UL), DROM_ROW(0x900A02F8UL),
+  DROM_ROW(0x900A0388UL), DROM_ROW(0x900A0388UL), DROM_ROW(0x900A0398UL), DROM_ROW(0x900A0398UL),
+  DROM_ROW(0x900A03A8UL), DROM_ROW(0x900A03A8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x900A03C8UL), DROM_ROW(0x900A03C8UL), DROM_ROW(0x900A03D8UL), DROM_ROW(0x900A03D8UL),
+  DROM_ROW(0x900903E8UL), DROM_ROW(0x900903E8UL), DROM_ROW(0x900A03F8UL), DROM_ROW(0x900A03F8UL),
+  DROM_ROW(0x900A0488UL), DROM_ROW(0x900A0488UL), DROM_ROW(0x900A0498UL), DROM_ROW(0x900A0498UL),
+  DROM_ROW(0x900A04A8UL), DROM_ROW(0x900A04A8UL), DROM_ROW(0x900A04B8UL), DROM_ROW(0x900A04B8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x900A04D8UL), DROM_ROW(0x900A04D8UL),
+  DROM_ROW(0x900904E8UL), DROM_ROW(0x900904E8UL), DROM_ROW(0x900A04F8UL), DROM_ROW(0x900A04F8UL),
+  DROM_ROW(0x900A0588UL), DROM_ROW(0x900A0588UL), DROM_ROW(0x900A0598UL), DROM_ROW(0x900A0598UL),
+  DROM_ROW(0x900A05A8UL), DROM_ROW(0x900A05A8UL), DROM_ROW(0x900A05B8UL), DROM_ROW(0x900A05B8UL),
+  DROM_ROW(0x900A05C8UL), DROM_ROW(0x900A05C8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x500F02E8UL),
+  DROM_ROW(0x900905E8UL), DROM_ROW(0x900905E8UL), DROM_ROW(0x900A05F8UL), DROM_ROW(0x900A05F8UL),
+  DROM_ROW(0x80518087UL), DROM_ROW(0x80518087UL), DROM_ROW(0x80519097UL), DROM_ROW(0x80519097UL),
+  DROM_ROW(0x8051A0A7UL), DROM_ROW(0x8051A0A7UL), DROM_ROW(0x8051B0B7UL), DROM_ROW(0x8051B0B7UL),
+  DROM_ROW(0x8051C0C7UL), DROM_ROW(0x8051C0C7UL), DROM_ROW(0x8051D0D7UL), DROM_ROW(0x8051D0D7UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x500F00E8UL),
+  DROM_ROW(0x80420089UL), DROM_ROW(0x80420089UL), DROM_ROW(0x80421099UL), DROM_ROW(0x80421099UL),
+  DROM_ROW(0x804220A9UL), DROM_ROW(0x804220A9UL), DROM_ROW(0x804230B9UL), DROM_ROW(0x804230B9UL),
+  DROM_ROW(0x804240C9UL), DROM_ROW(0x804240C9UL), DROM_ROW(0x804250D9UL), DROM_ROW(0x804250D9UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL),
+  DROM_ROW(0xD00A00A8UL), DROM_ROW(0xD00A00A8UL), DROM_ROW(0xD00A00B8UL), DROM_ROW(0xD00A00B8UL),
+  DROM_ROW(0xD00A00C8UL), DROM_ROW(0xD00A00C8UL), DROM_ROW(0xD00A00D8UL), DROM_ROW(0xD00A00D8UL),
+  DROM_ROW(0xD00900E8UL), DROM_ROW(0x6000808EUL), DROM_ROW(0xD00A00F8UL), DROM_ROW(0x6000808EUL),
+  DROM_ROW(0xD00A0188UL), DROM_ROW(0xD00A0188UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0xD00A01A8UL), DROM_ROW(0xD00A01A8UL), DROM_ROW(0xD00A01B8UL), DROM_ROW(0xD00A01B8UL),
+  DROM_ROW(0xD00A01C8UL), DROM_ROW(0xD00A01C8UL), DROM_ROW(0xD00A01D8UL), DROM_ROW(0xD00A01D8UL),
+  DROM_ROW(0xD00901E8UL), DROM_ROW(0x6000909EUL), DROM_ROW(0xD00A01F8UL), DROM_ROW(0x6000909EUL),
+  DROM_ROW(0xD00A0288UL), DROM_ROW(0xD00A0288UL), DROM_ROW(0xD00A0298UL), DROM_ROW(0xD00A0298UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0xD00A02B8UL), DROM_ROW(0xD00A02B8UL),
+  DROM_ROW(0xD00A02C8UL), DROM_ROW(0xD00A02C8UL), DROM_ROW(0xD00A02D8UL), DROM_ROW(0xD00A02D8UL),
+  DROM_ROW(0xD00902E8UL), DROM_ROW(0x6000A0AEUL), DROM_ROW(0xD00A02F8UL), DROM_ROW(0x6000A0AEUL),
+  DROM_ROW(0xD00A0388UL), DROM_ROW(0xD00A0388UL), DROM_ROW(0xD00A0398UL), DROM_ROW(0xD00A0398UL),
+  DROM_ROW(0xD00A03A8UL), DROM_ROW(0xD00A03A8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0xD00A03C8UL), DROM_ROW(0xD00A03C8UL), DROM_ROW(0xD00A03D8UL), DROM_ROW(0xD00A03D8UL),
+  DROM_ROW(0xD00903E8UL), DROM_ROW(0x6000B0BEUL), DROM_ROW(0xD00A03F8UL), DROM_ROW(0x6000B0BEUL),
+  DROM_ROW(0xD00A0488UL), DROM_ROW(0xD00A0488UL), DROM_ROW(0xD00A0498UL), DROM_ROW(0xD00A0498UL),
+  DROM_ROW(0xD00A04A8UL), DROM_ROW(0xD00A04A8UL), DROM_ROW(0xD00A04B8UL), DROM_ROW(0xD00A04B8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0xD00A04D8UL), DROM_ROW(0xD00A04D8UL),
+  DROM_ROW(0xD00904E8UL), DROM_ROW(0x6000C0CEUL), DROM_ROW(0xD00A04F8UL), DROM_ROW(0x6000C0CEUL),
+  DROM_ROW(0xD00A0588UL), DROM_ROW(0xD00A0588UL), DROM_ROW(0xD00A0598UL), DROM_ROW(0xD00A0598UL),
+  DROM_ROW(0xD00A05A8UL), DROM_ROW(0xD00A05A8UL), DROM_ROW(0xD00A05B8UL), DROM_ROW(0xD00A05B8UL),
+  DROM_ROW(0xD00A05C8UL), DROM_ROW(0xD00A05C8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x500F03E8UL),
+  DROM_ROW(0xD00905E8UL), DROM_ROW(0x6000D0DEUL), DROM_ROW(0xD00A05F8UL), DROM_ROW(0x6000D0DEUL),
+  DROM_ROW(0xD00A0688UL), DROM_ROW(0xD00A0688UL), DROM_ROW(0xD00A0698UL), DROM_ROW(0xD00A0698UL),
+  DROM_ROW(0xD00A06A8UL), DROM_ROW(0xD00A06A8UL), DROM_ROW(0xD00A06B8UL), DROM_ROW(0xD00A06B8UL),
+  DROM_ROW(0xD00A06C8UL), DROM_ROW(0xD00A06C8UL), DROM_ROW(0xD00A06D8UL), DROM_ROW(0xD00A06D8UL),
+  DROM_ROW(0xD00906E8UL), DROM_ROW(0xD00906E8UL), DROM_ROW(0xD00A06F8UL), DROM_ROW(0xD00A06F8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x500F04E8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x80528088UL), DROM_ROW(0x80528088UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL),
+  DROM_ROW(0x805280A8UL), DROM_ROW(0x805280A8UL), DROM_ROW(0x805280B8UL), DROM_ROW(0x805280B8UL),
+  DROM_ROW(0x805280C8UL), DROM_ROW(0x805280C8UL), DROM_ROW(0x805280D8UL), DROM_ROW(0x805280D8UL),
+  DROM_ROW(0x805280E8UL), DROM_ROW(0x805280E8UL), DROM_ROW(0x805280F8UL), DROM_ROW(0x805280F8UL),
+  DROM_ROW(0x80529088UL), DROM_ROW(0x80529088UL), DROM_ROW(0x80529098UL), DROM_ROW(0x80529098UL),
+  DROM_ROW(0x805290A8UL), DROM_ROW(0x805290A8UL), DROM_ROW(0x805290B8UL), DROM_ROW(0x805290B8UL),
+  DROM_ROW(0x805290C8UL), DROM_ROW(0x805290C8UL), DROM_ROW(0x805290D8UL), DROM_ROW(0x805290D8UL),
+  DROM_ROW(0x805290E8UL), DROM_ROW(0x805290E8UL), DROM_ROW(0x805290F8UL), DROM_ROW(0x805290F8UL),
+  DROM_ROW(0x8052A088UL), DROM_ROW(0x8052A088UL), DROM_ROW(0x8052A098UL), DROM_ROW(0x8052A098UL),
+  DROM_ROW(0x8052A0A8UL), DROM_ROW(0x8052A0A8UL), DROM_ROW(0x8052A0B8UL), DROM_ROW(0x8052A0B8UL),
+  DROM_ROW(0x8052A0C8UL), DROM_ROW(0x8052A0C8UL), DROM_ROW(0x8052A0D8UL), DROM_ROW(0x8052A0D8UL),
+  DROM_ROW(0x8052A0E8UL), DROM_ROW(0x8052A0E8UL), DROM_ROW(0x8052A0F8UL), DROM_ROW(0x8052A0F8UL),
+  DROM_ROW(0x8052B088UL), DROM_ROW(0x8052B088UL), DROM_ROW(0x8052B098UL), DROM_ROW(0x8052B098UL),
+  DROM_ROW(0x8052B0A8UL), DROM_ROW(0x8052B0A8UL), DROM_ROW(0x8052B0B8UL), DROM_ROW(0x8052B0B8UL),
+  DROM_ROW(0x8052B0C8UL), DROM_ROW(0x8052B0C8UL), DROM_ROW(0x8052B0D8UL), DROM_ROW(0x8052B0D8UL),
+  DROM_ROW(0x8052B0E8UL), DROM_ROW(0x8052B0E8UL), DROM_ROW(0x8052B0F8UL), DROM_ROW(0x8052B0F8UL),
+  DROM_ROW(0x8052C088UL), DROM_ROW(0x8052C088UL), DROM_ROW(0x8052C098UL), DROM_ROW(0x8052C098UL),
+  DROM_ROW(0x8052C0A8UL), DROM_ROW(0x8052C0A8UL), DROM_ROW(0x8052C0B8UL), DROM_ROW(0x8052C0B8UL),
+  DROM_ROW(0x8052C0C8UL), DROM_ROW(0x8052C0C8UL), DROM_ROW(0x8052C0D8UL), DROM_ROW(0x8052C0D8UL),
+  DROM_ROW(0x8052C0E8UL), DROM_ROW(0x8052C0E8UL), DROM_ROW(0x8052C0F8UL), DROM_ROW(0x8052C0F8UL),
+  DROM_ROW(0x8052D088UL), DROM_ROW(0x8052D088UL), DROM_ROW(0x8052D098UL), DROM_ROW(0x8052D098UL),
+  DROM_ROW(0x8052D0A8UL), DROM_ROW(0x8052D0A8UL), DROM_ROW(0x8052D0B8UL), DROM_ROW(0x8052D0B8UL),
+  DROM_ROW(0x8052D0C8UL), DROM_ROW(0x8052D0C8UL), DROM_ROW(0x8052D0D8UL), DROM_ROW(0x8052D0D8UL),
+  DROM_ROW(0x8052D0E8UL), DROM_ROW(0x8052D0E8UL), DROM_ROW(0x8052D0F8UL), DROM_ROW(0x8052D0F8UL),
+  DROM_ROW(0x8012E088UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8012E098UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8012E0A8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8012E0B8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8012E0C8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8012E0D8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8012E0E8UL), DROM_ROW(0x509700F8UL), DROM_ROW(0x58920008UL), DROM_ROW(0x58920008UL),
+  DROM_ROW(0x8012F088UL), DROM_ROW(0x000AD788UL), DROM_ROW(0x8012F098UL), DROM_ROW(0x000AD798UL),
+  DROM_ROW(0x8012F0A8UL), DROM_ROW(0x000AD7A8UL), DROM_ROW(0x8012F0B8UL), DROM_ROW(0x000AD7B8UL),
+  DROM_ROW(0x8012F0C8UL), DROM_ROW(0x000AD7C8UL), DROM_ROW(0x8012F0D8UL), DROM_ROW(0x000AD7D8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x88158008UL), DROM_ROW(0x88158008UL), DROM_ROW(0x88158008UL), DROM_ROW(0x88158008UL),
+  DROM_ROW(0x88158008UL), DROM_ROW(0x88158008UL), DROM_ROW(0x88158008UL), DROM_ROW(0x88158008UL),
+  DROM_ROW(0x80548088UL), DROM_ROW(0x80548088UL), DROM_ROW(0x80548088UL), DROM_ROW(0x80548088UL),
+  DROM_ROW(0x80548088UL), DROM_ROW(0x80548088UL), DROM_ROW(0x80548088UL), DROM_ROW(0x80548088UL),
+  DROM_ROW(0x88159008UL), DROM_ROW(0x88159008UL), DROM_ROW(0x88159008UL), DROM_ROW(0x88159008UL),
+  DROM_ROW(0x88159008UL), DROM_ROW(0x88159008UL), DROM_ROW(0x88159008UL), DROM_ROW(0x88159008UL),
+  DROM_ROW(0x80549098UL), DROM_ROW(0x80549098UL), DROM_ROW(0x80549098UL), DROM_ROW(0x80549098UL),
+  DROM_ROW(0x80549098UL), DROM_ROW(0x80549098UL), DROM_ROW(0x80549098UL), DROM_ROW(0x80549098UL),
+  DROM_ROW(0x8815A008UL), DROM_ROW(0x8815A008UL), DROM_ROW(0x8815A008UL), DROM_ROW(0x8815A008UL),
+  DROM_ROW(0x8815A008UL), DROM_ROW(0x8815A008UL), DROM_ROW(0x8815A008UL), DROM_ROW(0x8815A008UL),
+  DROM_ROW(0x8054A0A8UL), DROM_ROW(0x8054A0A8UL), DROM_ROW(0x8054A0A8UL), DROM_ROW(0x8054A0A8UL),
+  DROM_ROW(0x8054A0A8UL), DROM_ROW(0x8054A0A8UL), DROM_ROW(0x8054A0A8UL), DROM_ROW(0x8054A0A8UL),
+  DROM_ROW(0x8815B008UL), DROM_ROW(0x8815B008UL), DROM_ROW(0x8815B008UL), DROM_ROW(0x8815B008UL),
+  DROM_ROW(0x8815B008UL), DROM_ROW(0x8815B008UL), DROM_ROW(0x8815B008UL), DROM_ROW(0x8815B008UL),
+  DROM_ROW(0x8054B0B8UL), DROM_ROW(0x8054B0B8UL), DROM_ROW(0x8054B0B8UL), DROM_ROW(0x8054B0B8UL),
+  DROM_ROW(0x8054B0B8UL), DROM_ROW(0x8054B0B8UL), DROM_ROW(0x8054B0B8UL), DROM_ROW(0x8054B0B8UL),
+  DROM_ROW(0x8815C008UL), DROM_ROW(0x8815C008UL), DROM_ROW(0x8815C008UL), DROM_ROW(0x8815C008UL),
+  DROM_ROW(0x8815C008UL), DROM_ROW(0x8815C008UL), DROM_ROW(0x8815C008UL), DROM_ROW(0x8815C008UL),
+  DROM_ROW(0x8054C0C8UL), DROM_ROW(0x8054C0C8UL), DROM_ROW(0x8054C0C8UL), DROM_ROW(0x8054C0C8UL),
+  DROM_ROW(0x8054C0C8UL), DROM_ROW(0x8054C0C8UL), DROM_ROW(0x8054C0C8UL), DROM_ROW(0x8054C0C8UL),
+  DROM_ROW(0x8815D008UL), DROM_ROW(0x8815D008UL), DROM_ROW(0x8815D008UL), DROM_ROW(0x8815D008UL),
+  DROM_ROW(0x8815D008UL), DROM_ROW(0x8815D008UL), DROM_ROW(0x8815D008UL), DROM_ROW(0x8815D008UL),
+  DROM_ROW(0x8054D0D8UL), DROM_ROW(0x8054D0D8UL), DROM_ROW(0x8054D0D8UL), DROM_ROW(0x8054D0D8UL),
+  DROM_ROW(0x8054D0D8UL), DROM_ROW(0x8054D0D8UL), DROM_ROW(0x8054D0D8UL), DROM_ROW(0x8054D0D8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8015F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8015F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8015F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8015F0F8UL),
+  DROM_ROW(0x8014E0E8UL), DROM_ROW(0x8014E0E8UL), DROM_ROW(0x8014E0E8UL), DROM_ROW(0x8014E0E8UL),
+  DROM_ROW(0x8014E0E8UL), DROM_ROW(0x8014E0E8UL), DROM_ROW(0x8014E0E8UL), DROM_ROW(0x8014E0E8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x500F05E8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x500F01E8UL),
+  DROM_ROW(0x600180E8UL), DROM_ROW(0x6000D0EEUL), DROM_ROW(0x600180E8UL), DROM_ROW(0x500805EEUL),
+  DROM_ROW(0x600180E8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x600180E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x801480F8UL), DROM_ROW(0x801480F8UL), DROM_ROW(0x801480F8UL), DROM_ROW(0x801480F8UL),
+  DROM_ROW(0x801480F8UL), DROM_ROW(0x801480F8UL), DROM_ROW(0x801480F8UL), DROM_ROW(0x801480F8UL),
+  DROM_ROW(0x600190E8UL), DROM_ROW(0x6000D0EEUL), DROM_ROW(0x600190E8UL), DROM_ROW(0x500805EEUL),
+  DROM_ROW(0x600190E8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x600190E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x801490F8UL), DROM_ROW(0x801490F8UL), DROM_ROW(0x801490F8UL), DROM_ROW(0x801490F8UL),
+  DROM_ROW(0x801490F8UL), DROM_ROW(0x801490F8UL), DROM_ROW(0x801490F8UL), DROM_ROW(0x801490F8UL),
+  DROM_ROW(0x6001A0E8UL), DROM_ROW(0x6000D0EEUL), DROM_ROW(0x6001A0E8UL), DROM_ROW(0x500805EEUL),
+  DROM_ROW(0x6001A0E8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x6001A0E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8014A0F8UL), DROM_ROW(0x8014A0F8UL), DROM_ROW(0x8014A0F8UL), DROM_ROW(0x8014A0F8UL),
+  DROM_ROW(0x8014A0F8UL), DROM_ROW(0x8014A0F8UL), DROM_ROW(0x8014A0F8UL), DROM_ROW(0x8014A0F8UL),
+  DROM_ROW(0x6001B0E8UL), DROM_ROW(0x6000D0EEUL), DROM_ROW(0x6001B0E8UL), DROM_ROW(0x500805EEUL),
+  DROM_ROW(0x6001B0E8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x6001B0E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8014B0F8UL), DROM_ROW(0x8014B0F8UL), DROM_ROW(0x8014B0F8UL), DROM_ROW(0x8014B0F8UL),
+  DROM_ROW(0x8014B0F8UL), DROM_ROW(0x8014B0F8UL), DROM_ROW(0x8014B0F8UL), DROM_ROW(0x8014B0F8UL),
+  DROM_ROW(0x6001C0E8UL), DROM_ROW(0x6000D0EEUL), DROM_ROW(0x6001C0E8UL), DROM_ROW(0x500805EEUL),
+  DROM_ROW(0x6001C0E8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x6001C0E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8014C0F8UL), DROM_ROW(0x8014C0F8UL), DROM_ROW(0x8014C0F8UL), DROM_ROW(0x8014C0F8UL),
+  DROM_ROW(0x8014C0F8UL), DROM_ROW(0x8014C0F8UL), DROM_ROW(0x8014C0F8UL), DROM_ROW(0x8014C0F8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x0011E0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8014D0F8UL), DROM_ROW(0x8014D0F8UL), DROM_ROW(0x8014D0F8UL), DROM_ROW(0x8014D0F8UL),
+  DROM_ROW(0x8014D0F8UL), DROM_ROW(0x8014D0F8UL), DROM_ROW(0x8014D0F8UL), DROM_ROW(0x8014D0F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x00010081UL), DROM_ROW(0x00010081UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x000100A1UL), DROM_ROW(0x000100A1UL), DROM_ROW(0x000100B1UL), DROM_ROW(0x000100B1UL),
+  DROM_ROW(0x000100C1UL), DROM_ROW(0x000100C1UL), DROM_ROW(0x000100D1UL), DROM_ROW(0x000100D1UL),
+  DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL),
+  DROM_ROW(0xA0008888UL), DROM_ROW(0x88108808UL), DROM_ROW(0xA0008998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xA0008AA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xA0008BB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xA0008CC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xA0008DD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x80508880UL), DROM_ROW(0x80508881UL), DROM_ROW(0x80508884UL), DROM_ROW(0x80508887UL),
+  DROM_ROW(0xE0008888UL), DROM_ROW(0x8208008EUL), DROM_ROW(0xE0008998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xE0008AA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xE0008BB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xE0008CC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xE0008DD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x80508882UL), DROM_ROW(0x80508883UL), DROM_ROW(0x8050888EUL), DROM_ROW(0x8050888FUL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x00010081UL), DROM_ROW(0x00010081UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x000100A1UL), DROM_ROW(0x000100A1UL), DROM_ROW(0x000100B1UL), DROM_ROW(0x000100B1UL),
+  DROM_ROW(0x000100C1UL), DROM_ROW(0x000100C1UL), DROM_ROW(0x000100D1UL), DROM_ROW(0x000100D1UL),
+  DROM_ROW(0x80519094UL), DROM_ROW(0x80519094UL), DROM_ROW(0x80519093UL), DROM_ROW(0x80519093UL),
+  DROM_ROW(0xA0009888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xA0009998UL), DROM_ROW(0x88109908UL),
+  DROM_ROW(0xA0009AA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xA0009BB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xA0009CC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xA0009DD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x80509990UL), DROM_ROW(0x80509991UL), DROM_ROW(0x80509994UL), DROM_ROW(0x80509997UL),
+  DROM_ROW(0xE0009888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xE0009998UL), DROM_ROW(0x8208019EUL),
+  DROM_ROW(0xE0009AA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xE0009BB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xE0009CC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xE0009DD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x80509992UL), DROM_ROW(0x80509993UL), DROM_ROW(0x8050999EUL), DROM_ROW(0x8050999FUL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x00010081UL), DROM_ROW(0x00010081UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x000100A1UL), DROM_ROW(0x000100A1UL), DROM_ROW(0x000100B1UL), DROM_ROW(0x000100B1UL),
+  DROM_ROW(0x000100C1UL), DROM_ROW(0x000100C1UL), DROM_ROW(0x000100D1UL), DROM_ROW(0x000100D1UL),
+  DROM_ROW(0x8051A0A4UL), DROM_ROW(0x8051A0A4UL), DROM_ROW(0x8051A0A3UL), DROM_ROW(0x8051A0A3UL),
+  DROM_ROW(0xA000A888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xA000A998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xA000AAA8UL), DROM_ROW(0x8810AA08UL), DROM_ROW(0xA000ABB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xA000ACC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xA000ADD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8050AAA0UL), DROM_ROW(0x8050AAA1UL), DROM_ROW(0x8050AAA4UL), DROM_ROW(0x8050AAA7UL),
+  DROM_ROW(0xE000A888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xE000A998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xE000AAA8UL), DROM_ROW(0x820802AEUL), DROM_ROW(0xE000ABB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xE000ACC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xE000ADD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8050AAA2UL), DROM_ROW(0x8050AAA3UL), DROM_ROW(0x8050AAAEUL), DROM_ROW(0x8050AAAFUL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL), DROM_ROW(0x6002D0C8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x00010081UL), DROM_ROW(0x00010081UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x000100A1UL), DROM_ROW(0x000100A1UL), DROM_ROW(0x000100B1UL), DROM_ROW(0x000100B1UL),
+  DROM_ROW(0x000100C1UL), DROM_ROW(0x000100C1UL), DROM_ROW(0x000100D1UL), DROM_ROW(0x000100D1UL),
+  DROM_ROW(0x8051B0B4UL), DROM_ROW(0x8051B0B4UL), DROM_ROW(0x8051B0B3UL), DROM_ROW(0x8051B0B3UL),
+  DROM_ROW(0xA000B888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xA000B998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xA000BAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xA000BBB8UL), DROM_ROW(0x8810BB08UL),
+  DROM_ROW(0xA000BCC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xA000BDD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8050BBB0UL), DROM_ROW(0x8050BBB1UL), DROM_ROW(0x8050BBB4UL), DROM_ROW(0x8050BBB7UL),
+  DROM_ROW(0xE000B888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xE000B998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xE000BAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xE000BBB8UL), DROM_ROW(0x820803BEUL),
+  DROM_ROW(0xE000BCC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xE000BDD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8050BBB2UL), DROM_ROW(0x8050BBB3UL), DROM_ROW(0x8050BBBEUL), DROM_ROW(0x8050BBBFUL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x00010081UL), DROM_ROW(0x00010081UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x000100A1UL), DROM_ROW(0x000100A1UL), DROM_ROW(0x000100B1UL), DROM_ROW(0x000100B1UL),
+  DROM_ROW(0x000100C1UL), DROM_ROW(0x000100C1UL), DROM_ROW(0x000100D1UL), DROM_ROW(0x000100D1UL),
+  DROM_ROW(0x8051C0C4UL), DROM_ROW(0x8051C0C4UL), DROM_ROW(0x8051C0C3UL), DROM_ROW(0x8051C0C3UL),
+  DROM_ROW(0xA000C888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xA000C998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xA000CAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xA000CBB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xA000CCC8UL), DROM_ROW(0x8810CC08UL), DROM_ROW(0xA000CDD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8050CCC0UL), DROM_ROW(0x8050CCC1UL), DROM_ROW(0x8050CCC4UL), DROM_ROW(0x8050CCC7UL),
+  DROM_ROW(0xE000C888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xE000C998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xE000CAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xE000CBB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xE000CCC8UL), DROM_ROW(0x820804CEUL), DROM_ROW(0xE000CDD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8050CCC2UL), DROM_ROW(0x8050CCC3UL), DROM_ROW(0x8050CCCEUL), DROM_ROW(0x8050CCCFUL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL), DROM_ROW(0x6002D088UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL), DROM_ROW(0x6002D098UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x00010081UL), DROM_ROW(0x00010081UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x000100A1UL), DROM_ROW(0x000100A1UL), DROM_ROW(0x000100B1UL), DROM_ROW(0x000100B1UL),
+  DROM_ROW(0x000100C1UL), DROM_ROW(0x000100C1UL), DROM_ROW(0x000100D1UL), DROM_ROW(0x000100D1UL),
+  DROM_ROW(0x8051D0D4UL), DROM_ROW(0x8051D0D4UL), DROM_ROW(0x8051D0D3UL), DROM_ROW(0x8051D0D3UL),
+  DROM_ROW(0xA000D888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xA000D998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xA000DAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xA000DBB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xA000DCC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xA000DDD8UL), DROM_ROW(0x8810DD08UL),
+  DROM_ROW(0x8050DDD0UL), DROM_ROW(0x8050DDD1UL), DROM_ROW(0x8050DDD4UL), DROM_ROW(0x8050DDD7UL),
+  DROM_ROW(0xE000D888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xE000D998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xE000DAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xE000DBB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xE000DCC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xE000DDD8UL), DROM_ROW(0x820805DEUL),
+  DROM_ROW(0x8050DDD2UL), DROM_ROW(0x8050DDD3UL), DROM_ROW(0x8050DDDEUL), DROM_ROW(0x8050DDDFUL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8600809EUL), DROM_ROW(0x860080AEUL), DROM_ROW(0x860080BEUL), DROM_ROW(0x860080CEUL),
+  DROM_ROW(0x860080DEUL), DROM_ROW(0x8600908EUL), DROM_ROW(0x860090AEUL), DROM_ROW(0x860090BEUL),
+  DROM_ROW(0x860090CEUL), DROM_ROW(0x860090DEUL), DROM_ROW(0x8600A08EUL), DROM_ROW(0x8600A09EUL),
+  DROM_ROW(0x8600A0BEUL), DROM_ROW(0x8600A0CEUL), DROM_ROW(0x8600A0DEUL), DROM_ROW(0x8600B08EUL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL), DROM_ROW(0x6002D0A8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL), DROM_ROW(0x6002D0B8UL),
+  DROM_ROW(0x8010888CUL), DROM_ROW(0x8010888DUL), DROM_ROW(0x8010999CUL), DROM_ROW(0x8010999DUL),
+  DROM_ROW(0x8010AAACUL), DROM_ROW(0x8010AAADUL), DROM_ROW(0x8010BBBCUL), DROM_ROW(0x8010BBBDUL),
+  DROM_ROW(0x8010CCCCUL), DROM_ROW(0x8010CCCDUL), DROM_ROW(0x8010DDDCUL), DROM_ROW(0x8010DDDDUL),
+  DROM_ROW(0x0017E0E9UL), DROM_ROW(0x0017E0E9UL), DROM_ROW(0x0017E0E9UL), DROM_ROW(0x0017E0E9UL),
+  DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80519090UL), DROM_ROW(0x80519090UL),
+  DROM_ROW(0x8051A0A0UL), DROM_ROW(0x8051A0A0UL), DROM_ROW(0x8051B0B0UL), DROM_ROW(0x8051B0B0UL),
+  DROM_ROW(0x8051C0C0UL), DROM_ROW(0x8051C0C0UL), DROM_ROW(0x8051D0D0UL), DROM_ROW(0x8051D0D0UL),
+  DROM_ROW(0x81000008UL), DROM_ROW(0x85000008UL), DROM_ROW(0xE180F008UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8050888AUL), DROM_ROW(0x8050888BUL), DROM_ROW(0x8050999AUL), DROM_ROW(0x8050999BUL),
+  DROM_ROW(0x8050AAAAUL), DROM_ROW(0x8050AAABUL), DROM_ROW(0x8050BBBAUL), DROM_ROW(0x8050BBBBUL),
+  DROM_ROW(0x8050CCCAUL), DROM_ROW(0x8050CCCBUL), DROM_ROW(0x8050DDDAUL), DROM_ROW(0x8050DDDBUL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0xE000E888UL), DROM_ROW(0x00000888UL), DROM_ROW(0xE000E998UL), DROM_ROW(0x00000998UL),
+  DROM_ROW(0xE000EAA8UL), DROM_ROW(0x00000AA8UL), DROM_ROW(0xE000EBB8UL), DROM_ROW(0x00000BB8UL),
+  DROM_ROW(0xE000ECC8UL), DROM_ROW(0x00000CC8UL), DROM_ROW(0xE000EDD8UL), DROM_ROW(0x00000DD8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8600B09EUL), DROM_ROW(0x8600B0AEUL), DROM_ROW(0x8600B0CEUL), DROM_ROW(0x8600B0DEUL),
+  DROM_ROW(0x8600C08EUL), DROM_ROW(0x8600C09EUL), DROM_ROW(0x8600C0AEUL), DROM_ROW(0x8600C0BEUL),
+  DROM_ROW(0x8600C0DEUL), DROM_ROW(0x8600D08EUL), DROM_ROW(0x8600D09EUL), DROM_ROW(0x8600D0AEUL),
+  DROM_ROW(0x8600D0BEUL), DROM_ROW(0x8600D0CEUL), DROM_ROW(0x804000F9UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL), DROM_ROW(0x6002D0D8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL), DROM_ROW(0x6001D0E8UL),
+  DROM_ROW(0x80108087UL), DROM_ROW(0x88508809UL), DROM_ROW(0x80109197UL), DROM_ROW(0x88509919UL),
+  DROM_ROW(0x8010A2A7UL), DROM_ROW(0x8850AA29UL), DROM_ROW(0x8010B3B7UL), DROM_ROW(0x8850BB39UL),
+  DROM_ROW(0x8010C4C7UL), DROM_ROW(0x8850CC49UL), DROM_ROW(0x8010D5D7UL), DROM_ROW(0x8850DD59UL),
+  DROM_ROW(0x0017E0E9UL), DROM_ROW(0x0017E0E9UL), DROM_ROW(0x845020AEUL), DROM_ROW(0x8020A0AEUL),
+  DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80519091UL), DROM_ROW(0x80519091UL),
+  DROM_ROW(0x8051A0A1UL), DROM_ROW(0x8051A0A1UL), DROM_ROW(0x8051B0B1UL), DROM_ROW(0x8051B0B1UL),
+  DROM_ROW(0x8051C0C1UL), DROM_ROW(0x8051C0C1UL), DROM_ROW(0x8051D0D1UL), DROM_ROW(0x8051D0D1UL),
+  DROM_ROW(0x0050AAA8UL), DROM_ROW(0x8850AAC8UL), DROM_ROW(0x0850AAC8UL), DROM_ROW(0x0050BCB9UL),
+  DROM_ROW(0x80508888UL), DROM_ROW(0x80508889UL), DROM_ROW(0x80509998UL), DROM_ROW(0x80509999UL),
+  DROM_ROW(0x8050AAA8UL), DROM_ROW(0x8050AAA9UL), DROM_ROW(0x8050BBB8UL), DROM_ROW(0x8050BBB9UL),
+  DROM_ROW(0x8050CCC8UL), DROM_ROW(0x8050CCC9UL), DROM_ROW(0x8050DDD8UL), DROM_ROW(0x8050DDD9UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0xE000F888UL), DROM_ROW(0x80400889UL), DROM_ROW(0xE000F998UL), DROM_ROW(0x80400999UL),
+  DROM_ROW(0xE000FAA8UL), DROM_ROW(0x80400AA9UL), DROM_ROW(0xE000FBB8UL), DROM_ROW(0x80400BB9UL),
+  DROM_ROW(0xE000FCC8UL), DROM_ROW(0x80400CC9UL), DROM_ROW(0xE000FDD8UL), DROM_ROW(0x80400DD9UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  // execute2
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D20088UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D20098UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D200A8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D200B8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D200C8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D200D8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80508D89UL), DROM_ROW2(0x80508D89UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80508D89UL), DROM_ROW2(0x80508D89UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80508D89UL), DROM_ROW2(0x80508D89UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80508D89UL), DROM_ROW2(0x80508D89UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80508D89UL), DROM_ROW2(0x80508D89UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80508D89UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL), DROM_ROW2(0x80508D88UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL),
+  DROM_ROW2(0x80509D99UL), DROM_ROW2(0x80509D99UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D70089UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D70088UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80509D99UL), DROM_ROW2(0x80509D99UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D70099UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D70098UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80509D99UL), DROM_ROW2(0x80509D99UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700A9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700A8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80509D99UL), DROM_ROW2(0x80509D99UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700B9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700B8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x80509D99UL), DROM_ROW2(0x80509D99UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700C9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700C8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80509D99UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700D9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700D8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL),
+  DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL),
+  DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8050ADA9UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8912F008UL), DROM_ROW2(0x8017E0E8UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL),
+  DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL),
+  DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8050BDB9UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL), DROM_ROW2(0x80509D98UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0xD0D00089UL), DROM_ROW2(0xE00780E9UL), DROM_ROW2(0xD0D00088UL), DROM_ROW2(0xD00F00E9UL),
+  DROM_ROW2(0xD0D70089UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D70088UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xD0D00099UL), DROM_ROW2(0xE00790E9UL), DROM_ROW2(0xD0D00098UL), DROM_ROW2(0xD00F01E9UL),
+  DROM_ROW2(0xD0D70099UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D70098UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xD0D000A9UL), DROM_ROW2(0xE007A0E9UL), DROM_ROW2(0xD0D000A8UL), DROM_ROW2(0xD00F02E9UL),
+  DROM_ROW2(0xD0D700A9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700A8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xD0D000B9UL), DROM_ROW2(0xE007B0E9UL), DROM_ROW2(0xD0D000B8UL), DROM_ROW2(0xD00F03E9UL),
+  DROM_ROW2(0xD0D700B9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700B8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xD0D000C9UL), DROM_ROW2(0xE007C0E9UL), DROM_ROW2(0xD0D000C8UL), DROM_ROW2(0xD00F04E9UL),
+  DROM_ROW2(0xD0D700C9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700C8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xD0D000D9UL), DROM_ROW2(0x8010F0DEUL), DROM_ROW2(0xD0D000D8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xD0D700D9UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D700D8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090008EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090008EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090008EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090008EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090008EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090008EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090008EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090008EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090008EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090008EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL), DROM_ROW2(0x8050ADA8UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL),
+  DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL),
+  DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL), DROM_ROW2(0x80509908UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090009EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090009EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090009EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090009EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x9090009EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090009EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090009EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090009EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090009EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090009EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL),
+  DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL),
+  DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL), DROM_ROW2(0x8050AA08UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000AEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000AEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000AEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000AEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000AEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000AEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000AEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000AEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000AEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000AEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL),
+  DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL),
+  DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL), DROM_ROW2(0x8050BB08UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000BEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000BEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000BEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000BEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000BEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000BEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000BEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000BEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000BEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000BEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL), DROM_ROW2(0x8050BDB8UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL),
+  DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL),
+  DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL), DROM_ROW2(0x8050CC08UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000CEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000CEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000CEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000CEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000CEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000CEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000CEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000CEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000CEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000CEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL), DROM_ROW2(0x8050CDC9UL),
+  DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL),
+  DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL),
+  DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL), DROM_ROW2(0x8050DD08UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000DEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000DEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x909000DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000DEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000DEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xE00780E8UL), DROM_ROW2(0xE00790E8UL), DROM_ROW2(0xE007A0E8UL), DROM_ROW2(0xE007B0E8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000EEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000EEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000EEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000EEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000EEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD09000EEUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL), DROM_ROW2(0x8050CDC8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0xE007C0E8UL), DROM_ROW2(0xE007D0E8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8050BBBAUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8850BB0AUL), DROM_ROW2(0x8850BBC8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL)
+};
+
+#endif
@@ -0,0 +1,141 @@
+// Generated by mkdrom_mini.c, do not edit.
+// The decoder ROM (drom_mini.bin) built into the emulator, include after emu.h.
+
+#ifndef DROM_MINI_H
+#define DROM_MINI_H
+
+const ulong drom_mini_rom[512] =
+{
+  // execute1
+  DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL),
+  DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL),
+  DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL), DROM_ROW(0xA0028098UL),
+  DROM_ROW(0x8051909EUL), DROM_ROW(0x8051909EUL), DROM_ROW(0x8051909FUL), DROM_ROW(0x8051909FUL),
+  DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL),
+  DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL),
+  DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL),
+  DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL), DROM_ROW(0xE0028098UL),
+  DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL),
+  DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL),
+  DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL), DROM_ROW(0x900A0098UL),
+  DROM_ROW(0x80519097UL), DROM_ROW(0x80519097UL), DROM_ROW(0x80421099UL), DROM_ROW(0x80421099UL),
+  DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL),
+  DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL),
+  DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL),
+  DROM_ROW(0xD00A0098UL), DROM_ROW(0xD00A0098UL), DROM_ROW(0x58920008UL), DROM_ROW(0x58920008UL),
+  DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL),
+  DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL),
+  DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL), DROM_ROW(0x80528098UL),
+  DROM_ROW(0x80128098UL), DROM_ROW(0x509700F8UL), DROM_ROW(0x80128098UL), DROM_ROW(0x000AD798UL),
+  DROM_ROW(0x88158008UL), DROM_ROW(0x80548088UL), DROM_ROW(0x88158008UL), DROM_ROW(0x80548088UL),
+  DROM_ROW(0x88158008UL), DROM_ROW(0x80548088UL), DROM_ROW(0x88158008UL), DROM_ROW(0x80548088UL),
+  DROM_ROW(0x88158008UL), DROM_ROW(0x80548088UL), DROM_ROW(0x88158008UL), DROM_ROW(0x80548088UL),
+  DROM_ROW(0x0011E0E8UL), DROM_ROW(0x80148088UL), DROM_ROW(0x600290E8UL), DROM_ROW(0x8015F0F8UL),
+  DROM_ROW(0x801480F8UL), DROM_ROW(0x0050AAA8UL), DROM_ROW(0x801480F8UL), DROM_ROW(0x8850AAC8UL),
+  DROM_ROW(0x801480F8UL), DROM_ROW(0x0850AAC8UL), DROM_ROW(0x801480F8UL), DROM_ROW(0x0050BCB9UL),
+  DROM_ROW(0x801480F8UL), DROM_ROW(0x845020AEUL), DROM_ROW(0x801480F8UL), DROM_ROW(0x8020A0AEUL),
+  DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL), DROM_ROW(0x000ED7F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL), DROM_ROW(0x8017F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8010888CUL), DROM_ROW(0x80108087UL),
+  DROM_ROW(0x80508980UL), DROM_ROW(0x80508981UL), DROM_ROW(0x80508982UL), DROM_ROW(0x80508983UL),
+  DROM_ROW(0x80508984UL), DROM_ROW(0x80508987UL), DROM_ROW(0x8050898EUL), DROM_ROW(0x8050898FUL),
+  DROM_ROW(0x8050898AUL), DROM_ROW(0x8050898BUL), DROM_ROW(0x80508988UL), DROM_ROW(0x80508989UL),
+  DROM_ROW(0x80500989UL), DROM_ROW(0x88108908UL), DROM_ROW(0x8208009EUL), DROM_ROW(0x8600809EUL),
+  DROM_ROW(0x500F00E8UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL),
+  DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL),
+  DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL),
+  DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL), DROM_ROW(0x80518084UL),
+  DROM_ROW(0xE180F008UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL),
+  DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL),
+  DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL),
+  DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL), DROM_ROW(0x80518080UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL),
+  DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8013F0F8UL), DROM_ROW(0x8010888DUL), DROM_ROW(0x88508809UL),
+  DROM_ROW(0x8850880AUL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL), DROM_ROW(0x00010091UL),
+  DROM_ROW(0x0017E0E9UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL),
+  DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL),
+  DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL),
+  DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL), DROM_ROW(0x80518083UL),
+  DROM_ROW(0xE00089F8UL), DROM_ROW(0x000009F8UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL),
+  DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL),
+  DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL),
+  DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL), DROM_ROW(0x80518081UL),
+  // execute2
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017E0E8UL), DROM_ROW2(0x8017E0E8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8912F008UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8010F0DEUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD0D00098UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8050BBBAUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8850BB0AUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8850BBC8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL), DROM_ROW2(0x8010F00EUL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017E0E8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL), DROM_ROW2(0x80508808UL),
+  DROM_ROW2(0xE00780E8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0xD090008EUL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL),
+  DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL), DROM_ROW2(0x8017F0F8UL)
+};
+
+#endif
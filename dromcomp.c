@@ -0,0 +1,291 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 instruction compressor search.
+
+  The instruction compressor in front of the decoder ROM (InstrCompressor
+  in poc.circ, dromidx() in emu.h) is a set of 2:1 multiplexers selecting
+  instruction bits into the decoder ROM index, switched by the opcode:
+
+    full: opcode != 7: 15...13, 12...10, 9...7, 0   (11-bit index)
+          opcode == 7: 12...10, 9...7, 6...4, 3
+    MINI: opcode != 7: 15...13, 12...10, 0          (8-bit index)
+          opcode == 7: 6...0
+
+  The index must tell apart every two instruction words that need
+  different decoder ROM rows (the pair of execute1 and execute2 rows).
+  This looks for the smallest index made of the same kind of multiplexers:
+  the words are split into two groups by the opcode (one group being one
+  opcode or no split at all) and each group gets the fewest instruction
+  bits that still tell its rows apart. With -x the words with the filler
+  rows (reserved instructions, pc = pc + (-2)) are don't-cares and may
+  share rows with any other instructions.
+
+  The search is exhaustive over the bits that can be dropped at all.
+
+  How to compile: gcc -std=c99 -O2 -Wall dromcomp.c -o dromcomp.exe
+*/
+
+#include "emu.h"
+
+ulong drom[DROM_CNT];
+uint rowid[0x10000];    // distinct execute1/execute2 row pair number per instruction word
+uchar dontcare[0x10000]; // the filler rows, with -x
+uint words[0x10000];    // the instruction words of the group being searched
+uint nwords;
+uint seen[0x10000], seenrow[0x10000], stamp;
+
+// Packs the bits of instr selected by mask.
+uint pack(uint instr, uint mask)
+{
+  uint v = 0, b = 1;
+  for (; mask; mask &= mask - 1)
+  {
+    if (instr & mask & -mask)
+      v |= b;
+    b <<= 1;
+  }
+  return v;
+}
+
+uint popcount(uint v)
+{
+  uint n = 0;
+  for (; v; v &= v - 1)
+    n++;
+  return n;
+}
+
+// Checks if the bits selected by mask tell apart the rows of the group.
+int separates(uint mask)
+{
+  uint i;
+  stamp++;
+  for (i = 0; i < nwords; i++)
+  {
+    uint w = words[i], k = pack(w, mask);
+    if (seen[k] != stamp)
+    {
+      seen[k] = stamp;
+      seenrow[k] = rowid[w];
+    }
+    else if (seenrow[k] != rowid[w])
+      return 0;
+  }
+  return 1;
+}
+
+// Finds the smallest set of instruction bits telling apart the rows of
+// the instruction words with opcodes in the opcode set (bit n for opcode n).
+// Only the bits whose flipping alone never changes the rows can be dropped,
+// so only the sets of those are tried, the largest first.
+uint search(uint opcodes, uint* bits)
+{
+  static uchar ingroup[0x10000];
+  uint instr, i, drop = 0, ndrop, k;
+  nwords = 0;
+  for (instr = 0; instr < 0x10000; instr++)
+    if ((ingroup[instr] = ((opcodes >> (instr >> 13)) & 1) && !dontcare[instr]))
+      words[nwords++] = instr;
+  for (i = 0; i < 16; i++)
+  {
+    uint j;
+    for (j = 0; j < nwords; j++)
+    {
+      uint w = words[j], w2 = w ^ (1U << i);
+      if (ingroup[w2] && rowid[w2] != rowid[w])
+        break;
+    }
+    if (j == nwords)
+      drop |= 1U << i;
+  }
+  ndrop = popcount(drop);
+  for (k = ndrop + 1; k--; )
+  {
+    uint t;
+    for (t = 0; t < 1U << ndrop; t++)
+    {
+      uint m = 0, d = drop, j = t;
+      if (popcount(t) != k)
+        continue;
+      // Spread the bits of t over the droppable bits.
+      for (; d; d &= d - 1, j >>= 1)
+        if (j & 1)
+          m |= d & -d;
+      if (separates(0xFFFF & ~m))
+        return *bits = 0xFFFF & ~m, 16 - k;
+    }
+  }
+  return *bits = 0xFFFF, 16;
+}
+
+void printbits(uint mask)
+{
+  int i, first = 1;
+  for (i = 15; i >= 0; i--)
+    if ((mask >> i) & 1)
+    {
+      int j = i;
+      while (j > 0 && ((mask >> (j - 1)) & 1))
+        j--;
+      printf(first ? "%d" : ", %d", i);
+      if (j != i)
+        printf("...%d", j);
+      first = 0;
+      i = j;
+    }
+  if (first)
+    printf("none");
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, x = 0;
+  char* dromname;
+  uint ninstr, instr, i, v, nrows = 0;
+  uint bestv = 0, bestn = 99, bestbits[2] = { 0 };
+  int mini;
+  static ulong pairs[0x10000][2];
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-x"))
+      x = 1;
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  dromcomp [options] <decoder_rom_file>\n"
+            "Options:\n"
+            "  -be  big-endian input file\n"
+            "  -x   reserved instructions (the filler rows) are don't-cares\n");
+    exit(EXIT_FAILURE);
+  }
+  dromname = argv[i];
+
+  mini = loaddrom(dromname, drom, bigendian);
+  ninstr = 1U << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS);
+
+  // Number the distinct row pairs.
+  for (instr = 0; instr < 0x10000; instr++)
+  {
+    uint idx = dromidx(mini, instr);
+    ulong e1 = drom[idx], e2 = drom[ninstr + idx];
+    for (i = 0; i < nrows; i++)
+      if (pairs[i][0] == e1 && pairs[i][1] == e2)
+        break;
+    if (i == nrows)
+    {
+      pairs[nrows][0] = e1;
+      pairs[nrows][1] = e2;
+      nrows++;
+    }
+    rowid[instr] = i;
+    dontcare[instr] = x && e1 == DROM_FILLER;
+  }
+
+  printf("%s variant, %u distinct row pairs, the current index is %u bits (%lu bytes of ROM)\n\n",
+         mini ? "MINI" : "full", nrows, mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS,
+         4UL << ((mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS) + 1));
+  printf("%-13s %5s %5s  %s\n", "split", "index", "bytes", "bits (group 1; group 2)");
+
+  // v = 8: no split, v = 0...7: opcode v vs the rest.
+  for (v = 8; v + 1; v--)
+  {
+    uint bits[2], k[2], n;
+    if (v == 8)
+    {
+      k[0] = search(0xFF, &bits[0]);
+      k[1] = 0, bits[1] = 0;
+      n = k[0];
+      printf("%-13s", "none");
+    }
+    else
+    {
+      k[0] = search(0xFF & ~(1U << v), &bits[0]);
+      k[1] = search(1U << v, &bits[1]);
+      n = 1 + (k[0] > k[1] ? k[0] : k[1]);
+      printf("opcode %u%-5s", v, (v == 7) ? " (*)" : "");
+    }
+    printf(" %5u %5lu  ", n, 4UL << (n + 1));
+    printbits(bits[0]);
+    if (v != 8)
+    {
+      printf("; ");
+      printbits(bits[1]);
+    }
+    printf("\n");
+    if (n < bestn)
+    {
+      bestn = n;
+      bestv = v;
+      bestbits[0] = bits[0];
+      bestbits[1] = bits[1];
+    }
+  }
+
+  printf("(*) the current split\n");
+
+  // Check the best one: every instruction gets its rows.
+  {
+    static ulong rom[0x20000][2];
+    static uchar used[0x20000];
+    uint err = 0, n;
+    for (instr = 0; instr < 0x10000; instr++)
+    {
+      uint idx = dromidx(mini, instr);
+      int g = bestv != 8 && (instr >> 13) == bestv;
+      if (dontcare[instr])
+        continue;
+      n = (g << bestn) | pack(instr, bestbits[g]);
+      if (!used[n])
+      {
+        used[n] = 1;
+        rom[n][0] = drom[idx];
+        rom[n][1] = drom[ninstr + idx];
+      }
+      else if (rom[n][0] != drom[idx] || rom[n][1] != drom[ninstr + idx])
+        err++;
+    }
+    printf("\nSmallest: %u-bit index, %lu bytes of ROM (%s the current size)%s\n",
+           bestn, 4UL << (bestn + 1),
+           (bestn < (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS)) ? "less than" : "same as",
+           err ? ", CHECK FAILED" : "");
+    for (n = 0; 1U << n < nrows; n++)
+      ;
+    printf("Any compression function (e.g. a lookup table instead of the multiplexers)\n"
+           "needs at least a %u-bit index, %lu bytes of ROM\n", n, 4UL << (n + 1));
+    if (err)
+      return EXIT_FAILURE;
+  }
+  return 0;
+}
@@ -0,0 +1,205 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 decoder ROM mutation tester.
+
+  Measures how well a test ROM checks the microcode. Every used decoder
+  ROM row (everything but the reserved instructions' filler rows and the
+  execute2 rows of the instructions that end in execute1) is mutated:
+  - every one-bit control signal is flipped
+  - every multi-bit field (OP, RL, RR, RI, IMM) is set to every other value
+  and the test ROM is run with every mutant. A mutant is killed when the
+  test fails (gets stuck in a loop away from its last instruction) or
+  hangs (runs more than twice as many cycles as with the original decoder
+  ROM). The surviving mutants show the control signals the test doesn't
+  check. Mutants of the used rows that the test never executes survive
+  trivially and are only counted.
+
+  The mutants (see mutant.h) are run on a pool of threads (-j), each with
+  its own copy of the memory.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread drommut.c -o drommut.exe
+*/
+
+#include "mutant.h"
+#include "isa.h"
+
+enum
+{
+  RES_SURVIVED = RUN_PASSED,
+  RES_FAILED   = RUN_FAILED,
+  RES_HUNG     = RUN_TIMEOUT,
+  RES_CNT
+};
+
+ulong drom[DROM_CNT];
+uchar prog[ROM_SIZE];
+ulong progsize, basecycles;
+int mini;
+ulong counts[DROM_CNT]; // executions per decoder ROM row with the original ROM
+uint example[DROM_CNT]; // an executed instruction per decoder ROM row
+Mutant* mutants;
+uchar* results; // RES_* per mutant
+ulong nmutants;
+
+// Runs mutants first, first + step, first + 2 * step, ...
+void* job(void* arg)
+{
+  MutJob* j = arg;
+  ulong maxcycles = 2 * basecycles, i;
+  uchar* m = calloc(MEM_SIZE, 1);
+  ulong* rom = malloc(sizeof drom);
+  ulong* wlog = malloc(maxcycles * sizeof *wlog);
+  if (!m || !rom || !wlog)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  memcpy(m, prog, ROM_SIZE);
+  memcpy(rom, drom, sizeof drom);
+  for (i = j->first; i < nmutants; i += j->step)
+  {
+    const Mutant* mu = &mutants[i];
+    rom[mu->idx] = mutword(drom, mu);
+    results[i] = mutrun(rom, mini, m, wlog, progsize, maxcycles, NULL, NULL, NULL);
+    rom[mu->idx] = drom[mu->idx];
+  }
+  free(m);
+  free(rom);
+  free(wlog);
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, nthreads = 4;
+  char* dromname;
+  char* progname;
+  uint ninstr, idx, i, f;
+  ulong nused = 0, nunexec = 0, unexecmutants = 0;
+  ulong byfield[NFIELDS][RES_CNT] = { { 0 } }, total[RES_CNT] = { 0 };
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else
+      goto lusage;
+  }
+  if (argc - i != 2)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  drommut [options] <decoder_rom_file> <program_rom_file>\n"
+            "Options:\n"
+            "  -be     big-endian input files\n"
+            "  -j <n>  number of threads (default: 4)\n");
+    exit(EXIT_FAILURE);
+  }
+  dromname = argv[i];
+  progname = argv[i + 1];
+
+  mini = loaddrom(dromname, drom, bigendian);
+  progsize = loadfile(progname, prog, ROM_SIZE, bigendian, 2);
+  ninstr = 1U << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS);
+  isainit(mini);
+
+  {
+    uchar* m = calloc(MEM_SIZE, 1);
+    ulong* wlog = malloc(100000000UL / 16 * sizeof *wlog);
+    if (!m || !wlog)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    memcpy(m, prog, ROM_SIZE);
+    if (mutrun(drom, mini, m, wlog, progsize, 100000000UL / 16, counts, example, &basecycles) !=
+        RES_SURVIVED)
+    {
+      fprintf(stderr, "The test ROM fails with the original decoder ROM\n");
+      exit(EXIT_FAILURE);
+    }
+    free(m);
+    free(wlog);
+  }
+
+  // Mutants of the used rows the test executes.
+  mutants = malloc(2 * ninstr * MUT_PER_ROW * sizeof *mutants);
+  results = malloc(2 * ninstr * MUT_PER_ROW);
+  if (!mutants || !results)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (idx = 0; idx < 2 * ninstr; idx++)
+  {
+    uint nm;
+    if (!dromused(drom, ninstr, idx))
+      continue;
+    nused++;
+    nm = mutrow(drom, idx, &mutants[nmutants]);
+    if (counts[idx])
+      nmutants += nm;
+    else
+      nunexec++, unexecmutants += nm;
+  }
+
+  mutjobs(nthreads, job);
+
+  printf("Surviving mutants:\n%-5s %-9s %-28s %10s  %s\n",
+         "row", "cycle", "instruction", "executed", "mutation");
+  for (i = 0; i < nmutants; i++)
+  {
+    const Mutant* mu = &mutants[i];
+    byfield[mu->field][results[i]]++;
+    total[results[i]]++;
+    if (results[i] == RES_SURVIVED)
+    {
+      char dis[64];
+      isadis(example[mu->idx], dis);
+      printf("%03X   %-9s %04X %-23s %10lu  %s=%u (was %u)\n",
+             mu->idx & (ninstr - 1), (mu->idx < ninstr) ? "execute1" : "execute2",
+             example[mu->idx], dis, counts[mu->idx], fields[mu->field].name, mu->val,
+             CTL(drom[mu->idx], fields[mu->field].pos, fields[mu->field].bits));
+    }
+  }
+
+  printf("\n%-12s %8s %8s %8s %8s\n", "signal", "mutants", "failed", "hung", "survived");
+  for (f = 0; f < NFIELDS; f++)
+    printf("%-12s %8lu %8lu %8lu %8lu\n", fields[f].name,
+           byfield[f][RES_FAILED] + byfield[f][RES_HUNG] + byfield[f][RES_SURVIVED],
+           byfield[f][RES_FAILED], byfield[f][RES_HUNG], byfield[f][RES_SURVIVED]);
+
+  printf("\n%s variant, %s: %lu used decoder ROM rows, %lu not executed by the test (%lu mutants)\n"
+         "%lu mutants run: %lu failed, %lu hung, %lu survived, mutation score %.1f%%\n",
+         mini ? "MINI" : "full", progname, nused, nunexec, unexecmutants,
+         nmutants, total[RES_FAILED], total[RES_HUNG], total[RES_SURVIVED],
+         nmutants ? 100.0 * (total[RES_FAILED] + total[RES_HUNG]) / nmutants : 0.0);
+  return 0;
+}
@@ -0,0 +1,404 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 decoder ROM analyzer: finds instructions whose two execute
+  cycles could be done in one.
+
+  Two decoder ROM rows (execute1 and execute2) can be merged into one when
+  the datapath (CpuDiagram.md, DromSignals.md) can do both at once:
+  - there's one ALU, one data bus, one memory port, one register file
+    write port, one flags register, one interrupt enable flag and one
+    selector register access per cycle
+  - shared control signals (RR, IADDRSEL, SELIFLAGSSEL) mean the same
+    in both rows
+  - execute2 doesn't use anything execute1 produces: DelayReg (and with it
+    the code space flag), a register, the flags, the interrupt enable flag
+    or a selector
+
+  An execute2 row could overlap with the next fetch only if it used none
+  of what the fetch uses: the memory, the data bus, the ALU (DelayReg =
+  sp - 2), sp and pc.
+
+  The analysis is static and conservative: register numbers coming from
+  instruction fields (qqq, the MINI's rrr/RRR) may be any register.
+
+  The dynamic savings are measured by running the test ROM. With -o the
+  decoder ROM with the mergeable rows merged is written and checked
+  against the test ROM.
+
+  How to compile: gcc -std=c99 -O2 -Wall dromopt.c -o dromopt.exe
+*/
+
+#include "emu.h"
+
+enum
+{
+  REG_ANY = 8 // register number from an instruction field, unknown statically
+};
+
+enum
+{
+  WHY_NONE,
+  WHY_ALU,
+  WHY_BUS,
+  WHY_MEM,
+  WHY_REGWR,
+  WHY_FLAGSWR,
+  WHY_IWE,
+  WHY_SEL,
+  WHY_SHARED,
+  WHY_DELAY,
+  WHY_REG,
+  WHY_FLAGS,
+  WHY_IE,
+  WHY_SELDEP,
+  WHY_CNT
+};
+
+const char* whynames[WHY_CNT] =
+{
+  "mergeable",
+  "both use the ALU",
+  "both use the data bus",
+  "both access memory",
+  "both write a register",
+  "both write the flags",
+  "both write the interrupt enable flag",
+  "both access selectors",
+  "conflicting shared control signals",
+  "execute2 uses DelayReg from execute1",
+  "execute2 reads a register written by execute1",
+  "execute2 reads the flags written by execute1",
+  "execute2 reads the interrupt enable flag written by execute1",
+  "execute2 uses a selector written by execute1"
+};
+
+typedef struct
+{
+  ulong ctrl;
+  uint op, rl, rloe, rr, rroe, ri, riwe, imm;
+  uint rrbusoe, aluoe, flagsoe, flagswe, iaddrsel, iwe, sele, seliflagssel;
+  uint cnz, mwe, moe, w16, crst;
+  uint rlreg, rrreg, rireg; // registers, REG_ANY if unknown
+  uint mem, alu, busdrv, bususe, rdpc, rddelay, rdflags;
+} Row;
+
+ulong drom[DROM_CNT];
+ulong opt[DROM_CNT];
+uchar mem[MEM_SIZE];
+ulong counts[DROM_CNT]; // executions per decoder ROM index (execute1)
+uint example[DROM_CNT]; // an instruction with the decoder ROM index
+
+// Resolves a register selector of the decoder ROM row at idx,
+// see cpureg() in emu.h.
+uint rowreg(int mini, uint idx, uint sel, int isrr)
+{
+  if (mini)
+  {
+    // rrr is in the index only for the non-111 opcodes.
+    if (sel == 0)
+      return !(idx & (1U << (DROM_MINI_INSTR_BITS - 1))) ? (idx >> 1) & 7 : REG_ANY;
+    if (sel == 1)
+      return REG_ANY;
+    return sel;
+  }
+  // qqq replaces RR in 111rrr11xPPPxqqq.
+  if (isrr && (idx & (1U << (DROM_INSTR_BITS - 1))) && ((idx >> 4) & 7) >= 6)
+    return REG_ANY;
+  return sel;
+}
+
+int mayalias(uint a, uint b)
+{
+  return a == REG_ANY || b == REG_ANY || a == b;
+}
+
+void decode(Row* r, int mini, uint idx, ulong ctrl)
+{
+  memset(r, 0, sizeof *r);
+  r->ctrl = ctrl;
+  r->op = CTL(ctrl, POS_OP, 4);
+  r->rl = CTL(ctrl, POS_RL, 3);
+  r->rloe = CTL(ctrl, POS_RLOE, 1);
+  r->rr = CTL(ctrl, POS_RR, 3);
+  r->rroe = CTL(ctrl, POS_RROE, 1);
+  r->ri = CTL(ctrl, POS_RI, 3);
+  r->riwe = CTL(ctrl, POS_RIWE, 1);
+  r->imm = CTL(ctrl, POS_IMM, 3);
+  r->rrbusoe = CTL(ctrl, POS_RRBUSOE, 1);
+  r->aluoe = CTL(ctrl, POS_ALUOE, 1);
+  r->flagsoe = CTL(ctrl, POS_FLAGSOE, 1);
+  r->flagswe = CTL(ctrl, POS_FLAGSWE, 1);
+  r->iaddrsel = CTL(ctrl, POS_IADDRSEL, 1);
+  r->iwe = CTL(ctrl, POS_IWE, 1);
+  r->sele = CTL(ctrl, POS_SELE, 1);
+  r->seliflagssel = CTL(ctrl, POS_SELIFLAGSSEL, 1);
+  r->cnz = CTL(ctrl, POS_CNZ, 1);
+  r->mwe = CTL(ctrl, POS_MWE, 1);
+  r->moe = CTL(ctrl, POS_MOE, 1);
+  r->w16 = CTL(ctrl, POS_W16, 1);
+  r->crst = CTL(ctrl, POS_CRST, 1);
+
+  r->rlreg = rowreg(mini, idx, r->rl, 0);
+  r->rrreg = rowreg(mini, idx, r->rr, 1);
+  r->rireg = rowreg(mini, idx, r->ri, 0);
+
+  r->mem = r->moe | r->mwe;
+  // The ALU result goes to the data bus, the address bus, the flags
+  // or the selector number.
+  r->alu = r->aluoe | (r->mem & !r->iaddrsel) | (r->flagswe & !r->seliflagssel) | r->sele;
+  r->busdrv = r->aluoe | r->rrbusoe | r->flagsoe | r->moe | (r->sele & r->seliflagssel);
+  r->bususe = r->riwe | r->mwe | (r->flagswe & r->seliflagssel) | (r->iwe & r->iaddrsel) |
+              (r->sele & !r->seliflagssel);
+  r->rdpc = (r->alu && ((r->rloe && mayalias(r->rlreg, 7)) || (r->rroe && mayalias(r->rrreg, 7)))) ||
+            (r->rrbusoe && mayalias(r->rrreg, 7));
+  r->rddelay = (r->alu && !r->rloe && !r->cnz) || (r->mem && r->iaddrsel);
+  r->rdflags = (r->alu && (r->op == 10 || r->op == 11 || r->imm == 3 || r->cnz)) ||
+               r->flagsoe || r->flagswe; // a flags write keeps some of the flags
+}
+
+// Returns WHY_NONE and the merged row in *m if the rows can be merged.
+uint merge(const Row* a, const Row* b, ulong* m)
+{
+  const Row* alu = b->alu ? b : a;
+  uint iaddrsel = 0, seliflagssel = 0;
+  int acare, bcare;
+
+  // Resources.
+  if (a->alu && b->alu)
+    return WHY_ALU;
+  if ((a->busdrv | a->bususe) && (b->busdrv | b->bususe))
+    return WHY_BUS;
+  if (a->mem && b->mem)
+    return WHY_MEM;
+  if (a->riwe && b->riwe)
+    return WHY_REGWR;
+  if (a->flagswe && b->flagswe)
+    return WHY_FLAGSWR;
+  if (a->iwe && b->iwe)
+    return WHY_IWE;
+  if (a->sele && b->sele)
+    return WHY_SEL;
+
+  // Dependencies of execute2 on execute1.
+  if (b->rddelay)
+    return WHY_DELAY;
+  if (a->riwe &&
+      ((b->alu && b->rloe && mayalias(a->rireg, b->rlreg)) ||
+       (((b->alu && b->rroe) || b->rrbusoe) && mayalias(a->rireg, b->rrreg))))
+    return WHY_REG;
+  if (a->flagswe && b->rdflags)
+    return WHY_FLAGS;
+  if (a->iwe && (b->rdpc && b->iaddrsel))
+    return WHY_IE;
+  if (a->sele && !a->seliflagssel && (b->mem || b->sele))
+    return WHY_SELDEP;
+
+  // Shared control signals.
+  if (b->rrbusoe && a->alu && a->rroe && a->rr != b->rr)
+    return WHY_SHARED;
+  if (a->rrbusoe && b->alu && b->rroe && a->rr != b->rr)
+    return WHY_SHARED;
+  acare = a->mem || a->iwe || a->rdpc;
+  bcare = b->mem || b->iwe || b->rdpc;
+  if (acare && bcare && a->iaddrsel != b->iaddrsel)
+    return WHY_SHARED;
+  if (acare)
+    iaddrsel = a->iaddrsel;
+  else if (bcare)
+    iaddrsel = b->iaddrsel;
+  acare = a->flagswe || a->iwe || a->sele;
+  bcare = b->flagswe || b->iwe || b->sele;
+  if (acare && bcare && a->seliflagssel != b->seliflagssel)
+    return WHY_SHARED;
+  if (acare)
+    seliflagssel = a->seliflagssel;
+  else if (bcare)
+    seliflagssel = b->seliflagssel;
+
+  *m = ((ulong)alu->op << POS_OP) |
+       ((ulong)alu->rl << POS_RL) | ((ulong)alu->rloe << POS_RLOE) |
+       ((ulong)((a->rrbusoe ? a : b->rrbusoe ? b : alu)->rr) << POS_RR) |
+       ((ulong)alu->rroe << POS_RROE) | ((ulong)alu->imm << POS_IMM) |
+       ((ulong)alu->cnz << POS_CNZ) |
+       ((ulong)(a->riwe ? a : b)->ri << POS_RI) | ((ulong)(a->riwe | b->riwe) << POS_RIWE) |
+       ((ulong)(a->rrbusoe | b->rrbusoe) << POS_RRBUSOE) |
+       ((ulong)(a->aluoe | b->aluoe) << POS_ALUOE) |
+       ((ulong)(a->flagsoe | b->flagsoe) << POS_FLAGSOE) |
+       ((ulong)(a->flagswe | b->flagswe) << POS_FLAGSWE) |
+       ((ulong)iaddrsel << POS_IADDRSEL) |
+       ((ulong)(a->iwe | b->iwe) << POS_IWE) |
+       ((ulong)(a->sele | b->sele) << POS_SELE) |
+       ((ulong)seliflagssel << POS_SELIFLAGSSEL) |
+       ((ulong)(a->mwe | b->mwe) << POS_MWE) |
+       ((ulong)(a->moe | b->moe) << POS_MOE) |
+       ((ulong)(a->mem ? a : b)->w16 << POS_W16) |
+       (1UL << POS_CRST);
+  return WHY_NONE;
+}
+
+// Checks if the row could share its cycle with the next fetch.
+int fetchable(const Row* b)
+{
+  return !b->mem && !b->alu && !b->busdrv && !b->bususe &&
+         !(b->riwe && (mayalias(b->rireg, 6) || mayalias(b->rireg, 7)));
+}
+
+// Runs the test ROM. Returns 1 if it passes.
+int run(const ulong* rom, int mini, ulong progsize, ulong* cycles, int count)
+{
+  static Cpu cpu;
+  Run r;
+  uint res;
+  cpuinit(&cpu, mini, rom, mem);
+  runinit(&r, progsize - 2, 100000000);
+  while ((res = runcheck(&r, &cpu)) == RUN_GOING)
+  {
+    cpucycle(&cpu);
+    if (count && cpu.lclk == CLK_EXEC1)
+      counts[cpu.lidx]++;
+  }
+  *cycles = cpu.cycles;
+  return res == RUN_PASSED;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, verbose = 0;
+  char* optname = NULL;
+  char* dromname;
+  char* progname;
+  ulong progsize, cycles, optcycles;
+  ulong why[WHY_CNT] = { 0 }, whydyn[WHY_CNT] = { 0 };
+  ulong nfetch = 0, fetchdyn = 0;
+  uint ninstr, idx, e2, i;
+  int mini;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-v"))
+      verbose = 1;
+    else if (!strcmp(argv[i], "-o") && i + 1 < (uint)argc)
+      optname = argv[++i];
+    else
+      goto lusage;
+  }
+  if (argc - i != 2)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  dromopt [options] <decoder_rom_file> <program_rom_file>\n"
+            "Options:\n"
+            "  -be        big-endian input and output files\n"
+            "  -v         list rows that can't be merged too\n"
+            "  -o <file>  write the decoder ROM with the mergeable rows merged\n");
+    exit(EXIT_FAILURE);
+  }
+  dromname = argv[i];
+  progname = argv[i + 1];
+
+  mini = loaddrom(dromname, drom, bigendian);
+  progsize = loadfile(progname, mem, ROM_SIZE, bigendian, 2);
+  ninstr = 1U << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS);
+  e2 = ninstr; // execute2 rows follow execute1 rows
+
+  for (i = 0x10000; i--; )
+    example[dromidx(mini, i)] = i;
+  if (!run(drom, mini, progsize, &cycles, 1))
+  {
+    fprintf(stderr, "The test ROM fails with the original decoder ROM\n");
+    exit(EXIT_FAILURE);
+  }
+
+  memcpy(opt, drom, sizeof opt);
+  printf("%-5s %-5s %10s  %s\n", "index", "instr", "executed", "verdict");
+  for (idx = 0; idx < ninstr; idx++)
+  {
+    Row a, b;
+    ulong m;
+    uint w;
+    decode(&a, mini, idx, drom[idx]);
+    if (a.crst)
+      continue; // one execute cycle
+    decode(&b, mini, idx, drom[e2 + idx]);
+
+    w = merge(&a, &b, &m);
+    why[w]++;
+    whydyn[w] += counts[idx];
+    if (w == WHY_NONE)
+      opt[idx] = m;
+    if (fetchable(&b))
+    {
+      nfetch++;
+      fetchdyn += counts[idx];
+    }
+    if (w == WHY_NONE || verbose)
+      printf("%03X   %04X  %10lu  %s%s\n", idx, example[idx], counts[idx], whynames[w],
+             fetchable(&b) ? ", execute2 could overlap with fetch" : "");
+  }
+
+  printf("\n%s variant, %lu cycles running %s\n", mini ? "MINI" : "full", cycles, progname);
+  for (i = 0; i < WHY_CNT; i++)
+    if (why[i])
+      printf("%5lu rows (%7lu executions): %s\n", why[i], whydyn[i], whynames[i]);
+  printf("%5lu rows (%7lu executions): execute2 could overlap with the next fetch\n",
+         nfetch, fetchdyn);
+  printf("Estimated savings from merging: %lu cycles (%.2f%%)\n",
+         whydyn[WHY_NONE], cycles ? 100.0 * whydyn[WHY_NONE] / cycles : 0.0);
+
+  if (optname)
+  {
+    FILE* f;
+    int pass = run(opt, mini, progsize, &optcycles, 0);
+    printf("With the merged rows: %s, %lu cycles\n", pass ? "passed" : "FAILED", optcycles);
+
+    if ((f = fopen(optname, "wb")) == NULL)
+    {
+      fprintf(stderr, "Can't create file \"%s\"\n", optname);
+      exit(EXIT_FAILURE);
+    }
+    for (idx = 0; idx < 2 * ninstr; idx++)
+    {
+      ulong v = opt[idx];
+      uchar b[4];
+      for (i = 0; i < 4; i++)
+        b[bigendian ? 3 - i : i] = (v >> (8 * i)) & 0xFF;
+      fwrite(b, 1, 4, f);
+    }
+    if (ferror(f) | fclose(f))
+    {
+      fprintf(stderr, "Can't write to \"%s\"\n", optname);
+      exit(EXIT_FAILURE);
+    }
+    if (!pass)
+      exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
@@ -0,0 +1,415 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 regression test selection by decoder ROM coverage.
+
+  Splits the test ROM into regions, the tests of mktesti.c, and lets you
+  rerun only the tests affected by a change to the decoder ROM.
+
+  -rec runs the test ROM and records the decoder ROM rows (execute cycle
+  and compressed instruction) that every region executes in a map file.
+  The regions are found in the mktesti.c listing (the output of mktesti)
+  and mktesti.c itself: a region begins at a comment line starting with
+  "// Test" or "// Some more" at the top level and ends where the next one
+  begins. The code before the first test (the ISRs and the initialization)
+  is region 0. Whatever the CPU executes outside the test regions (the ISRs,
+  code copied to RAM) belongs to the region it came from.
+
+  -sel compares two decoder ROMs and reruns the regions that execute any
+  of the changed rows. A region is rerun by executing the test ROM with
+  the old decoder ROM up to the region, which is exactly what the earlier
+  regions did with the old one, and then with the new decoder ROM until
+  the test leaves the region. The region fails if the test gets stuck in
+  a loop there (fails an expectation) or hangs. The registers at the exit
+  are also compared with those with the old decoder ROM: if they differ,
+  the following regions, which aren't rerun, may be affected.
+
+  How to compile: gcc -std=c99 -O2 -Wall dromsel.c -o dromsel.exe
+*/
+
+#include "emu.h"
+
+enum
+{
+  MAX_REGIONS = 64,
+  MAX_NAME = 80,
+  MAX_LINE = DROM_CNT * 4 + 16
+};
+
+enum
+{
+  RES_PASSED = RUN_PASSED,
+  RES_FAILED = RUN_FAILED,
+  RES_HUNG   = RUN_TIMEOUT
+};
+
+typedef struct
+{
+  uint start;  // address of the first instruction
+  uint line;   // line of the comment in mktesti.c
+  ulong cycles; // clock cycles spent in the region
+  char name[MAX_NAME];
+  uchar rows[DROM_CNT]; // executed decoder ROM rows
+} Region;
+
+ulong drom[DROM_CNT], drom2[DROM_CNT];
+uchar mem[MEM_SIZE];
+uchar prog[ROM_SIZE];
+ulong progsize;
+int mini;
+Region regions[MAX_REGIONS];
+uint nregions;
+char buf[MAX_LINE];
+
+// Returns the region of an instruction at pc executed after one from region cur.
+uint regionof(uint pc, uint cur)
+{
+  uint r;
+  if (nregions < 2 || pc < regions[1].start || pc >= progsize)
+    return cur;
+  for (r = nregions - 1; pc < regions[r].start; r--)
+    ;
+  return r;
+}
+
+// Reads the regions from the mktesti listing and the source file named in it.
+void loadregions(const char* lstname)
+{
+  FILE* f;
+  char srcname[64] = "";
+  uint line, addr, word, l = 0, r;
+  static uint addrs[0x10000]; // first address per source line
+  uint maxline = 0;
+
+  if ((f = fopen(lstname, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", lstname);
+    exit(EXIT_FAILURE);
+  }
+  memset(addrs, 0xFF, sizeof addrs);
+  while (fgets(buf, sizeof buf, f))
+  {
+    if (sscanf(buf, "%63[^:]:%u %x %x", srcname, &line, &addr, &word) != 4 || line >= 0x10000)
+    {
+      fprintf(stderr, "Can't parse \"%s\"\n", lstname);
+      exit(EXIT_FAILURE);
+    }
+    if (addrs[line] == 0xFFFFFFFF)
+      addrs[line] = addr;
+    if (maxline < line)
+      maxline = line;
+  }
+  fclose(f);
+
+  if ((f = fopen(srcname, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", srcname);
+    exit(EXIT_FAILURE);
+  }
+  strcpy(regions[0].name, "(startup)");
+  nregions = 1;
+  for (;;)
+  {
+    int eof = !fgets(buf, sizeof buf, f);
+    l++;
+    if (eof || !strncmp(buf, "  // Test", 9) || !strncmp(buf, "  // Some more", 14))
+    {
+      // The previous comment begins a region if any code follows it
+      // before this one (the tests may be conditionally compiled).
+      if (nregions > 1 && !regions[nregions - 1].start)
+      {
+        Region* rg = &regions[nregions - 1];
+        for (line = rg->line + 1; line < l && (line > maxline || addrs[line] == 0xFFFFFFFF); line++)
+          ;
+        if (line < l)
+          rg->start = addrs[line];
+        else
+          nregions--;
+      }
+      if (eof)
+        break;
+      if (nregions >= MAX_REGIONS)
+      {
+        fprintf(stderr, "Too many regions in \"%s\"\n", srcname);
+        exit(EXIT_FAILURE);
+      }
+      buf[strcspn(buf, "\r\n")] = '\0';
+      regions[nregions].start = 0;
+      regions[nregions].line = l;
+      snprintf(regions[nregions].name, sizeof regions[nregions].name, "%.*s", MAX_NAME - 1, buf + 5);
+      nregions++;
+    }
+  }
+  fclose(f);
+  for (r = 2; r < nregions; r++)
+    if (regions[r].start <= regions[r - 1].start)
+    {
+      fprintf(stderr, "Regions out of order in \"%s\"\n", srcname);
+      exit(EXIT_FAILURE);
+    }
+}
+
+void writemap(const char* mapname)
+{
+  FILE* f;
+  uint r, idx;
+  if ((f = fopen(mapname, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", mapname);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f, "variant %s\n", mini ? "mini" : "full");
+  for (r = 0; r < nregions; r++)
+  {
+    fprintf(f, "region %04X %u %lu %s\nrows", regions[r].start, regions[r].line,
+            regions[r].cycles, regions[r].name);
+    for (idx = 0; idx < DROM_CNT; idx++)
+      if (regions[r].rows[idx])
+        fprintf(f, " %03X", idx);
+    fprintf(f, "\n");
+  }
+  if (fclose(f))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", mapname);
+    exit(EXIT_FAILURE);
+  }
+}
+
+void readmap(const char* mapname)
+{
+  FILE* f;
+  char variant[8];
+  Region* rg = NULL;
+  int n;
+  if ((f = fopen(mapname, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", mapname);
+    exit(EXIT_FAILURE);
+  }
+  if (!fgets(buf, sizeof buf, f) || sscanf(buf, "variant %7s", variant) != 1 ||
+      strcmp(variant, mini ? "mini" : "full"))
+  {
+    fprintf(stderr, "\"%s\" isn't a map for the %s variant\n", mapname, mini ? "MINI" : "full");
+    exit(EXIT_FAILURE);
+  }
+  nregions = 0;
+  while (fgets(buf, sizeof buf, f))
+  {
+    if (!strncmp(buf, "region ", 7))
+    {
+      if (nregions >= MAX_REGIONS)
+        goto lbad;
+      rg = &regions[nregions++];
+      if (sscanf(buf, "region %x %u %lu %n", &rg->start, &rg->line, &rg->cycles, &n) != 3)
+        goto lbad;
+      buf[strcspn(buf, "\r\n")] = '\0';
+      snprintf(rg->name, sizeof rg->name, "%.*s", MAX_NAME - 1, buf + n);
+    }
+    else if (!strncmp(buf, "rows", 4) && rg)
+    {
+      char* p = buf + 4;
+      uint idx;
+      while (sscanf(p, "%x%n", &idx, &n) == 1)
+      {
+        if (idx >= DROM_CNT)
+          goto lbad;
+        rg->rows[idx] = 1;
+        p += n;
+      }
+    }
+    else
+    {
+lbad:
+      fprintf(stderr, "Can't parse \"%s\"\n", mapname);
+      exit(EXIT_FAILURE);
+    }
+  }
+  fclose(f);
+}
+
+// Runs the test ROM from reset. With r < nregions the decoder ROM is
+// switched from rom to rom2 when region r is entered and the run ends
+// when it's left or the test fails, with the CPU state in *c and the
+// cycles spent in the region in *cycles. Otherwise the whole test is
+// run and the coverage of every region is recorded. Returns RES_*.
+uint run(Cpu* c, const ulong* rom, const ulong* rom2, uint r, ulong* cycles)
+{
+  uint cur = 0, in = (r == 0), res;
+  ulong entry = 0;
+  Run run;
+  memcpy(mem, prog, ROM_SIZE);
+  memset(mem + ROM_SIZE, 0, MEM_SIZE - ROM_SIZE);
+  cpuinit(c, mini, in ? rom2 : rom, mem);
+  runinit(&run, progsize - 2, in ? 2 * regions[r].cycles + 1000 : 100000000UL / 16);
+  while ((res = runcheck(&run, c)) == RUN_GOING)
+  {
+    if (c->clk == CLK_FETCH)
+    {
+      uint next = regionof(c->r[7], cur);
+      if (next != cur)
+      {
+        if (in)
+        {
+          res = RES_PASSED;
+          break;
+        }
+        if (next == r)
+        {
+          in = 1;
+          c->drom = rom2;
+          entry = c->cycles;
+          run.maxcycles = entry + 2 * regions[r].cycles + 1000;
+        }
+        cur = next;
+      }
+    }
+    cpucycle(c);
+    if (r >= nregions)
+    {
+      regions[cur].cycles++;
+      if (c->lclk != CLK_FETCH)
+        regions[cur].rows[c->lidx] = 1;
+    }
+  }
+  *cycles = c->cycles - entry;
+  return res;
+}
+
+int samestate(const Cpu* a, const Cpu* b)
+{
+  return !memcmp(a->r, b->r, sizeof a->r) && a->flags == b->flags &&
+         a->ie == b->ie && !memcmp(a->sel, b->sel, sizeof a->sel);
+}
+
+void record(const char* dromname, const char* lstname, const char* mapname)
+{
+  Cpu cpu;
+  ulong cycles;
+  uint r, idx;
+  loadregions(lstname);
+  if (run(&cpu, drom, drom, MAX_REGIONS, &cycles) != RES_PASSED)
+  {
+    fprintf(stderr, "The test ROM fails with \"%s\"\n", dromname);
+    exit(EXIT_FAILURE);
+  }
+  writemap(mapname);
+  printf("%-4s %-5s %-5s %8s %5s  %s\n", "line", "start", "end", "cycles", "rows", "region");
+  for (r = 0; r < nregions; r++)
+  {
+    uint nrows = 0;
+    for (idx = 0; idx < DROM_CNT; idx++)
+      nrows += regions[r].rows[idx];
+    printf("%4u %04X  %04lX  %8lu %5u  %s\n", regions[r].line, regions[r].start,
+           (r + 1 < nregions) ? regions[r + 1].start : progsize,
+           regions[r].cycles, nrows, regions[r].name);
+  }
+  printf("%u regions, %lu cycles\n", nregions, cycles);
+}
+
+int select(const char* mapname)
+{
+  uint r, idx, nchanged = 0, nunexec = 0, nsel = 0, nbad = 0;
+  static uchar changed[DROM_CNT];
+
+  readmap(mapname);
+  for (idx = 0; idx < DROM_CNT; idx++)
+    if (drom[idx] != drom2[idx])
+    {
+      changed[idx] = 1;
+      nchanged++;
+      for (r = 0; r < nregions && !regions[r].rows[idx]; r++)
+        ;
+      nunexec += (r == nregions);
+    }
+  printf("%u changed decoder ROM rows, %u of them not executed by the test\n", nchanged, nunexec);
+
+  for (r = 0; r < nregions; r++)
+  {
+    Cpu old, cur;
+    ulong oldcycles = 0, cycles = 0;
+    uint res;
+    for (idx = 0; idx < DROM_CNT && !(changed[idx] && regions[r].rows[idx]); idx++)
+      ;
+    if (idx == DROM_CNT)
+      continue;
+    if (!nsel++)
+      printf("%-4s %-5s %8s %8s  %-7s %-4s  %s\n", "line", "start", "old", "new", "result", "pc", "region");
+    run(&old, drom, drom, r, &oldcycles);
+    res = run(&cur, drom, drom2, r, &cycles);
+    if (res != RES_PASSED)
+      nbad++;
+    printf("%4u %04X  %8lu %8lu  %-7s %04X  %s\n", regions[r].line, regions[r].start, oldcycles, cycles,
+           (res == RES_FAILED) ? "FAILED" : (res == RES_HUNG) ? "HUNG" :
+           samestate(&old, &cur) ? "passed" : "DIFFERS", cur.r[7], regions[r].name);
+  }
+  printf("%u of %u regions rerun, %u failed\n", nsel, nregions, nbad);
+  return nbad ? EXIT_FAILURE : 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, i;
+  char* recname = NULL;
+  char* selname = NULL;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-rec") && i + 1 < argc)
+      recname = argv[++i];
+    else if (!strcmp(argv[i], "-sel") && i + 1 < argc)
+      selname = argv[++i];
+    else
+      goto lusage;
+  }
+  if (!recname == !selname || argc - i != 3)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  dromsel [options] -rec <map_file> <decoder_rom_file> <program_rom_file> <listing_file>\n"
+            "  dromsel [options] -sel <map_file> <old_decoder_rom_file> <new_decoder_rom_file> <program_rom_file>\n"
+            "Options:\n"
+            "  -be  big-endian input files\n");
+    exit(EXIT_FAILURE);
+  }
+
+  mini = loaddrom(argv[i], drom, bigendian);
+  if (recname)
+  {
+    progsize = loadfile(argv[i + 1], prog, ROM_SIZE, bigendian, 2);
+    record(argv[i], argv[i + 2], recname);
+    return 0;
+  }
+  if (loaddrom(argv[i + 1], drom2, bigendian) != mini)
+  {
+    fprintf(stderr, "\"%s\" and \"%s\" are for different variants\n", argv[i], argv[i + 1]);
+    exit(EXIT_FAILURE);
+  }
+  progsize = loadfile(argv[i + 2], prog, ROM_SIZE, bigendian, 2);
+  return select(selname);
+}
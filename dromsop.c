@@ -0,0 +1,428 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 decoder ROM logic minimizer.
+
+  Derives a sum-of-products equation for every control signal bit of the
+  decoder ROM as a function of the decoder ROM index bits: c (the clock
+  cycle, 0 = execute1, 1 = execute2) and i10...i0 (i7...i0 in the MINI),
+  the compressed instruction (see dromidx() in emu.h).
+
+  Don't-cares:
+  - the execute2 rows of the instructions that end in execute1 (CRST = 1)
+  - the filler rows of the reserved instructions (pc = pc + (-2)), unless
+    -k is given to keep them looping
+
+  The minimization is two-level, in the spirit of Espresso: all prime
+  implicants are generated (there are at most 3^12 cubes, so it's done
+  exactly), then the essential primes are taken, the rest of the ON-set is
+  covered greedily (the prime covering most uncovered minterms with the
+  fewest literals first) and redundant primes are removed. The bits are
+  minimized in parallel. The equations are checked against the decoder ROM.
+
+  With -pla the equations are also written as a PLA file (.type f) for
+  other logic tools.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread dromsop.c -o dromsop.exe
+*/
+
+#include <pthread.h>
+#include "emu.h"
+
+enum
+{
+  MAX_VARS  = DROM_INSTR_BITS + 1,
+  MAX_CUBES = 531441, // 3^MAX_VARS
+  NBITS     = POS_CRST + 1
+};
+
+const char* const bitnames[NBITS] =
+{
+  "OP0", "OP1", "OP2", "OP3", "RL0", "RL1", "RL2", "RLOE",
+  "RR0", "RR1", "RR2", "RROE", "RI0", "RI1", "RI2", "RIWE",
+  "IMM0", "IMM1", "IMM2", "RRBUSOE", "ALUOE", "FLAGSOE", "FLAGSWE", "IADDRSEL",
+  "IWE", "SELE", "SELIFLAGSSEL", "CNZ", "MWE", "MOE", "W16", "CRST"
+};
+
+// A cube is a product term: bit v of care is set if variable v is in it,
+// bit v of val is its value then.
+typedef struct
+{
+  ushort care, val;
+} Cube;
+
+typedef struct
+{
+  Cube* cubes;
+  uint ncubes, nlits;
+} Sop;
+
+typedef struct
+{
+  uint first, step;
+} Job;
+
+ulong drom[DROM_CNT];
+uint nvars, nrows;
+uchar dc[DROM_CNT]; // don't-care rows
+Sop sops[NBITS];
+uint pow3[MAX_VARS + 1];
+
+uint popcount(uint v)
+{
+  uint n = 0;
+  for (; v; v &= v - 1)
+    n++;
+  return n;
+}
+
+// Converts a ternary cube number (digit v: 0, 1 or 2 = absent) to a Cube.
+Cube tocube(uint t)
+{
+  Cube c = { 0, 0 };
+  uint v;
+  for (v = 0; v < nvars; v++, t /= 3)
+    if (t % 3 != 2)
+    {
+      c.care |= 1U << v;
+      c.val |= (t % 3) << v;
+    }
+  return c;
+}
+
+int covers(Cube c, uint m)
+{
+  return ((m ^ c.val) & c.care) == 0;
+}
+
+void minimize(uint bit)
+{
+  uchar* imp = malloc(pow3[nvars]);   // the cube is an implicant (ON or DC only)
+  uchar* uncov = malloc(nrows);       // ON minterm not covered yet
+  uint* primes = malloc(pow3[nvars] * sizeof *primes);
+  uchar* chosen;
+  uint nprimes = 0, t, m, i, left = 0;
+  Sop* s = &sops[bit];
+
+  if (!imp || !uncov || !primes)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  // imp[t]: a cube with an absent variable is an implicant if both its
+  // halves are; the halves have smaller numbers.
+  for (t = 0; t < pow3[nvars]; t++)
+  {
+    uint v, u = t;
+    for (v = 0; v < nvars && u % 3 != 2; v++)
+      u /= 3;
+    if (v == nvars)
+    {
+      Cube c = tocube(t);
+      imp[t] = dc[c.val] || ((drom[c.val] >> bit) & 1);
+    }
+    else
+      imp[t] = imp[t - 2 * pow3[v]] && imp[t - pow3[v]];
+  }
+
+  for (m = 0; m < nrows; m++)
+    left += uncov[m] = !dc[m] && ((drom[m] >> bit) & 1);
+
+  // Primes: implicants that can't be expanded and cover some ON minterm.
+  for (t = 0; t < pow3[nvars]; t++)
+  {
+    uint v, u = t, prime = imp[t];
+    for (v = 0; prime && v < nvars; v++, u /= 3)
+      if (u % 3 != 2 && imp[t + (2 - u % 3) * pow3[v]])
+        prime = 0;
+    if (prime)
+    {
+      Cube c = tocube(t);
+      uint mm, rest = ~c.care & (nrows - 1);
+      // Enumerate the cube's minterms.
+      for (mm = rest; ; mm = (mm - 1) & rest)
+      {
+        if (uncov[c.val | mm])
+        {
+          primes[nprimes++] = t;
+          break;
+        }
+        if (!mm)
+          break;
+      }
+    }
+  }
+  chosen = calloc(nprimes + 1, 1);
+
+  // Essential primes first, then greedily.
+  while (left)
+  {
+    uint best = 0, bestn = 0, bestlits = 0;
+    for (m = 0; m < nrows && !bestn; m++)
+    {
+      uint n = 0, which = 0;
+      if (!uncov[m])
+        continue;
+      for (i = 0; i < nprimes && n < 2; i++)
+        if (covers(tocube(primes[i]), m))
+          n++, which = i;
+      if (n == 1)
+        best = which, bestn = 1;
+    }
+    if (!bestn)
+      for (i = 0; i < nprimes; i++)
+      {
+        Cube c = tocube(primes[i]);
+        uint mm, rest = ~c.care & (nrows - 1), n = 0;
+        if (chosen[i])
+          continue;
+        for (mm = rest; ; mm = (mm - 1) & rest)
+        {
+          n += uncov[c.val | mm];
+          if (!mm)
+            break;
+        }
+        if (n > bestn || (n == bestn && n && popcount(c.care) < bestlits))
+          best = i, bestn = n, bestlits = popcount(c.care);
+      }
+    chosen[best] = 1;
+    {
+      Cube c = tocube(primes[best]);
+      uint mm, rest = ~c.care & (nrows - 1);
+      for (mm = rest; ; mm = (mm - 1) & rest)
+      {
+        left -= uncov[c.val | mm];
+        uncov[c.val | mm] = 0;
+        if (!mm)
+          break;
+      }
+    }
+  }
+
+  // Remove the primes whose ON minterms are all covered by the others.
+  for (i = nprimes; i--; )
+    if (chosen[i])
+    {
+      Cube c = tocube(primes[i]);
+      uint mm, rest = ~c.care & (nrows - 1), redundant = 1;
+      chosen[i] = 0;
+      for (mm = rest; redundant; mm = (mm - 1) & rest)
+      {
+        uint x = c.val | mm, j;
+        if (!dc[x] && ((drom[x] >> bit) & 1))
+        {
+          for (j = 0; j < nprimes; j++)
+            if (chosen[j] && covers(tocube(primes[j]), x))
+              break;
+          redundant = j < nprimes;
+        }
+        if (!mm)
+          break;
+      }
+      chosen[i] = !redundant;
+    }
+
+  s->cubes = malloc((nprimes + 1) * sizeof *s->cubes);
+  for (i = 0; i < nprimes; i++)
+    if (chosen[i])
+    {
+      s->cubes[s->ncubes++] = tocube(primes[i]);
+      s->nlits += popcount(s->cubes[s->ncubes - 1].care);
+    }
+
+  free(imp);
+  free(uncov);
+  free(primes);
+  free(chosen);
+}
+
+void* job(void* arg)
+{
+  Job* j = arg;
+  uint bit;
+  for (bit = j->first; bit < NBITS; bit += j->step)
+    minimize(bit);
+  return NULL;
+}
+
+const char* varname(uint v)
+{
+  static char names[MAX_VARS][4];
+  if (v == nvars - 1)
+    return "c";
+  sprintf(names[v], "i%u", v);
+  return names[v];
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, keep = 0, nthreads = 4;
+  char* dromname;
+  char* planame = NULL;
+  uint ninstr, idx, bit, i;
+  ulong terms = 0, lits = 0, errors = 0;
+  int mini;
+  Job* jobs;
+  pthread_t* thr;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-k"))
+      keep = 1;
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else if (!strcmp(argv[i], "-pla") && i + 1 < (uint)argc)
+      planame = argv[++i];
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  dromsop [options] <decoder_rom_file>\n"
+            "Options:\n"
+            "  -be          big-endian input file\n"
+            "  -k           keep the reserved instructions' filler rows (not don't-cares)\n"
+            "  -j <n>       number of threads (default: 4)\n"
+            "  -pla <file>  also write the equations as a PLA file\n");
+    exit(EXIT_FAILURE);
+  }
+  dromname = argv[i];
+
+  mini = loaddrom(dromname, drom, bigendian);
+  ninstr = 1U << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS);
+  nrows = 2 * ninstr;
+  nvars = (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS) + 1;
+  for (pow3[0] = 1, i = 1; i <= nvars; i++)
+    pow3[i] = pow3[i - 1] * 3;
+
+  for (idx = 0; idx < ninstr; idx++)
+  {
+    dc[idx] = !keep && drom[idx] == DROM_FILLER;
+    dc[ninstr + idx] = dc[idx] || ((drom[idx] >> POS_CRST) & 1);
+  }
+
+  jobs = calloc(nthreads, sizeof *jobs);
+  thr = calloc(nthreads, sizeof *thr);
+  if (!jobs || !thr)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+  {
+    jobs[i].first = i;
+    jobs[i].step = nthreads;
+    if (pthread_create(&thr[i], NULL, job, &jobs[i]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+    pthread_join(thr[i], NULL);
+
+  for (bit = 0; bit < NBITS; bit++)
+  {
+    const Sop* s = &sops[bit];
+    uint j, v;
+    printf("%s =", bitnames[bit]);
+    if (!s->ncubes)
+      printf(" 0");
+    for (j = 0; j < s->ncubes; j++)
+    {
+      printf(j ? "\n  |" : "");
+      if (!s->cubes[j].care)
+        printf(" 1");
+      for (v = nvars; v--; )
+        if ((s->cubes[j].care >> v) & 1)
+          printf(" %s%s", ((s->cubes[j].val >> v) & 1) ? "" : "~", varname(v));
+    }
+    printf("\n  ; %u terms, %u literals\n", s->ncubes, s->nlits);
+    terms += s->ncubes;
+    lits += s->nlits;
+
+    // Check the equation against the decoder ROM.
+    for (idx = 0; idx < nrows; idx++)
+    {
+      uint on = 0;
+      for (j = 0; j < s->ncubes && !on; j++)
+        on = covers(s->cubes[j], idx);
+      errors += !dc[idx] && on != ((drom[idx] >> bit) & 1);
+    }
+  }
+
+  for (idx = 0, i = 0; idx < nrows; idx++)
+    i += dc[idx];
+  printf("\n%s variant, %u inputs, %u of %u rows are don't-cares\n"
+         "%lu terms, %lu literals in total%s\n",
+         mini ? "MINI" : "full", nvars, i, nrows, terms, lits,
+         errors ? ", CHECK FAILED" : ", checked against the decoder ROM");
+
+  if (planame)
+  {
+    FILE* f;
+    if ((f = fopen(planame, "w")) == NULL)
+    {
+      fprintf(stderr, "Can't create file \"%s\"\n", planame);
+      exit(EXIT_FAILURE);
+    }
+    fprintf(f, ".i %u\n.o %u\n.ilb", nvars, NBITS);
+    for (i = nvars; i--; )
+      fprintf(f, " %s", varname(i));
+    fprintf(f, "\n.ob");
+    for (bit = NBITS; bit--; )
+      fprintf(f, " %s", bitnames[bit]);
+    fprintf(f, "\n.type f\n.p %lu\n", terms);
+    for (bit = NBITS; bit--; )
+    {
+      uint j, v;
+      for (j = 0; j < sops[bit].ncubes; j++)
+      {
+        Cube c = sops[bit].cubes[j];
+        for (v = nvars; v--; )
+          fputc(((c.care >> v) & 1) ? '0' + ((c.val >> v) & 1) : '-', f);
+        fputc(' ', f);
+        for (i = NBITS; i--; )
+          fputc((i == bit) ? '1' : '0', f);
+        fputc('\n', f);
+      }
+    }
+    fprintf(f, ".e\n");
+    if (ferror(f) | fclose(f))
+    {
+      fprintf(stderr, "Can't write to \"%s\"\n", planame);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  return errors ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,734 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 emulator.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread emu.c -o emu.exe
+*/
+
+#include "emu.h"
+#include "isa.h"
+#include "trace.h"
+#include "gdb.h"
+#include "drom.h"
+#include "drom_mini.h"
+
+STATIC_ASSERT(sizeof drom_rom / sizeof drom_rom[0] == DROM_CNT);
+STATIC_ASSERT(sizeof drom_mini_rom / sizeof drom_mini_rom[0] == DROM_MINI_CNT);
+
+typedef struct
+{
+  ulong fetches, reads, writes, bytes, words;
+} Heat;
+
+Heat physheat[BLOCK_CNT];
+Heat logheat[8]; // code space subregions 0-3, data space subregions 0-3 (AKA sel0...sel7)
+ulong msrcnt[8], mrscnt[8];
+ulong lastmsr[8], gapcnt[8], gapmin[8], gapmax[8], gapsum[8];
+ulong covcnt[DROM_CNT]; // executions per decoder ROM row
+
+ulong rnd(ulong* x)
+{
+  // splitmix64
+  unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (ulong)(z ^ (z >> 31));
+}
+
+uint rndn(ulong* x, uint n)
+{
+  return (uint)((rnd(x) >> 8) % n);
+}
+
+void heat(Heat* h, uint acc)
+{
+  if (acc & ACC_FETCH)
+    h->fetches++;
+  else if (acc & ACC_READ)
+    h->reads++;
+  else
+    h->writes++;
+  if (acc & ACC_W16)
+    h->words++;
+  else
+    h->bytes++;
+}
+
+void account(const Cpu* c)
+{
+  if (c->lclk != CLK_FETCH)
+    covcnt[c->lidx]++;
+  if (c->lacc)
+  {
+    heat(&physheat[c->lpa >> BLOCK_BITS], c->lacc);
+    heat(&logheat[((c->lacc & ACC_CODE) ? 0 : 4) + (c->lla >> BLOCK_BITS)], c->lacc);
+  }
+  if (c->lsel & SELACC_READ)
+    mrscnt[c->lselno]++;
+  if (c->lsel & SELACC_WRITE)
+  {
+    uint s = c->lselno;
+    if (msrcnt[s]++)
+    {
+      ulong gap = c->cycles - lastmsr[s];
+      if (!gapcnt[s]++ || gap < gapmin[s])
+        gapmin[s] = gap;
+      if (gap > gapmax[s])
+        gapmax[s] = gap;
+      gapsum[s] += gap;
+    }
+    lastmsr[s] = c->cycles;
+  }
+}
+
+void writeheat(const char* name)
+{
+  FILE* f;
+  uint i;
+
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(f, "region,index,fetches,reads,writes,byte_accesses,word_accesses,"
+             "msr,mrs,msr_gap_min,msr_gap_avg,msr_gap_max\n");
+  for (i = 0; i < BLOCK_CNT; i++)
+  {
+    const Heat* h = &physheat[i];
+    fprintf(f, "phys,%u,%lu,%lu,%lu,%lu,%lu,,,,,\n",
+            i, h->fetches, h->reads, h->writes, h->bytes, h->words);
+  }
+  // Logical subregions map 1:1 onto selectors, so the selector stats go here.
+  for (i = 0; i < 8; i++)
+  {
+    const Heat* h = &logheat[i];
+    fprintf(f, "%s,%u,%lu,%lu,%lu,%lu,%lu,%lu,%lu,",
+            (i < 4) ? "code" : "data", i & 3,
+            h->fetches, h->reads, h->writes, h->bytes, h->words, msrcnt[i], mrscnt[i]);
+    if (gapcnt[i])
+      fprintf(f, "%lu,%lu,%lu\n", gapmin[i], gapsum[i] / gapcnt[i], gapmax[i]);
+    else
+      fprintf(f, ",,\n");
+  }
+
+  if (ferror(f) | fclose(f))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+}
+
+// VCD waveforms for GTKWave & co. Clock cycle n spans the time from 2n
+// to 2n+2, clk rises at 2n (registers show the state at the start of the
+// cycle) and falls at 2n+1.
+typedef struct
+{
+  const char* scope;
+  const char* name;
+  uint bits;
+} VcdVar;
+
+const VcdVar vcdvars[] =
+{
+  { "cpu", "clk", 1 },
+  { "cpu", "DBG_CLK", 2 },
+  { "cpu", "drom_index", 12 },
+  { "ctrl", "OP", 4 },
+  { "ctrl", "RL", 3 },
+  { "ctrl", "RLOE", 1 },
+  { "ctrl", "RR", 3 },
+  { "ctrl", "RROE", 1 },
+  { "ctrl", "RI", 3 },
+  { "ctrl", "RIWE", 1 },
+  { "ctrl", "IMM", 3 },
+  { "ctrl", "RRBUSOE", 1 },
+  { "ctrl", "ALUOE", 1 },
+  { "ctrl", "FLAGSOE", 1 },
+  { "ctrl", "FLAGSWE", 1 },
+  { "ctrl", "IADDRSEL", 1 },
+  { "ctrl", "IWE", 1 },
+  { "ctrl", "SELE", 1 },
+  { "ctrl", "SELIFLAGSSEL", 1 },
+  { "ctrl", "CNZ", 1 },
+  { "ctrl", "MWE", 1 },
+  { "ctrl", "MOE", 1 },
+  { "ctrl", "W16", 1 },
+  { "ctrl", "CRST", 1 },
+  { "bus", "data", 16 },
+  { "bus", "alu", 16 },
+  { "bus", "laddr", 16 },
+  { "bus", "paddr", 22 },
+  { "bus", "mrd", 1 },
+  { "bus", "mwr", 1 },
+  { "bus", "code", 1 },
+  { "regs", "r0", 16 },
+  { "regs", "r1", 16 },
+  { "regs", "r2", 16 },
+  { "regs", "r3", 16 },
+  { "regs", "r4", 16 },
+  { "regs", "r5", 16 },
+  { "regs", "sp", 16 },
+  { "regs", "pc", 16 },
+  { "regs", "flags", 16 },
+  { "regs", "ie", 1 },
+  { "regs", "ir", 16 },
+  { "regs", "delay", 16 },
+  { "regs", "sel0", 8 },
+  { "regs", "sel1", 8 },
+  { "regs", "sel2", 8 },
+  { "regs", "sel3", 8 },
+  { "regs", "sel4", 8 },
+  { "regs", "sel5", 8 },
+  { "regs", "sel6", 8 },
+  { "regs", "sel7", 8 }
+};
+
+enum
+{
+  VCD_NVARS = sizeof vcdvars / sizeof vcdvars[0],
+  VCD_CTRL  = 3,  // index of OP
+  VCD_BUS   = 24, // index of data
+  VCD_REGS  = 31  // index of r0
+};
+
+#define VCD_X (~0UL)
+
+FILE* vcdf;
+const char* vcdname;
+ulong vcdfrom, vcdto = ULONG_MAX;
+ulong vcdval[VCD_NVARS];
+ulong vcdregs[VCD_NVARS]; // registers at the start of the current cycle
+int vcdstarted;
+ulong vcdtime;
+
+void vcdregsave(const Cpu* c)
+{
+  ulong* v = vcdregs + VCD_REGS;
+  uint i;
+  for (i = 0; i < 8; i++)
+    *v++ = c->r[i];
+  *v++ = c->flags;
+  *v++ = c->ie;
+  *v++ = c->ir;
+  *v++ = c->delay;
+  for (i = 0; i < 8; i++)
+    *v++ = c->sel[i];
+}
+
+void vcdopen(const char* name, const Cpu* c)
+{
+  const char* scope = NULL;
+  uint i;
+
+  vcdname = name;
+  if ((vcdf = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(vcdf, "$version SediCiPU2 emu%s $end\n", c->mini ? " (MINI)" : "");
+  fprintf(vcdf, "$timescale 1ns $end\n");
+  fprintf(vcdf, "$scope module cpu $end\n");
+  for (i = 0; i < VCD_NVARS; i++)
+  {
+    const VcdVar* v = &vcdvars[i];
+    if (!scope || strcmp(scope, v->scope))
+    {
+      if (scope && strcmp(scope, "cpu"))
+        fprintf(vcdf, "$upscope $end\n");
+      if (strcmp(v->scope, "cpu"))
+        fprintf(vcdf, "$scope module %s $end\n", v->scope);
+      scope = v->scope;
+    }
+    fprintf(vcdf, "$var %s %u %c %s $end\n",
+            (i < VCD_REGS) ? "wire" : "reg", v->bits, '!' + i, v->name);
+  }
+  if (strcmp(scope, "cpu"))
+    fprintf(vcdf, "$upscope $end\n");
+  fprintf(vcdf, "$upscope $end\n");
+  fprintf(vcdf, "$enddefinitions $end\n");
+
+  vcdregsave(c);
+}
+
+void vcdvar(uint i, ulong v)
+{
+  uint b;
+  if (vcdstarted && v == vcdval[i])
+    return;
+  vcdval[i] = v;
+  if (vcdvars[i].bits == 1)
+  {
+    fprintf(vcdf, "%c%c\n", (v == VCD_X) ? 'x' : '0' + (int)v, '!' + i);
+    return;
+  }
+  fputc('b', vcdf);
+  if (v == VCD_X)
+    fputc('x', vcdf);
+  else
+  {
+    for (b = vcdvars[i].bits - 1; b && !((v >> b) & 1); b--)
+      ;
+    for (;; b--)
+    {
+      fputc('0' + (int)((v >> b) & 1), vcdf);
+      if (!b)
+        break;
+    }
+  }
+  fprintf(vcdf, " %c\n", '!' + i);
+}
+
+// To be called after every clock cycle.
+void vcdcycle(const Cpu* c)
+{
+  ulong n = c->cycles - 1;
+  ulong* v = vcdregs;
+  uint i;
+
+  if (n >= vcdfrom && n <= vcdto)
+  {
+    v[0] = 1;
+    v[1] = c->lclk;
+    v[2] = (c->lclk == CLK_FETCH) ? VCD_X : c->lidx;
+    for (i = 0; i < VCD_BUS - VCD_CTRL; i++)
+    {
+      static const uchar pos[] =
+      {
+        POS_OP, POS_RL, POS_RLOE, POS_RR, POS_RROE, POS_RI, POS_RIWE, POS_IMM,
+        POS_RRBUSOE, POS_ALUOE, POS_FLAGSOE, POS_FLAGSWE, POS_IADDRSEL, POS_IWE,
+        POS_SELE, POS_SELIFLAGSSEL, POS_CNZ, POS_MWE, POS_MOE, POS_W16, POS_CRST
+      };
+      v[VCD_CTRL + i] = (c->lclk == CLK_FETCH) ?
+        VCD_X : CTL(c->lctrl, pos[i], vcdvars[VCD_CTRL + i].bits);
+    }
+    v[VCD_BUS] = c->lbus;
+    v[VCD_BUS + 1] = c->lalu;
+    v[VCD_BUS + 2] = c->lacc ? c->lla : VCD_X;
+    v[VCD_BUS + 3] = c->lacc ? c->lpa : VCD_X;
+    v[VCD_BUS + 4] = (c->lacc & ACC_READ) != 0;
+    v[VCD_BUS + 5] = (c->lacc & ACC_WRITE) != 0;
+    v[VCD_BUS + 6] = c->lacc ? (c->lacc & ACC_CODE) != 0 : VCD_X;
+
+    fprintf(vcdf, "#%lu\n", n * 2);
+    if (!vcdstarted)
+      fprintf(vcdf, "$dumpvars\n");
+    for (i = 0; i < VCD_NVARS; i++)
+      vcdvar(i, v[i]);
+    if (!vcdstarted)
+      fprintf(vcdf, "$end\n");
+    vcdstarted = 1;
+    fprintf(vcdf, "#%lu\n", n * 2 + 1);
+    vcdvar(0, 0);
+    vcdtime = n * 2 + 2;
+  }
+
+  vcdregsave(c);
+}
+
+void vcdclose(void)
+{
+  if (vcdstarted)
+    fprintf(vcdf, "#%lu\n", vcdtime);
+  if (ferror(vcdf) | fclose(vcdf))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", vcdname);
+    exit(EXIT_FAILURE);
+  }
+}
+
+// Describes the instruction fields selecting decoder ROM row i
+// (the compressed instruction, see dromidx()).
+void covclass(int mini, uint i, char* buf)
+{
+  if (!mini && i < 1024)
+    sprintf(buf, "n=%u rrr=%s RRR=%s i0=%u", i >> 7, isa_regs[(i >> 4) & 7], isa_regs[(i >> 1) & 7], i & 1);
+  else if (!mini)
+    sprintf(buf, "rrr=%s m=%u PPP=%s Q=%u", isa_regs[(i >> 7) & 7], (i >> 4) & 7, isa_regs[(i >> 1) & 7], i & 1);
+  else if (i < 128)
+    sprintf(buf, "n=%u rrr=%s i0=%u", i >> 4, isa_regs[(i >> 1) & 7], i & 1);
+  else
+    sprintf(buf, "n=7 i6=%u i5:4=%u i3:0=%u", (i >> 6) & 1, (i >> 4) & 3, i & 15);
+}
+
+// Writes the decoder ROM coverage: how many times every row filled by
+// mkdrom.c was executed, with the instructions it's for. Used rows are
+// the execute1 rows other than the filler and the execute2 rows of the
+// instructions not ending in execute1.
+void writecov(const char* name, int json, const ulong* rom, int mini, const char* progname)
+{
+  static char mnems[1 << DROM_INSTR_BITS][64];
+  uint ninstr = 1U << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS);
+  uint instr, idx, nused[2] = { 0 }, nexec[2] = { 0 }, n = 0;
+  FILE* f;
+
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  // The distinct mnemonics of the instructions mapped to every row.
+  isainit(mini);
+  for (instr = 0; instr < 0x10000; instr++)
+  {
+    char dis[64], tok[66];
+    char* m = mnems[dromidx(mini, instr)];
+    isadis(instr, dis);
+    dis[strcspn(dis, " ")] = '\0';
+    sprintf(tok, "/%s/", dis);
+    if (!strstr(m, tok) && strlen(m) + strlen(tok) < sizeof mnems[0])
+      strcpy(m + strlen(m) - (*m != '\0'), tok);
+  }
+
+  for (idx = 0; idx < 2 * ninstr; idx++)
+  {
+    uint e2 = idx >= ninstr;
+    if (!dromused(rom, ninstr, idx))
+      continue;
+    nused[e2]++;
+    nexec[e2] += covcnt[idx] != 0;
+  }
+
+  if (json)
+  {
+    const char* p;
+    fprintf(f, "{\n  \"variant\": \"%s\",\n  \"program\": \"", mini ? "mini" : "full");
+    for (p = progname; *p; p++)
+      fprintf(f, (*p == '"' || *p == '\\') ? "\\%c" : "%c", *p);
+    fprintf(f, "\",\n"
+               "  \"execute1\": { \"used\": %u, \"executed\": %u },\n"
+               "  \"execute2\": { \"used\": %u, \"executed\": %u },\n"
+               "  \"rows\": [\n",
+            nused[0], nexec[0], nused[1], nexec[1]);
+  }
+  else
+    fprintf(f, "%s variant, %s: %u of %u used decoder ROM rows executed\n"
+               "  execute1: %u of %u\n  execute2: %u of %u\n\n"
+               "Used rows not executed:\n%-9s %-4s %-28s %s\n",
+            mini ? "MINI" : "full", progname, nexec[0] + nexec[1], nused[0] + nused[1],
+            nexec[0], nused[0], nexec[1], nused[1], "cycle", "row", "fields", "instructions");
+
+  for (idx = 0; idx < 2 * ninstr; idx++)
+  {
+    uint e1 = idx & (ninstr - 1), e2 = idx >= ninstr;
+    char cls[64], mn[64];
+    if (!dromused(rom, ninstr, idx))
+      continue;
+    covclass(mini, e1, cls);
+    // "/lb/lw/" -> "lb/lw"
+    sprintf(mn, "%.*s", (int)strlen(mnems[e1]) - 2, mnems[e1] + 1);
+    if (json)
+    {
+      char* p;
+      fprintf(f, "%s    { \"cycle\": %u, \"row\": \"%03X\", \"fields\": \"%s\", \"instructions\": [\"",
+              n++ ? ",\n" : "", e2 + 1, e1, cls);
+      for (p = mn; *p; p++)
+        if (*p == '/')
+          fprintf(f, "\", \"");
+        else
+          fputc(*p, f);
+      fprintf(f, "\"], \"executed\": %lu }", covcnt[idx]);
+    }
+    else if (!covcnt[idx])
+      fprintf(f, "%-9s %03X  %-28s %s\n", e2 ? "execute2" : "execute1", e1, cls, mn);
+  }
+  if (json)
+    fprintf(f, "\n  ]\n}\n");
+
+  if (ferror(f) | fclose(f))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+}
+
+// Prints the source line (found in the mktesti listing) of the instruction
+// at physical address pa and the "// Test..." comment preceding it.
+void writewhere(const char* lstname, ulong pa)
+{
+  FILE* f;
+  char buf[512], srcname[64] = "", test[512] = "", text[512] = "";
+  uint line, addr, word, found = 0, l = 0;
+
+  if ((f = fopen(lstname, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", lstname);
+    exit(EXIT_FAILURE);
+  }
+  while (fgets(buf, sizeof buf, f))
+  {
+    if (sscanf(buf, "%63[^:]:%u %x %x", srcname, &line, &addr, &word) != 4)
+    {
+      fprintf(stderr, "Can't parse \"%s\"\n", lstname);
+      exit(EXIT_FAILURE);
+    }
+    if (addr == pa)
+    {
+      found = line;
+      break;
+    }
+  }
+  fclose(f);
+  if (!found)
+  {
+    printf("  %05lX isn't in %s\n", pa, lstname);
+    return;
+  }
+
+  if ((f = fopen(srcname, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", srcname);
+    exit(EXIT_FAILURE);
+  }
+  while (l < found && fgets(buf, sizeof buf, f))
+  {
+    char* p = buf + strspn(buf, " \t");
+    p[strcspn(p, "\r\n")] = '\0';
+    if (++l == found)
+      strcpy(text, p);
+    else if (!strncmp(p, "// Test", 7) || !strncmp(p, "// Some more", 12))
+      strcpy(test, p);
+  }
+  fclose(f);
+  printf("  %s:%u: %s\n", srcname, found, text);
+  if (*test)
+    printf("  %s\n", test);
+}
+
+ulong drom[DROM_CNT];
+uchar mem[MEM_SIZE];
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0;
+  int builtin = -1; // -1: decoder ROM file, 0: built-in full, 1: built-in MINI
+  int perfctr = 0;
+  char* heatname = NULL;
+  char* covname = NULL;
+  char* covjsonname = NULL;
+  char* tracename = NULL;
+  char* vcdfile = NULL;
+  char* lstname = NULL;
+  char* irqname = NULL;
+  char* irqrecname = NULL;
+  char* progname;
+  ulong maxcycles = 100000000;
+  ulong irqseed = 0, irqrate = 1000, nirqs = 0, nextirq = 0;
+  int irqrand = 0;
+  IrqEdge* irqs = NULL;
+  FILE* irqrec = NULL;
+  uint gdbport = 0;
+  ulong progsize, insns = 0;
+  int i, mini, res;
+  Cpu cpu;
+  Run run;
+  TraceWriter tw;
+  Gdb gdb;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-full"))
+      builtin = 0;
+    else if (!strcmp(argv[i], "-mini"))
+      builtin = 1;
+    else if (!strcmp(argv[i], "-perf"))
+      perfctr = 1;
+    else if (!strcmp(argv[i], "-heat") && i + 1 < argc)
+      heatname = argv[++i];
+    else if (!strcmp(argv[i], "-cov") && i + 1 < argc)
+      covname = argv[++i];
+    else if (!strcmp(argv[i], "-covjson") && i + 1 < argc)
+      covjsonname = argv[++i];
+    else if (!strcmp(argv[i], "-trace") && i + 1 < argc)
+      tracename = argv[++i];
+    else if (!strcmp(argv[i], "-vcd") && i + 1 < argc)
+      vcdfile = argv[++i];
+    else if (!strcmp(argv[i], "-vcdfrom") && i + 1 < argc)
+      vcdfrom = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-vcdto") && i + 1 < argc)
+      vcdto = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-gdb") && i + 1 < argc)
+      gdbport = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-cycles") && i + 1 < argc)
+      maxcycles = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-lst") && i + 1 < argc)
+      lstname = argv[++i];
+    else if (!strcmp(argv[i], "-irq") && i + 1 < argc)
+      irqname = argv[++i];
+    else if (!strcmp(argv[i], "-irqrec") && i + 1 < argc)
+      irqrecname = argv[++i];
+    else if (!strcmp(argv[i], "-irqrand") && i + 1 < argc)
+      irqrand = 1, irqseed = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-irqrate") && i + 1 < argc && (irqrate = strtoul(argv[++i], NULL, 0)) > 0)
+      ;
+    else
+      goto lusage;
+  }
+  if (argc - i != 2 - (builtin >= 0))
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  emu [options] <decoder_rom_file> <program_rom_file>\n"
+            "  emu [options] -full|-mini <program_rom_file>\n"
+            "Options:\n"
+            "  -be           big-endian input files\n"
+            "  -full         use the built-in full decoder ROM (drom.h)\n"
+            "  -mini         use the built-in MINI decoder ROM (drom_mini.h)\n"
+            "  -perf         enable performance counters (mrs r, s with s = 8...15)\n"
+            "  -heat <file>  write memory access heatmap (CSV) to file\n"
+            "  -cov <file>   write decoder ROM coverage (the used rows not executed) to file\n"
+            "  -covjson <file> write decoder ROM coverage (all used rows) as JSON to file\n"
+            "  -trace <file> write binary execution trace to file\n"
+            "  -vcd <file>   write VCD waveforms of control signals, buses and registers\n"
+            "  -vcdfrom <n>  first clock cycle to write to the VCD file (default: 0)\n"
+            "  -vcdto <n>    last clock cycle to write to the VCD file (default: all)\n"
+            "  -gdb <port>   wait for a GDB remote protocol connection on 127.0.0.1:port\n"
+            "  -cycles <n>   stop after n clock cycles (default: 100000000)\n"
+            "  -lst <file>   show the source line where the test stops, from the mktesti listing\n"
+            "  -irq <file>   replay the IRQ edges of the schedule file (lines of <cycle> <irq>)\n"
+            "  -irqrand <n>  raise random IRQs, n is the random seed\n"
+            "  -irqrate <n>  mean clock cycles between random IRQs (default: 1000)\n"
+            "  -irqrec <file> record the IRQ edges (replayed, random, from the debugger) to file\n"
+            "Exit status: 0 if the test passes, 1 if it fails (or on error), 2 if it times out\n");
+    exit(EXIT_FAILURE);
+  }
+  if (builtin < 0)
+  {
+    mini = loaddrom(argv[i], drom, bigendian);
+    progname = argv[i + 1];
+  }
+  else
+  {
+    mini = builtin;
+    progname = argv[i];
+  }
+
+  progsize = loadfile(progname, mem, ROM_SIZE, bigendian, 2);
+  cpuinit(&cpu, mini, (builtin < 0) ? drom : mini ? drom_mini_rom : drom_rom, mem);
+  cpu.perfctr = perfctr;
+  if (tracename)
+    tropenw(&tw, tracename, &cpu);
+  if (vcdfile)
+    vcdopen(vcdfile, &cpu);
+  if (gdbport)
+    gdbopen(&gdb, gdbport);
+  if (irqname)
+    nirqs = loadirqs(irqname, &irqs);
+  if (irqrecname)
+  {
+    if ((irqrec = fopen(irqrecname, "w")) == NULL)
+    {
+      fprintf(stderr, "Can't create file \"%s\"\n", irqrecname);
+      exit(EXIT_FAILURE);
+    }
+    fprintf(irqrec, "# IRQ edges of %s, replay with -irq\n", progname);
+  }
+
+  // The test passes when pc reaches the last instruction
+  // and fails when it gets stuck in an infinite loop elsewhere.
+  runinit(&run, progsize - 2, maxcycles);
+  for (;;)
+  {
+    if (gdbport && cpu.clk == CLK_FETCH)
+      gdbfetch(&gdb, &cpu);
+    if ((res = runcheck(&run, &cpu)) != RUN_GOING)
+      break;
+    if (cpu.clk == CLK_FETCH)
+      insns++;
+    // The IRQ inputs rise for one clock cycle, IRQs of several sources
+    // at the same cycle merge.
+    if (irqname || irqrand || gdbport)
+    {
+      uint lines = irqsched(irqs, nirqs, &nextirq, cpu.cycles), k;
+      if (irqrand && !rndn(&irqseed, irqrate))
+        lines |= 1 + rndn(&irqseed, (1U << IRQ_CNT) - 1);
+      if (gdbport)
+      {
+        lines |= gdb.irqs;
+        gdb.irqs = 0;
+      }
+      for (k = 0; irqrec && k < IRQ_CNT; k++)
+        if ((lines >> k) & 1)
+          fprintf(irqrec, "%lu %u\n", cpu.cycles, k);
+      if (lines | cpu.irqin)
+        cpuirq(&cpu, lines);
+    }
+    cpucycle(&cpu);
+    account(&cpu);
+    if (tracename)
+      trcycle(&tw, &cpu);
+    if (vcdfile)
+      vcdcycle(&cpu);
+    if (gdbport)
+      gdbcycle(&gdb, &cpu);
+  }
+  res -= RUN_PASSED; // the exit status
+
+  if (gdbport)
+    gdbexit(&gdb, res);
+
+  if (tracename)
+    trclosew(&tw);
+  if (vcdfile)
+    vcdclose();
+  if (irqrec && (ferror(irqrec) | fclose(irqrec)))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", irqrecname);
+    exit(EXIT_FAILURE);
+  }
+
+  switch (res)
+  {
+  case 0:
+    printf("Passed: pc=%04X, %lu cycles, %lu instructions\n", cpu.r[7], cpu.cycles, insns);
+    break;
+  case 1:
+    printf("Failed: infinite loop at pc=%04X, %lu cycles, %lu instructions\n", cpu.r[7], cpu.cycles, insns);
+    break;
+  default:
+    printf("Timed out: pc=%04X, %lu cycles, %lu instructions\n", cpu.r[7], cpu.cycles, insns);
+    break;
+  }
+  if (res && lstname)
+    writewhere(lstname, cpuphys(&cpu, 1, cpu.r[7]));
+
+  if (heatname)
+    writeheat(heatname);
+  if (covname)
+    writecov(covname, 0, cpu.drom, mini, progname);
+  if (covjsonname)
+    writecov(covjsonname, 1, cpu.drom, mini, progname);
+
+  return res;
+}
@@ -0,0 +1,729 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 emulator core.
+
+  The core executes the decoder ROM (drom.bin or drom_mini.bin) one clock
+  cycle at a time, the way the CPU in poc.circ/poc_mini.circ does, so it
+  can be used to check microcode changes without Logisim.
+
+  The core is in this header and is meant to be included by exactly one
+  .c file of a program, e.g. emu.c.
+*/
+
+#ifndef EMU_H
+#define EMU_H
+
+#include <limits.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define STATIC_ASSERT(x) extern char StAtIcAsSeRt[(x) ? 1 : -1]
+
+STATIC_ASSERT(CHAR_BIT == 8);
+
+typedef unsigned char uchar;
+typedef unsigned short ushort;
+typedef unsigned uint;
+typedef unsigned long ulong;
+
+enum
+{
+  BLOCK_BITS = 14,
+  BLOCK_SIZE = 1 << BLOCK_BITS, // 16KB physical memory block
+  BLOCK_CNT  = 256,
+  MEM_SIZE   = BLOCK_SIZE * BLOCK_CNT, // 4MB
+  ROM_SIZE   = BLOCK_SIZE // physical block 0 is read-only
+};
+
+enum
+{
+  DROM_INSTR_BITS      = 11,
+  DROM_CNT             = 2 << DROM_INSTR_BITS, // 16KB / 4
+  DROM_MINI_INSTR_BITS = 8,
+  DROM_MINI_CNT        = 2 << DROM_MINI_INSTR_BITS // 2KB / 4
+};
+
+// Positions of the control signals in the decoder ROM word, see DromSignals.md.
+enum
+{
+  POS_OP,
+  POS_RL           = POS_OP + 4,
+  POS_RLOE         = POS_RL + 3,
+  POS_RR,
+  POS_RROE         = POS_RR + 3,
+  POS_RI,
+  POS_RIWE         = POS_RI + 3,
+  POS_IMM,
+  POS_RRBUSOE      = POS_IMM + 3,
+  POS_ALUOE,
+  POS_FLAGSOE,
+  POS_FLAGSWE,
+  POS_IADDRSEL,
+  POS_IWE,
+  POS_SELE,
+  POS_SELIFLAGSSEL,
+  POS_CNZ,
+  POS_MWE,
+  POS_MOE,
+  POS_W16,
+  POS_CRST
+};
+
+#define CTL(ctrl, pos, bits) ((uint)((ctrl) >> (pos)) & ((1U << (bits)) - 1))
+
+// Invariants of a decoder ROM row that the datapath relies on:
+// - no memory read and write in the same cycle
+// - at most one data bus driver (ALU, RR, flags, selector read, memory)
+// - a data bus driver for every register, memory and selector write
+// - no selector and memory accesses in the same cycle
+#define DROM_DRIVERS(v) \
+  (CTL(v, POS_ALUOE, 1) + CTL(v, POS_RRBUSOE, 1) + CTL(v, POS_FLAGSOE, 1) + \
+   (CTL(v, POS_SELE, 1) & CTL(v, POS_SELIFLAGSSEL, 1)) + CTL(v, POS_MOE, 1))
+#define DROM_ROW_OK(v) \
+  (!(CTL(v, POS_MOE, 1) & CTL(v, POS_MWE, 1)) && \
+   DROM_DRIVERS(v) <= 1 && \
+   (DROM_DRIVERS(v) || \
+    !(CTL(v, POS_MWE, 1) | CTL(v, POS_RIWE, 1) | (CTL(v, POS_SELE, 1) & !CTL(v, POS_SELIFLAGSSEL, 1)))) && \
+   !(CTL(v, POS_SELE, 1) & (CTL(v, POS_MOE, 1) | CTL(v, POS_MWE, 1))))
+
+// Decoder ROM row constants (see mkdrom.c's -romh) that fail to compile
+// if the row breaks the invariants; execute2 rows must also end the
+// instruction.
+#define DROM_ROW(v) ((v) + 0 * sizeof(char[DROM_ROW_OK(v) ? 1 : -1]))
+#define DROM_ROW2(v) ((v) + 0 * sizeof(char[DROM_ROW_OK(v) && CTL(v, POS_CRST, 1) ? 1 : -1]))
+
+// The reserved instructions' row (pc = pc + (-2)), see mkdrom.c.
+#define DROM_FILLER \
+  ((1UL << POS_CRST) | (7UL << POS_RI) | (1UL << POS_RIWE) | (7UL << POS_RL) | \
+   (1UL << POS_RLOE) | (7UL << POS_IMM) | (8UL << POS_OP) | (1UL << POS_ALUOE))
+
+enum
+{
+  FLAG_C = 1 << 0,
+  FLAG_Z = 1 << 1,
+  FLAG_S = 1 << 2,
+  FLAG_O = 1 << 3
+};
+
+enum
+{
+  CLK_FETCH,
+  CLK_EXEC1,
+  CLK_EXEC2
+};
+
+// Kinds of memory accesses performed in a clock cycle.
+enum
+{
+  ACC_READ  = 1 << 0,
+  ACC_WRITE = 1 << 1,
+  ACC_W16   = 1 << 2,
+  ACC_FETCH = 1 << 3,
+  ACC_CODE  = 1 << 4 // program/code space (sel0...sel3) vs data space (sel4...sel7)
+};
+
+// Kinds of selector accesses performed in a clock cycle.
+enum
+{
+  SELACC_READ  = 1 << 0, // mrs
+  SELACC_WRITE = 1 << 1  // msr
+};
+
+// Performance counters, an extension of the selector register block
+// (see Cpu::perfctr and the CPU's PerfCtrs in poc.circ). Each 32-bit
+// counter occupies two selector numbers: reading the low half latches the
+// high half, which is read next.
+enum
+{
+  PERF_SEL     = 8, // first selector number
+  PERF_CYCLES  = 0, // clock cycles
+  PERF_INSNS   = 2, // retired instructions
+  PERF_MEMACCS = 4, // memory accesses by instructions (not instruction fetches)
+  PERF_IRQS    = 6, // IRQs taken
+  PERF_CNT     = 8
+};
+
+enum
+{
+  IRQ_CNT  = 6,
+  SWI_IRQ  = 0x9B3F // swi 31, substituted for the instruction when an IRQ is taken
+};
+
+typedef struct
+{
+  // Architectural state.
+  uint r[8];  // r0...r5, sp, pc
+  uint flags; // masks (15-10), requested IRQs (9-4), O, S, Z, C (3-0)
+  uint ie;    // external/hardware interrupt enable flag
+  uint sel[8];
+
+  // Microarchitectural state.
+  uint ir;     // instruction register
+  uint clk;    // CLK_FETCH, CLK_EXEC1, CLK_EXEC2
+  uint delay;  // DelayReg
+  uint cspace; // MiscIntMem's Q1: code space was selected in the previous cycle
+  uint irqin;  // levels of the IRQ inputs, for edge detection
+  ulong cycles;
+  ulong insns, memaccs, irqs;
+  uint perfhi; // latched high half of a performance counter
+
+  // Configuration.
+  int mini;
+  int perfctr; // mrs r, s with PERF_SEL <= s < PERF_SEL + PERF_CNT reads
+               // performance counters, msr ignores these selector numbers
+  const ulong* drom;
+  uchar* mem; // MEM_SIZE bytes
+
+  // What happened in the last clock cycle.
+  uint lclk;   // CLK_FETCH, CLK_EXEC1, CLK_EXEC2
+  uint lidx;   // decoder ROM index
+  ulong lctrl; // decoder ROM word
+  uint lbus;   // data bus
+  uint lalu;   // ALU output
+  uint lacc;   // ACC_*
+  uint lla;    // logical address
+  ulong lpa;   // physical address
+  uint lold;   // memory contents at the physical address before a write
+  uint lsel;   // SELACC_*
+  uint lselno; // selector number
+} Cpu;
+
+void cpureset(Cpu* c)
+{
+  c->r[7] = 0;
+  c->ie = 0;
+  c->sel[0] = c->sel[4] = 0;
+  c->clk = CLK_FETCH;
+}
+
+void cpuinit(Cpu* c, int mini, const ulong* drom, uchar* mem)
+{
+  memset(c, 0, sizeof *c);
+  c->mini = mini;
+  c->drom = drom;
+  c->mem = mem;
+  cpureset(c);
+}
+
+// Sets the levels of the IRQ inputs (bit k = IRQk).
+// IRQs are edge-triggered: a 0 to 1 transition requests the IRQ.
+void cpuirq(Cpu* c, uint lines)
+{
+  lines &= (1U << IRQ_CNT) - 1;
+  c->flags |= (lines & ~c->irqin) << 4;
+  c->irqin = lines;
+}
+
+// An edge of an IRQ schedule: IRQ input irq rises before clock cycle
+// cycle (counting from 0) and falls after it.
+typedef struct
+{
+  ulong cycle;
+  uint irq;
+} IrqEdge;
+
+// The IRQ inputs that the schedule e of n edges raises before clock
+// cycle cycle. *next is the first edge not yet applied.
+uint irqsched(const IrqEdge* e, ulong n, ulong* next, ulong cycle)
+{
+  uint lines = 0;
+  while (*next < n && e[*next].cycle <= cycle)
+    lines |= 1U << e[(*next)++].irq;
+  return lines;
+}
+
+// Drives the IRQ inputs from the schedule e of n edges before the next
+// clock cycle. *next is the first edge not yet applied.
+void cpuirqsched(Cpu* c, const IrqEdge* e, ulong n, ulong* next)
+{
+  uint lines = irqsched(e, n, next, c->cycles);
+  if (lines | c->irqin)
+    cpuirq(c, lines);
+}
+
+uint sext(uint v, uint bits)
+{
+  uint m = 1U << (bits - 1);
+  return ((v & ((m << 1) - 1)) ^ m) - m;
+}
+
+// The instruction compressor in front of the decoder ROM.
+uint dromidx(int mini, uint ir)
+{
+  uint n = ir >> 13;
+  if (!mini)
+  {
+    if (n != 7)
+      return (n << 7) | (((ir >> 10) & 7) << 4) | (((ir >> 7) & 7) << 1) | (ir & 1);
+    return (1U << 10) | (((ir >> 10) & 7) << 7) | (((ir >> 7) & 7) << 4) | (((ir >> 4) & 7) << 1) | ((ir >> 3) & 1);
+  }
+  if (n != 7)
+    return (n << 4) | (((ir >> 10) & 7) << 1) | (ir & 1);
+  return (1U << 7) | (ir & 0x7F);
+}
+
+// Tells if decoder ROM row idx (of 2 * ninstr) is used: it's neither
+// a reserved instruction's filler row nor the execute2 row of an
+// instruction that ends in execute1.
+int dromused(const ulong* rom, uint ninstr, uint idx)
+{
+  uint e1 = idx & (ninstr - 1);
+  return rom[e1] != DROM_FILLER && !(idx >= ninstr && ((rom[e1] >> POS_CRST) & 1));
+}
+
+int condtrue(uint flags, uint cc)
+{
+  uint c = flags & 1, z = (flags >> 1) & 1, s = (flags >> 2) & 1, o = (flags >> 3) & 1;
+  uint t;
+  switch (cc & 7)
+  {
+  default:
+  case 0: t = c; break;
+  case 1: t = z; break;
+  case 2: t = s; break;
+  case 3: t = c | z; break;
+  case 4: t = s ^ o; break;
+  case 5: t = (s ^ o) | z; break;
+  case 6: t = o; break;
+  case 7: t = !o; break;
+  }
+  return t ^ (cc >> 3);
+}
+
+// The immediate decoder.
+uint cpuimm(const Cpu* c, uint sel)
+{
+  uint ir = c->ir;
+  switch (sel)
+  {
+  default:
+  case 0: return 0xFFFF;
+  case 1: return ir & 0x7F;
+  case 2: return sext(ir, 7) & 0xFFFF;
+  case 3:
+    if (c->mini)
+      return condtrue(c->flags, ir & 15) ? (sext(ir >> 6, 7) << 1) & 0xFFFF : 0;
+    return condtrue(c->flags, ((ir >> 7) & 1) * 8 + ((ir >> 10) & 7)) ? (sext(ir, 7) << 1) & 0xFFFF : 0;
+  case 4: return ((c->mini ? ir >> 1 : ir) & 0x1FF) << 7 & 0xFFFF;
+  case 5: return sext(c->mini ? ir >> 1 : ir, 9) & 0xFFFF;
+  case 6: return (sext(ir, 11) << 1) & 0xFFFF;
+  case 7: return 0xFFFE;
+  }
+}
+
+// Maps a register selector from the decoder ROM to a register number.
+// The MINI decoder ROM refers to instruction's register fields with 0 and 1.
+uint cpureg(const Cpu* c, uint sel)
+{
+  if (c->mini && sel <= 1)
+    return (c->ir >> (sel ? 7 : 10)) & 7;
+  return sel;
+}
+
+uint cpuread(const Cpu* c, uint reg, uint iaddrsel)
+{
+  if (reg == 7)
+    return (c->r[7] & 0xFFFE) | (iaddrsel ? c->ie : 0);
+  return c->r[reg];
+}
+
+void cpuwrite(Cpu* c, uint reg, uint v)
+{
+  c->r[reg] = (reg >= 6) ? (v & 0xFFFE) : (v & 0xFFFF);
+}
+
+ulong cpuphys(const Cpu* c, uint code, uint la)
+{
+  return ((ulong)c->sel[(code ? 0 : 4) + (la >> BLOCK_BITS)] << BLOCK_BITS) | (la & (BLOCK_SIZE - 1));
+}
+
+// Reads half of a performance counter, PERF_*.
+uint perfread(Cpu* c, uint n)
+{
+  ulong v = 0;
+  switch (n & ~1U)
+  {
+  case PERF_CYCLES: v = c->cycles - 1; break; // completed cycles, as in PerfCtrs
+  case PERF_INSNS: v = c->insns; break;
+  case PERF_MEMACCS: v = c->memaccs; break;
+  case PERF_IRQS: v = c->irqs; break;
+  }
+  if (n & 1)
+    return c->perfhi;
+  c->perfhi = (v >> 16) & 0xFFFF;
+  return v & 0xFFFF;
+}
+
+uint memread(const Cpu* c, ulong pa, uint w16)
+{
+  if (w16)
+  {
+    pa &= ~1UL;
+    return c->mem[pa] | ((uint)c->mem[pa + 1] << 8);
+  }
+  return c->mem[pa];
+}
+
+void memwrite(Cpu* c, ulong pa, uint w16, uint v)
+{
+  if (pa < ROM_SIZE)
+    return;
+  if (w16)
+  {
+    pa &= ~1UL;
+    c->mem[pa] = v & 0xFF;
+    c->mem[pa + 1] = (v >> 8) & 0xFF;
+  }
+  else
+  {
+    c->mem[pa] = v & 0xFF;
+  }
+}
+
+// The ALU. Returns the 16-bit result, *fl receives O, S, Z, C.
+uint alu(uint op, uint a, uint b, uint cin, uint* fl)
+{
+  uint r, n = b & 15, c = 0, o = 0;
+  switch (op)
+  {
+  case 0: r = a >> n; break; // sr
+  case 1: r = a << n; break; // sl
+  case 2: r = (a >> n) | (a << (16 - n)); break; // rr
+  case 3: r = (a << n) | (a >> (16 - n)); break; // rl
+  case 4: r = (a >> n) | ((a & 0x8000) ? 0xFFFFU << (16 - n) : 0); break; // asr
+  default: r = 0; break; // reserved
+  case 7: r = a ^ b; break;
+  case 8: case 10: // add, adc
+    r = a + b + ((op == 10) ? cin : 0);
+    c = r >> 16;
+    o = ((a ^ r) & (b ^ r) & 0x8000) != 0;
+    break;
+  case 9: case 11: // sub/cmp, sbb
+    r = a - b - ((op == 11) ? cin : 0);
+    c = (r >> 16) & 1;
+    o = ((a ^ b) & (a ^ r) & 0x8000) != 0;
+    break;
+  case 12: r = a & 0xFF; break; // zxt
+  case 13: r = sext(a, 8); break; // sxt
+  case 14: r = a & b; break;
+  case 15: r = a | b; break;
+  }
+  r &= 0xFFFF;
+  *fl = (o << 3) | ((r >> 15) << 2) | ((r == 0) << 1) | c;
+  return r;
+}
+
+// Executes one clock cycle.
+void cpucycle(Cpu* c)
+{
+  c->lclk = c->clk;
+  c->lidx = 0;
+  c->lctrl = 0;
+  c->lacc = 0;
+  c->lsel = 0;
+  c->cycles++;
+
+  if (c->clk == CLK_FETCH)
+  {
+    uint la = c->r[7];
+    if (c->ie && ((c->flags >> 10) & (c->flags >> 4) & ((1U << IRQ_CNT) - 1)))
+    {
+      c->ir = SWI_IRQ;
+      c->irqs++;
+    }
+    else
+    {
+      c->insns++;
+      c->lacc = ACC_READ | ACC_W16 | ACC_FETCH | ACC_CODE;
+      c->lla = la;
+      c->lpa = cpuphys(c, 1, la);
+      c->ir = memread(c, c->lpa, 1);
+    }
+    c->lbus = c->ir;
+    c->r[7] = (la + 2) & 0xFFFE;
+    c->lalu = c->delay = (c->r[6] - 2) & 0xFFFF; // DelayReg = sp + (-2)
+    c->cspace = 0;
+    c->clk = CLK_EXEC1;
+    return;
+  }
+
+  {
+    uint idx = dromidx(c->mini, c->ir) |
+               ((c->clk == CLK_EXEC2) << (c->mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS));
+    ulong ctrl = c->drom[idx];
+    uint op = CTL(ctrl, POS_OP, 4);
+    uint rl = cpureg(c, CTL(ctrl, POS_RL, 3));
+    uint rloe = CTL(ctrl, POS_RLOE, 1);
+    uint rr = cpureg(c, CTL(ctrl, POS_RR, 3));
+    uint rroe = CTL(ctrl, POS_RROE, 1);
+    uint ri = cpureg(c, CTL(ctrl, POS_RI, 3));
+    uint riwe = CTL(ctrl, POS_RIWE, 1);
+    uint imm = CTL(ctrl, POS_IMM, 3);
+    uint rrbusoe = CTL(ctrl, POS_RRBUSOE, 1);
+    uint aluoe = CTL(ctrl, POS_ALUOE, 1);
+    uint flagsoe = CTL(ctrl, POS_FLAGSOE, 1);
+    uint flagswe = CTL(ctrl, POS_FLAGSWE, 1);
+    uint iaddrsel = CTL(ctrl, POS_IADDRSEL, 1);
+    uint iwe = CTL(ctrl, POS_IWE, 1);
+    uint sele = CTL(ctrl, POS_SELE, 1);
+    uint seliflagssel = CTL(ctrl, POS_SELIFLAGSSEL, 1);
+    uint cnz = CTL(ctrl, POS_CNZ, 1);
+    uint mwe = CTL(ctrl, POS_MWE, 1);
+    uint moe = CTL(ctrl, POS_MOE, 1);
+    uint w16 = CTL(ctrl, POS_W16, 1);
+    uint crst = CTL(ctrl, POS_CRST, 1);
+    uint dil, dir, res, fl, addr, now, code, bus = 0xFFFF;
+
+    // In the full variant the hardware substitutes qqq for RR
+    // in 111rrr11xPPPxqqq instructions.
+    if (!c->mini && (c->ir >> 13) == 7 && ((c->ir >> 8) & 3) == 3)
+      rr = c->ir & 7;
+
+    dil = rloe ? cpuread(c, rl, iaddrsel) : c->delay;
+    if (cnz && !(rloe && (c->flags & FLAG_C)))
+      dil = 0;
+    dir = rroe ? cpuread(c, rr, iaddrsel) : cpuimm(c, imm);
+    res = alu(op, dil, dir, c->flags & FLAG_C, &fl);
+
+    // The MINI forms code space addresses only with pc in RL, its RR may
+    // refer to pc (e.g. `decs`, which is encoded with rrr==pc) harmlessly.
+    now = (rl == 7) || (!c->mini && rr == 7);
+    addr = iaddrsel ? c->delay : res;
+    code = iaddrsel ? c->cspace : now;
+
+    if (aluoe)
+      bus = res;
+    if (rrbusoe)
+      bus = cpuread(c, rr, iaddrsel);
+    if (flagsoe)
+      bus = c->flags;
+    if (sele && seliflagssel && c->perfctr && res - PERF_SEL < PERF_CNT)
+      bus = perfread(c, res - PERF_SEL);
+    else if (sele && seliflagssel)
+    {
+      c->lsel = SELACC_READ;
+      c->lselno = res & 7;
+      bus = c->sel[c->lselno];
+    }
+    if (moe || mwe)
+    {
+      c->memaccs++;
+      c->lacc = (moe ? ACC_READ : ACC_WRITE) | (w16 ? ACC_W16 : 0) | (code ? ACC_CODE : 0);
+      c->lla = addr;
+      c->lpa = cpuphys(c, code, addr);
+      if (moe)
+        bus = memread(c, c->lpa, w16);
+      else
+      {
+        c->lold = memread(c, c->lpa, w16);
+        memwrite(c, c->lpa, w16, bus);
+      }
+    }
+
+    if (riwe)
+      cpuwrite(c, ri, bus);
+    if (flagswe)
+    {
+      if (seliflagssel)
+        c->flags = (bus & 0xFC0F) | (c->flags & bus & 0x03F0);
+      else
+        c->flags = (c->flags & ~0xFU) | fl;
+    }
+    if (iwe)
+      c->ie = iaddrsel ? (bus & 1) : seliflagssel;
+    if (sele && !seliflagssel && !(c->perfctr && res - PERF_SEL < PERF_CNT))
+    {
+      c->lsel = SELACC_WRITE;
+      c->lselno = res & 7;
+      c->sel[c->lselno] = bus & 0xFF;
+    }
+
+    c->delay = res;
+    c->cspace = now;
+    c->clk = crst ? CLK_FETCH : CLK_EXEC2;
+
+    c->lidx = idx;
+    c->lctrl = ctrl;
+    c->lbus = bus;
+    c->lalu = res;
+  }
+}
+
+// Results of a test run.
+enum
+{
+  RUN_GOING,
+  RUN_PASSED,  // pc reached the end address
+  RUN_FAILED,  // an instruction elsewhere jumped to itself (failed expectation)
+  RUN_TIMEOUT  // the clock cycle limit was reached
+};
+
+// A test run. A test ROM passes when it gets to its last instruction,
+// a jump to itself, and fails when it gets stuck in one elsewhere.
+typedef struct
+{
+  uint end, lastpc;
+  ulong maxcycles;
+} Run;
+
+void runinit(Run* r, uint end, ulong maxcycles)
+{
+  r->end = end;
+  r->lastpc = 0xFFFF;
+  r->maxcycles = maxcycles;
+}
+
+// To be called before every clock cycle. Returns RUN_GOING until the run
+// ends. The limit is checked in every cycle, not just at fetch, since a
+// broken decoder ROM may never end an instruction.
+uint runcheck(Run* r, const Cpu* c)
+{
+  if (c->clk == CLK_FETCH)
+  {
+    uint pc = c->r[7];
+    if (pc == r->end)
+      return RUN_PASSED;
+    if (pc == r->lastpc)
+      return RUN_FAILED;
+    r->lastpc = pc;
+  }
+  return (c->cycles >= r->maxcycles) ? RUN_TIMEOUT : RUN_GOING;
+}
+
+// Runs the CPU until pc reaches end or it fails or runs out of cycles.
+// Returns RUN_*.
+uint emurun(Cpu* c, uint end, ulong maxcycles)
+{
+  Run r;
+  uint res;
+  runinit(&r, end, maxcycles);
+  while ((res = runcheck(&r, c)) == RUN_GOING)
+    cpucycle(c);
+  return res;
+}
+
+// Loads a file of up to maxsize bytes, optionally swapping bytes within
+// words of wordsize bytes (the big-endian files produced with -be).
+// Returns the file size.
+ulong loadfile(const char* name, uchar* buf, ulong maxsize, int bigendian, int wordsize)
+{
+  FILE* f;
+  ulong size, i;
+  int j;
+
+  if ((f = fopen(name, "rb")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  size = fread(buf, 1, maxsize, f);
+  if (ferror(f) || fgetc(f) != EOF)
+  {
+    fprintf(stderr, "Can't read file \"%s\" or it's too big\n", name);
+    exit(EXIT_FAILURE);
+  }
+  fclose(f);
+
+  if (bigendian)
+  {
+    for (i = 0; i + wordsize <= size; i += wordsize)
+      for (j = 0; j < wordsize / 2; j++)
+      {
+        uchar t = buf[i + j];
+        buf[i + j] = buf[i + wordsize - 1 - j];
+        buf[i + wordsize - 1 - j] = t;
+      }
+  }
+  return size;
+}
+
+// Loads the decoder ROM, tells the variant from the ROM size.
+// Returns 0 for the full variant, 1 for the MINI.
+int loaddrom(const char* name, ulong* drom, int bigendian)
+{
+  static uchar buf[DROM_CNT * 4];
+  ulong size = loadfile(name, buf, sizeof buf, bigendian, 4), i;
+  if (size != DROM_CNT * 4 && size != DROM_MINI_CNT * 4)
+  {
+    fprintf(stderr, "Unexpected size of decoder ROM file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < size / 4; i++)
+    drom[i] = buf[i * 4] | ((ulong)buf[i * 4 + 1] << 8) |
+              ((ulong)buf[i * 4 + 2] << 16) | ((ulong)buf[i * 4 + 3] << 24);
+  return size == DROM_MINI_CNT * 4;
+}
+
+// Loads an IRQ schedule (see IrqEdge): lines of "<cycle> <irq>" in the
+// order of the cycles, # begins a comment. Returns the number of edges,
+// *edges receives the malloc()'d edges.
+ulong loadirqs(const char* name, IrqEdge** edges)
+{
+  FILE* f;
+  char buf[256];
+  ulong n = 0, max = 0, line = 0;
+  IrqEdge* e = NULL;
+
+  if ((f = fopen(name, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  while (fgets(buf, sizeof buf, f))
+  {
+    ulong cycle;
+    uint irq;
+    char c;
+    line++;
+    buf[strcspn(buf, "#")] = '\0';
+    if (sscanf(buf, " %c", &c) != 1)
+      continue;
+    if (sscanf(buf, "%lu %u", &cycle, &irq) != 2 || irq >= IRQ_CNT ||
+        (n && cycle < e[n - 1].cycle))
+    {
+      fprintf(stderr, "Invalid IRQ edge in \"%s\" at line %lu\n", name, line);
+      exit(EXIT_FAILURE);
+    }
+    if (n == max)
+    {
+      max = max ? max * 2 : 64;
+      if ((e = realloc(e, max * sizeof *e)) == NULL)
+      {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+      }
+    }
+    e[n].cycle = cycle;
+    e[n++].irq = irq;
+  }
+  fclose(f);
+  *edges = e;
+  return n;
+}
+
+#endif
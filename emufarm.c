@@ -0,0 +1,388 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 regression farm.
+
+  Runs a matrix of test ROMs in the emulator (emu.h) concurrently and
+  summarizes the results, optionally in a JUnit XML report. Every line of
+  the matrix file is a job:
+
+    <program_rom_file> <decoder_rom_file> [<irq_schedule_file> [<cycles>]]
+
+  The decoder ROM may be -full or -mini for the built-in ones (drom.h,
+  drom_mini.h), the IRQ schedule (see loadirqs() in emu.h) may be - for
+  none and the cycles limit the job (default: -cycles). # begins a
+  comment. A job passes, fails or times out just like in emu.c: it passes
+  when pc reaches the last instruction and fails when it gets stuck in an
+  infinite loop elsewhere.
+
+  The files are loaded once. The -j threads take the next job from the
+  matrix as they finish the previous one, so long jobs don't hold up the
+  rest.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread emufarm.c -o emufarm.exe
+*/
+
+#include <pthread.h>
+#include <sys/time.h>
+#include "emu.h"
+#include "drom.h"
+#include "drom_mini.h"
+
+enum
+{
+  MAX_FILES = 256, // distinct files of each kind
+  MAX_JOBS  = 4096
+};
+
+enum
+{
+  RES_PASSED  = RUN_PASSED,
+  RES_FAILED  = RUN_FAILED,
+  RES_TIMEOUT = RUN_TIMEOUT
+};
+
+const char* const resnames[] = { [RES_PASSED] = "passed", [RES_FAILED] = "FAILED", [RES_TIMEOUT] = "TIMEOUT" };
+
+typedef struct
+{
+  char* name;
+  void* data;   // program: uchar[ROM_SIZE], decoder ROM: ulong[DROM_CNT], IRQs: IrqEdge[]
+  ulong size;   // program bytes, IRQ edges
+  int mini;     // decoder ROM variant
+} File;
+
+typedef struct
+{
+  int prog, drom, irqs; // File indices, irqs = -1 if none
+  ulong maxcycles;
+  int res;
+  uint pc;
+  ulong cycles, insns, irqcnt;
+  double seconds; // wall time
+} Job;
+
+File progs[MAX_FILES], droms[MAX_FILES], irqfiles[MAX_FILES];
+int nprogs, ndroms, nirqfiles;
+Job jobs[MAX_JOBS];
+int njobs, nextjob;
+int bigendian;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+char* dupstr(const char* s)
+{
+  char* d = malloc(strlen(s) + 1);
+  if (!d)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  return strcpy(d, s);
+}
+
+void* alloc(ulong size)
+{
+  void* p = calloc(size, 1);
+  if (!p)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  return p;
+}
+
+// Returns the wall clock time in seconds.
+double now(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+// Finds or loads a file of the kind (files, *n), returns its index.
+int addfile(File* files, int* n, const char* name, int kind)
+{
+  int i;
+  for (i = 0; i < *n; i++)
+    if (!strcmp(files[i].name, name))
+      return i;
+  if (*n >= MAX_FILES)
+  {
+    fprintf(stderr, "Too many files\n");
+    exit(EXIT_FAILURE);
+  }
+  files[i].name = dupstr(name);
+  switch (kind)
+  {
+  case 'p':
+    files[i].data = alloc(ROM_SIZE);
+    files[i].size = loadfile(name, files[i].data, ROM_SIZE, bigendian, 2);
+    break;
+  case 'd':
+    if (!strcmp(name, "-full") || !strcmp(name, "-mini"))
+    {
+      files[i].mini = name[1] == 'm';
+      files[i].data = (void*)(files[i].mini ? drom_mini_rom : drom_rom);
+    }
+    else
+    {
+      files[i].data = alloc(DROM_CNT * sizeof(ulong));
+      files[i].mini = loaddrom(name, files[i].data, bigendian);
+    }
+    break;
+  default:
+    files[i].size = loadirqs(name, (IrqEdge**)&files[i].data);
+    break;
+  }
+  return (*n)++;
+}
+
+void loadmatrix(const char* name, ulong maxcycles)
+{
+  FILE* f;
+  char buf[1024];
+  ulong line = 0;
+
+  if ((f = fopen(name, "r")) == NULL)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  while (fgets(buf, sizeof buf, f))
+  {
+    char prog[256], drom[256], irqs[256] = "-", cycles[32] = "";
+    int n;
+    Job* j;
+    line++;
+    buf[strcspn(buf, "#")] = '\0';
+    if ((n = sscanf(buf, "%255s %255s %255s %31s", prog, drom, irqs, cycles)) < 1)
+      continue;
+    if (n < 2)
+    {
+      fprintf(stderr, "Invalid job in \"%s\" at line %lu\n", name, line);
+      exit(EXIT_FAILURE);
+    }
+    if (njobs >= MAX_JOBS)
+    {
+      fprintf(stderr, "Too many jobs in \"%s\"\n", name);
+      exit(EXIT_FAILURE);
+    }
+    j = &jobs[njobs++];
+    j->prog = addfile(progs, &nprogs, prog, 'p');
+    j->drom = addfile(droms, &ndroms, drom, 'd');
+    j->irqs = strcmp(irqs, "-") ? addfile(irqfiles, &nirqfiles, irqs, 'i') : -1;
+    j->maxcycles = *cycles ? strtoul(cycles, NULL, 0) : maxcycles;
+  }
+  fclose(f);
+}
+
+// Runs the job in memory mem (MEM_SIZE bytes).
+void run(Job* j, uchar* mem)
+{
+  const File* prog = &progs[j->prog];
+  const File* irqs = (j->irqs >= 0) ? &irqfiles[j->irqs] : NULL;
+  ulong nextirq = 0;
+  double start = now();
+  Cpu cpu;
+  Run r;
+
+  memset(mem, 0, MEM_SIZE);
+  memcpy(mem, prog->data, prog->size);
+  cpuinit(&cpu, droms[j->drom].mini, droms[j->drom].data, mem);
+  j->insns = 0;
+  runinit(&r, prog->size - 2, j->maxcycles);
+  while ((j->res = runcheck(&r, &cpu)) == RUN_GOING)
+  {
+    if (cpu.clk == CLK_FETCH)
+      j->insns++;
+    if (irqs)
+      cpuirqsched(&cpu, irqs->data, irqs->size, &nextirq);
+    cpucycle(&cpu);
+  }
+  j->pc = cpu.r[7];
+  j->cycles = cpu.cycles;
+  j->irqcnt = cpu.irqs;
+  j->seconds = now() - start;
+}
+
+void* worker(void* arg)
+{
+  uchar* mem = alloc(MEM_SIZE);
+  (void)arg;
+  for (;;)
+  {
+    int k;
+    pthread_mutex_lock(&lock);
+    k = nextjob++;
+    pthread_mutex_unlock(&lock);
+    if (k >= njobs)
+      break;
+    run(&jobs[k], mem);
+  }
+  free(mem);
+  return NULL;
+}
+
+void xmlstr(FILE* f, const char* s)
+{
+  for (; *s; s++)
+    switch (*s)
+    {
+    case '&': fputs("&amp;", f); break;
+    case '<': fputs("&lt;", f); break;
+    case '>': fputs("&gt;", f); break;
+    case '"': fputs("&quot;", f); break;
+    default: fputc(*s, f); break;
+    }
+}
+
+void describe(const Job* j, char* buf)
+{
+  switch (j->res)
+  {
+  case RES_PASSED: sprintf(buf, "passed"); break;
+  case RES_FAILED: sprintf(buf, "infinite loop at pc=%04X", j->pc); break;
+  default: sprintf(buf, "timed out at pc=%04X", j->pc); break;
+  }
+}
+
+// Every testcase is named by the program, the decoder ROM variant and
+// the job number (the line in the summary), so the names are unique even
+// when the same program runs several times.
+void writejunit(const char* name, int nfailed, double seconds)
+{
+  FILE* f;
+  int k;
+
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+             "<testsuites tests=\"%d\" failures=\"%d\" time=\"%.3f\">\n"
+             "  <testsuite name=\"emufarm\" tests=\"%d\" failures=\"%d\" errors=\"0\" time=\"%.3f\">\n",
+          njobs, nfailed, seconds, njobs, nfailed, seconds);
+  for (k = 0; k < njobs; k++)
+  {
+    const Job* j = &jobs[k];
+    char what[64];
+    fprintf(f, "    <testcase classname=\"");
+    xmlstr(f, droms[j->drom].name);
+    if (j->irqs >= 0)
+    {
+      fprintf(f, ".");
+      xmlstr(f, irqfiles[j->irqs].name);
+    }
+    fprintf(f, "\" name=\"");
+    xmlstr(f, progs[j->prog].name);
+    fprintf(f, " %s #%d\" time=\"%.3f\">\n"
+               "      <system-out>%lu cycles, %lu instructions, %lu IRQs</system-out>\n",
+            droms[j->drom].mini ? "mini" : "full", k + 1, j->seconds,
+            j->cycles, j->insns, j->irqcnt);
+    if (j->res != RES_PASSED)
+    {
+      describe(j, what);
+      fprintf(f, "      <failure type=\"%s\" message=\"%s\"/>\n",
+              (j->res == RES_FAILED) ? "failed" : "timeout", what);
+    }
+    fprintf(f, "    </testcase>\n");
+  }
+  fprintf(f, "  </testsuite>\n</testsuites>\n");
+  if (ferror(f) | fclose(f))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int nthreads = 4, t, k, cnt[RES_TIMEOUT + 1] = { 0 };
+  ulong maxcycles = 100000000;
+  char* junitname = NULL;
+  pthread_t* thr;
+  double start;
+  int i;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-j") && i + 1 < argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else if (!strcmp(argv[i], "-cycles") && i + 1 < argc)
+      maxcycles = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-junit") && i + 1 < argc)
+      junitname = argv[++i];
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  emufarm [options] <matrix_file>\n"
+            "Options:\n"
+            "  -be           big-endian input files\n"
+            "  -j <n>        number of threads (default: 4)\n"
+            "  -cycles <n>   stop a job after n clock cycles (default: 100000000)\n"
+            "  -junit <file> write JUnit XML report to file\n");
+    exit(EXIT_FAILURE);
+  }
+
+  loadmatrix(argv[i], maxcycles);
+
+  start = now();
+  thr = alloc(nthreads * sizeof *thr);
+  for (t = 0; t < nthreads; t++)
+    if (pthread_create(&thr[t], NULL, worker, NULL))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  for (t = 0; t < nthreads; t++)
+    pthread_join(thr[t], NULL);
+
+  printf("%-8s %-24s %-24s %-16s %12s %12s %6s\n",
+         "result", "program", "decoder ROM", "IRQs", "cycles", "instructions", "pc");
+  for (k = 0; k < njobs; k++)
+  {
+    const Job* j = &jobs[k];
+    cnt[j->res]++;
+    printf("%-8s %-24s %-24s %-16s %12lu %12lu   %04X\n",
+           resnames[j->res], progs[j->prog].name, droms[j->drom].name,
+           (j->irqs >= 0) ? irqfiles[j->irqs].name : "-", j->cycles, j->insns, j->pc);
+  }
+  printf("\n%d jobs: %d passed, %d failed, %d timed out\n",
+         njobs, cnt[RES_PASSED], cnt[RES_FAILED], cnt[RES_TIMEOUT]);
+
+  if (junitname)
+    writejunit(junitname, cnt[RES_FAILED] + cnt[RES_TIMEOUT], now() - start);
+
+  return (cnt[RES_FAILED] | cnt[RES_TIMEOUT]) ? EXIT_FAILURE : 0;
+}
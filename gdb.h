@@ -0,0 +1,645 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 debugger stub speaking the GDB remote serial protocol over
+  a TCP connection to 127.0.0.1 (used by emu.c).
+
+  Supported packets: ?, g, G, p, P, m, M, c, s, Z0...Z4, z0...z4, k, D,
+  qSupported, qAttached, qRcmd, qXfer:features:read and Ctrl-C (interrupt).
+
+  Monitor commands (qRcmd):
+
+    irq <n>  raise IRQ input n (0...5) for one clock cycle when the CPU
+             continues (the emulator takes the requests from irqs)
+
+  Registers (16 bits each, hex, little-endian as usual for the protocol):
+
+    0...7   r0...r5, sp, pc
+    8       flags
+    9       ie (interrupt enable flag)
+    10...17 sel0...sel7
+
+  They're also described in target.xml (qXfer:features:read). It names no
+  architecture (GDB has none for SediCiPU2), so whether a debugger accepts
+  it depends on the debugger.
+
+  Addresses:
+
+    0x000000...0x00FFFF  program/code space (through sel0...sel3)
+    0x010000...0x01FFFF  data space (through sel4...sel7)
+    0x400000...0x7FFFFF  physical memory (writes to the ROM are allowed)
+
+  Breakpoints (Z0, Z1) are on program/code space addresses and are kept
+  in a table with one entry per instruction address, which the fetch cycle
+  looks up. Watchpoints (Z2: write, Z3: read, Z4: access) are checked only
+  when there are any, a hit reports the first accessed address in the
+  watched range.
+
+  How to compile programs using this stub: add -lws2_32 on Windows.
+*/
+
+#ifndef GDB_H
+#define GDB_H
+
+#include "emu.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+typedef int SOCKET;
+#define INVALID_SOCKET (-1)
+#define closesocket close
+#endif
+
+enum
+{
+  GDB_CODE     = 0x000000,
+  GDB_DATA     = 0x010000,
+  GDB_PHYS     = 0x400000,
+  GDB_NREGS    = 18,
+  GDB_PKT_SIZE = 4096,
+  GDB_MAX_WP   = 16,
+  GDB_POLL     = 1 << 16 // clock cycles between checks for Ctrl-C
+};
+
+enum
+{
+  GDB_RUN,
+  GDB_STEP,
+  GDB_STOP
+};
+
+typedef struct
+{
+  uint type; // 2: write, 3: read, 4: access
+  ulong addr, len;
+} GdbWatch;
+
+typedef struct
+{
+  SOCKET sock;
+  int state;      // GDB_RUN, GDB_STEP, GDB_STOP
+  int attached;   // 0 after D (detach)
+  int resumed;    // c or s was the last command, a stop reply is due
+  int sig;        // signal number for the stop reply
+  ulong nextpoll; // cycle count at which to check for Ctrl-C next
+  uchar bp[0x8000]; // per 16-bit instruction of program/code space
+  GdbWatch wp[GDB_MAX_WP];
+  uint nwp;
+  ulong hitaddr;  // watchpoint hit
+  uint hittype;
+  uint irqs;      // IRQ inputs to raise (monitor irq)
+  uchar in[GDB_PKT_SIZE];
+  uint inpos, inlen;
+  char pkt[GDB_PKT_SIZE * 2 + 8];
+} Gdb;
+
+void gdbfail(const char* msg)
+{
+  fprintf(stderr, "gdb: %s\n", msg);
+  exit(EXIT_FAILURE);
+}
+
+// Returns the next byte from the connection or -1 if it's closed.
+int gdbgetc(Gdb* g)
+{
+  if (g->inpos == g->inlen)
+  {
+    int n = recv(g->sock, (char*)g->in, sizeof g->in, 0);
+    if (n <= 0)
+      return -1;
+    g->inpos = 0;
+    g->inlen = n;
+  }
+  return g->in[g->inpos++];
+}
+
+// Returns 1 if a byte can be read without blocking.
+int gdbpending(Gdb* g)
+{
+  fd_set fds;
+  struct timeval tv = { 0, 0 };
+  if (g->inpos < g->inlen)
+    return 1;
+  FD_ZERO(&fds);
+  FD_SET(g->sock, &fds);
+  return select((int)g->sock + 1, &fds, NULL, NULL, &tv) > 0;
+}
+
+void gdbsendraw(Gdb* g, const char* s, uint n)
+{
+  while (n)
+  {
+    int k = send(g->sock, s, n, 0);
+    if (k <= 0)
+      gdbfail("connection lost");
+    s += k;
+    n -= k;
+  }
+}
+
+void gdbput(Gdb* g, const char* s)
+{
+  char buf[GDB_PKT_SIZE * 2 + 8];
+  uint n = 0, sum = 0;
+  buf[n++] = '$';
+  while (*s)
+  {
+    sum += (uchar)*s;
+    buf[n++] = *s++;
+  }
+  n += sprintf(buf + n, "#%02x", sum & 0xFF);
+  gdbsendraw(g, buf, n);
+}
+
+// Receives a packet into g->pkt. Returns 0 on success, 3 on Ctrl-C,
+// -1 if the connection is closed.
+int gdbget(Gdb* g)
+{
+  for (;;)
+  {
+    int ch, n = 0;
+    uint sum = 0, xsum;
+    do
+    {
+      if ((ch = gdbgetc(g)) < 0)
+        return -1;
+      if (ch == 3)
+        return 3;
+    } while (ch != '$');
+    while ((ch = gdbgetc(g)) >= 0 && ch != '#')
+    {
+      if (n < (int)sizeof g->pkt - 1)
+        g->pkt[n++] = ch;
+      sum += ch;
+    }
+    if (ch < 0)
+      return -1;
+    g->pkt[n] = '\0';
+    {
+      int h = gdbgetc(g), l = gdbgetc(g);
+      char hex[3];
+      if (h < 0 || l < 0)
+        return -1;
+      hex[0] = h;
+      hex[1] = l;
+      hex[2] = '\0';
+      xsum = strtoul(hex, NULL, 16);
+    }
+    if ((sum & 0xFF) == xsum)
+    {
+      gdbsendraw(g, "+", 1);
+      return 0;
+    }
+    gdbsendraw(g, "-", 1);
+  }
+}
+
+// Listens on 127.0.0.1:port and waits for the debugger to connect.
+void gdbopen(Gdb* g, uint port)
+{
+  struct sockaddr_in sa;
+  SOCKET ls;
+  int one = 1;
+#ifdef _WIN32
+  WSADATA wsa;
+  if (WSAStartup(MAKEWORD(2, 2), &wsa))
+    gdbfail("can't initialize sockets");
+#endif
+
+  memset(g, 0, sizeof *g);
+  if ((ls = socket(AF_INET, SOCK_STREAM, 0)) == INVALID_SOCKET)
+    gdbfail("can't create socket");
+  setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, (const char*)&one, sizeof one);
+  memset(&sa, 0, sizeof sa);
+  sa.sin_family = AF_INET;
+  sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  sa.sin_port = htons(port);
+  if (bind(ls, (struct sockaddr*)&sa, sizeof sa) || listen(ls, 1))
+    gdbfail("can't listen on the port");
+  fprintf(stderr, "gdb: waiting for connection on 127.0.0.1:%u\n", port);
+  if ((g->sock = accept(ls, NULL, NULL)) == INVALID_SOCKET)
+    gdbfail("can't accept connection");
+  closesocket(ls);
+  setsockopt(g->sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&one, sizeof one);
+  g->attached = 1;
+  g->state = GDB_STOP; // stop before the first instruction
+  g->sig = 5; // SIGTRAP
+}
+
+// The target description: the registers above, in the same order.
+const char gdbtdesc[] =
+  "<?xml version=\"1.0\"?>\n"
+  "<!DOCTYPE target SYSTEM \"gdb-target.dtd\">\n"
+  "<target version=\"1.0\">\n"
+  "<feature name=\"org.sedicipu2.core\">\n"
+  "<reg name=\"r0\" bitsize=\"16\" regnum=\"0\"/>\n"
+  "<reg name=\"r1\" bitsize=\"16\"/>\n"
+  "<reg name=\"r2\" bitsize=\"16\"/>\n"
+  "<reg name=\"r3\" bitsize=\"16\"/>\n"
+  "<reg name=\"r4\" bitsize=\"16\"/>\n"
+  "<reg name=\"r5\" bitsize=\"16\"/>\n"
+  "<reg name=\"sp\" bitsize=\"16\" type=\"data_ptr\"/>\n"
+  "<reg name=\"pc\" bitsize=\"16\" type=\"code_ptr\"/>\n"
+  "<reg name=\"flags\" bitsize=\"16\"/>\n"
+  "<reg name=\"ie\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel0\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel1\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel2\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel3\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel4\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel5\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel6\" bitsize=\"16\"/>\n"
+  "<reg name=\"sel7\" bitsize=\"16\"/>\n"
+  "</feature>\n"
+  "</target>\n";
+
+uint gdbreg(const Cpu* c, uint n)
+{
+  if (n < 8)
+    return c->r[n];
+  if (n == 8)
+    return c->flags;
+  if (n == 9)
+    return c->ie;
+  return c->sel[n - 10];
+}
+
+void gdbsetreg(Cpu* c, uint n, uint v)
+{
+  v &= 0xFFFF;
+  if (n < 8)
+    c->r[n] = (n >= 6) ? v & 0xFFFE : v; // sp and pc are even
+  else if (n == 8)
+    c->flags = v;
+  else if (n == 9)
+    c->ie = v & 1;
+  else if (n < GDB_NREGS)
+    c->sel[n - 10] = v & 0xFF;
+}
+
+// Translates a debugger address to a physical one. Returns 0 on failure.
+int gdbphys(const Cpu* c, ulong addr, ulong* pa)
+{
+  if (addr < GDB_DATA)
+    *pa = cpuphys(c, 1, addr);
+  else if (addr < GDB_DATA + 0x10000)
+    *pa = cpuphys(c, 0, addr - GDB_DATA);
+  else if (addr >= GDB_PHYS && addr < GDB_PHYS + MEM_SIZE)
+    *pa = addr - GDB_PHYS;
+  else
+    return 0;
+  return 1;
+}
+
+uint gdbhex(const char** s, uint ndigits)
+{
+  uint v = 0;
+  while (ndigits--)
+  {
+    char ch = *(*s)++;
+    v = v * 16 + ((ch >= 'a') ? ch - 'a' + 10 : (ch >= 'A') ? ch - 'A' + 10 : ch - '0');
+  }
+  return v;
+}
+
+void gdbstopreply(Gdb* g)
+{
+  char buf[64];
+  if (g->hittype)
+    sprintf(buf, "T05%swatch:%lx;",
+            (g->hittype == 2) ? "" : (g->hittype == 3) ? "r" : "a", g->hitaddr);
+  else
+    sprintf(buf, "S%02x", g->sig);
+  gdbput(g, buf);
+}
+
+// Handles the debugger's commands until it continues or steps.
+void gdbserve(Gdb* g, Cpu* c)
+{
+  char* out = malloc(GDB_PKT_SIZE * 2 + 8);
+  if (!out)
+    gdbfail("out of memory");
+  if (g->resumed)
+    gdbstopreply(g);
+  g->resumed = 0;
+
+  for (;;)
+  {
+    const char* p;
+    ulong addr, len, i, pa;
+    int r = gdbget(g);
+    if (r < 0)
+    {
+      // The debugger is gone, run freely.
+      g->attached = 0;
+      g->state = GDB_RUN;
+      break;
+    }
+    if (r == 3)
+      continue; // already stopped
+    p = g->pkt + 1;
+    out[0] = '\0';
+
+    switch (g->pkt[0])
+    {
+    case '?':
+      gdbstopreply(g);
+      continue;
+
+    case 'g':
+      for (i = 0; i < GDB_NREGS; i++)
+      {
+        uint v = gdbreg(c, i);
+        sprintf(out + i * 4, "%02x%02x", v & 0xFF, v >> 8);
+      }
+      break;
+
+    case 'G':
+      for (i = 0; i < GDB_NREGS && strlen(p) >= 4; i++)
+      {
+        uint lo = gdbhex(&p, 2);
+        gdbsetreg(c, i, lo | (gdbhex(&p, 2) << 8));
+      }
+      strcpy(out, "OK");
+      break;
+
+    case 'p':
+      i = strtoul(p, NULL, 16);
+      if (i < GDB_NREGS)
+      {
+        uint v = gdbreg(c, i);
+        sprintf(out, "%02x%02x", v & 0xFF, v >> 8);
+      }
+      else
+        strcpy(out, "E01");
+      break;
+
+    case 'P':
+    {
+      char* e;
+      i = strtoul(p, &e, 16);
+      if (*e == '=' && i < GDB_NREGS && strlen(e + 1) >= 4)
+      {
+        uint lo;
+        p = e + 1;
+        lo = gdbhex(&p, 2);
+        gdbsetreg(c, i, lo | (gdbhex(&p, 2) << 8));
+        strcpy(out, "OK");
+      }
+      else
+        strcpy(out, "E01");
+      break;
+    }
+
+    case 'm':
+    case 'M':
+    {
+      char* e;
+      addr = strtoul(p, &e, 16);
+      len = (*e == ',') ? strtoul(e + 1, &e, 16) : 0;
+      if (len > GDB_PKT_SIZE / 2)
+        len = GDB_PKT_SIZE / 2;
+      if (g->pkt[0] == 'M')
+      {
+        if (*e++ != ':' || strlen(e) < len * 2)
+        {
+          strcpy(out, "E01");
+          break;
+        }
+        p = e;
+      }
+      for (i = 0; i < len; i++)
+      {
+        if (!gdbphys(c, addr + i, &pa))
+          break;
+        if (g->pkt[0] == 'm')
+          sprintf(out + i * 2, "%02x", c->mem[pa]);
+        else
+          c->mem[pa] = gdbhex(&p, 2); // the debugger may patch the ROM
+      }
+      if (i < len && !i)
+        strcpy(out, "E01");
+      else if (g->pkt[0] == 'M')
+        strcpy(out, (i == len) ? "OK" : "E01");
+      break;
+    }
+
+    case 'c':
+    case 's':
+      if (*p)
+        c->r[7] = strtoul(p, NULL, 16) & 0xFFFE;
+      g->state = (g->pkt[0] == 's') ? GDB_STEP : GDB_RUN;
+      g->resumed = 1;
+      g->hittype = 0;
+      g->sig = 5; // SIGTRAP
+      g->nextpoll = c->cycles + GDB_POLL;
+      free(out);
+      return;
+
+    case 'Z':
+    case 'z':
+    {
+      uint type = g->pkt[1] - '0';
+      char* e;
+      if (g->pkt[2] != ',' || type > 4)
+        break; // unsupported
+      addr = strtoul(g->pkt + 3, &e, 16);
+      len = (*e == ',') ? strtoul(e + 1, NULL, 16) : 1;
+      if (type <= 1)
+      {
+        if (addr >= GDB_DATA)
+        {
+          strcpy(out, "E01");
+          break;
+        }
+        g->bp[addr >> 1] = g->pkt[0] == 'Z';
+      }
+      else if (g->pkt[0] == 'Z')
+      {
+        if (g->nwp == GDB_MAX_WP)
+        {
+          strcpy(out, "E01");
+          break;
+        }
+        g->wp[g->nwp].type = type;
+        g->wp[g->nwp].addr = addr;
+        g->wp[g->nwp].len = len;
+        g->nwp++;
+      }
+      else
+      {
+        for (i = 0; i < g->nwp; i++)
+          if (g->wp[i].type == type && g->wp[i].addr == addr && g->wp[i].len == len)
+          {
+            g->wp[i] = g->wp[--g->nwp];
+            break;
+          }
+      }
+      strcpy(out, "OK");
+      break;
+    }
+
+    case 'k':
+      closesocket(g->sock);
+      exit(EXIT_FAILURE);
+
+    case 'D':
+      gdbput(g, "OK");
+      closesocket(g->sock);
+      g->attached = 0;
+      g->state = GDB_RUN;
+      free(out);
+      return;
+
+    case 'q':
+      if (!strncmp(g->pkt, "qSupported", 10))
+        sprintf(out, "PacketSize=%x;qXfer:features:read+", GDB_PKT_SIZE);
+      else if (!strncmp(g->pkt, "qXfer:features:read:", 20))
+      {
+        // qXfer:features:read:target.xml:offset,length
+        char* e;
+        ulong size = sizeof gdbtdesc - 1;
+        p = g->pkt + 20;
+        if (strncmp(p, "target.xml:", 11))
+        {
+          strcpy(out, "E00");
+          break;
+        }
+        addr = strtoul(p + 11, &e, 16);
+        len = (*e == ',') ? strtoul(e + 1, NULL, 16) : 0;
+        if (len > GDB_PKT_SIZE - 1)
+          len = GDB_PKT_SIZE - 1;
+        if (addr > size)
+          addr = size;
+        if (len > size - addr)
+          len = size - addr;
+        // The description has no characters to escape ($, #, }, *).
+        out[0] = (addr + len < size) ? 'm' : 'l';
+        memcpy(out + 1, gdbtdesc + addr, len);
+        out[1 + len] = '\0';
+      }
+      else if (!strcmp(g->pkt, "qAttached"))
+        strcpy(out, "1");
+      else if (!strncmp(g->pkt, "qRcmd,", 6))
+      {
+        char cmd[64];
+        uint irq;
+        p = g->pkt + 6;
+        for (i = 0; i < sizeof cmd - 1 && strlen(p) >= 2; i++)
+          cmd[i] = gdbhex(&p, 2);
+        cmd[i] = '\0';
+        if (sscanf(cmd, "irq %u", &irq) == 1 && irq < IRQ_CNT)
+        {
+          g->irqs |= 1U << irq;
+          strcpy(out, "OK");
+        }
+        else
+          strcpy(out, "E01");
+      }
+      break;
+    }
+
+    gdbput(g, out);
+  }
+  free(out);
+}
+
+// To be called before every fetch cycle.
+void gdbfetch(Gdb* g, Cpu* c)
+{
+  if (!g->attached)
+    return;
+  if (g->bp[c->r[7] >> 1] || g->state != GDB_RUN)
+    gdbserve(g, c);
+  else if (c->cycles >= g->nextpoll)
+  {
+    g->nextpoll = c->cycles + GDB_POLL;
+    if (gdbpending(g))
+    {
+      int ch = gdbgetc(g);
+      if (ch == 3 || ch < 0)
+      {
+        g->sig = 2; // SIGINT
+        gdbserve(g, c);
+      }
+    }
+  }
+  // Stop before the next instruction after this one when stepping.
+  if (g->state == GDB_STEP)
+    g->state = GDB_STOP;
+}
+
+// To be called after every clock cycle.
+void gdbcycle(Gdb* g, const Cpu* c)
+{
+  uint i;
+  if (!g->nwp || !(c->lacc & (ACC_READ | ACC_WRITE)) || (c->lacc & ACC_FETCH))
+    return;
+  for (i = 0; i < g->nwp; i++)
+  {
+    const GdbWatch* w = &g->wp[i];
+    uint n = (c->lacc & ACC_W16) ? 2 : 1;
+    ulong a;
+    if (w->type == 2 && !(c->lacc & ACC_WRITE))
+      continue;
+    if (w->type == 3 && !(c->lacc & ACC_READ))
+      continue;
+    if (w->addr >= GDB_PHYS)
+      a = GDB_PHYS + c->lpa;
+    else
+      a = ((c->lacc & ACC_CODE) ? GDB_CODE : GDB_DATA) + c->lla;
+    if (n == 2)
+      a &= ~1UL;
+    if (a < w->addr + w->len && w->addr < a + n)
+    {
+      g->hittype = w->type;
+      g->hitaddr = (a < w->addr) ? w->addr : a;
+      g->state = GDB_STOP;
+      break;
+    }
+  }
+}
+
+// Reports the end of the program to the debugger.
+void gdbexit(Gdb* g, int code)
+{
+  char buf[8];
+  if (!g->attached)
+    return;
+  sprintf(buf, "W%02x", code & 0xFF);
+  gdbput(g, buf);
+  closesocket(g->sock);
+}
+
+#endif
@@ -0,0 +1,585 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 instruction set specification.
+
+  One table per variant describes every instruction encoding the way the
+  encoding lists in SediCiPUv2.md do (sections 4.3.1 and 4.5.1):
+  - enc: 16 characters, bit 15 first: 0 and 1 are fixed bits, ? and I
+    are ignored bits (encoded as 0s and 1s), any other character is a
+    bit of the field named by it (bits of a field may be scattered,
+    they're taken most significant first):
+      r rrr   R RRR   P PPP   q qqq   Q Q   w w
+      4 imm4  7 imm7  9 imm9  e imm11  c condition  C condition bit 3
+      o ALU op  n register pair number (addm, subm, mrs, pop)
+  - when: space-separated constraints on the fields, all of which must
+    hold, e.g. "r=sp R<sp" or "r=R"; values are numbers, sp (6), pc (7)
+    or other fields
+  - name: the mnemonic, "?" for reserved encodings; %c is replaced with
+    the condition and %o with the ALU operation
+  - ops: the operand template; the words below are replaced with the
+    field values, everything else is copied:
+      rrr RRR PPP qqq  registers
+      imm4 imm7 simm7 ximm7 imm9 simm9  immediates
+      imm6*2 simm6*2 simm7*2 simm8*2 simm11*2  doubled immediates
+      addm subm mrs rPQ  register pairs
+  - k: addm and subm base numbers
+  - mac: the name of the encoder macro (ENC_name) that mkisaenc.c
+    generates from the entry for the assembler macros of mktesti.c, ""
+    for none
+
+  The entries are tried in order, the first one whose fixed bits and
+  constraints match an instruction word describes it. Every word matches
+  some entry.
+
+  The decoder ROMs are checked against these tables (isachkdrom()) by
+  mkdrom.c and mkdrom_mini.c as they generate them and by isachk.c, the
+  assembler macros (mktesti.c) are built on the encoders generated from
+  them (isaenc.h).
+
+  The header is meant to be included after emu.h (or after the same
+  uchar, ushort, uint and ulong typedefs and the standard headers).
+*/
+
+
+#ifndef ISA_H
+#define ISA_H
+
+typedef struct
+{
+  const char* enc;
+  const char* when;
+  const char* name;
+  const char* ops;
+  int k;
+  const char* mac;
+} IsaSpec;
+
+static const IsaSpec isa_full[] =
+{
+  // 00w: lb/lw
+  { "000rrrRRR7777777", "r=sp R<sp", "and",         "RRR, imm7",           0,  "ANDI" },
+  { "000rrrRRR7777777", "r=pc R<sp", "or",          "RRR, imm7",           0,  "ORI" },
+  { "0001101107777777", "",          "addm",        "addm",                0,  "ADDM0" },
+  { "0001101117777777", "",          "addm",        "addm",                1,  "ADDM1" },
+  { "0001111107777777", "",          "addm",        "addm",                2,  "ADDM2" },
+  { "0001111117777777", "",          "addm",        "addm",                3,  "ADDM3" },
+  { "000rrrRRR7777777", "",          "lb",          "rrr, (RRR + ximm7)",  0,  "LB" },
+  { "001rrr1100?????1", "r<sp",      "incm",        "(rrr)",               0,  "INCM" },
+  { "001rrr1101IIIII1", "r<sp",      "decm",        "(rrr)",               0,  "DECM" },
+  { "001rrr111??????1", "r<sp",      "adcz",        "rrr",                 0,  "ADCZ" },
+  { "001rrrRRR7777777", "",          "lw",          "rrr, (RRR + ximm7)",  0,  "LW" },
+
+  // 01w: sb/sw
+  { "010rrrRRR7777777", "r=sp R<sp", "xor",         "RRR, imm7",           0,  "XORI" },
+  { "010rrrRRR7777777", "r=pc R<sp", "cmp",         "RRR, simm7",          0,  "CMPI" },
+  { "0101101107777777", "",          "addm",        "addm",                4,  "ADDM4" },
+  { "0101101117777771", "",          "push",        "r0",                  0,  "" },
+  { "0101101117777777", "",          "addm",        "addm",                5,  "ADDM5" },
+  { "0101111107777777", "",          "addm",        "addm",                6,  "ADDM6" },
+  { "0101111117777777", "",          "addm",        "addm",                7,  "ADDM7" },
+  { "0101011017777771", "",          "push",        "r2",                  0,  "" },
+  { "010nnnRRR7777777", "n=R n<sp",  "subm",        "subm",                0,  "SUBM0" },
+  { "010rrrRRR7777777", "",          "sb",          "rrr, (RRR + ximm7)",  0,  "SB" },
+  { "0111011017777771", "",          "push",        "r3",                  0,  "" },
+  { "011nnnRRR7777777", "n=R n<sp",  "subm",        "subm",                1,  "SUBM1" },
+  { "0111111017777771", "",          "push",        "r4",                  0,  "" },
+  { "011111nnn7777777", "n<sp",      "subm",        "subm",                2,  "SUBM2" },
+  { "0111111107777777", "",          "addm",        "addm",                12, "ADDM12" },
+  { "0111111117777777", "",          "addm",        "addm",                13, "ADDM13" },
+  { "011rrr110??????1", "r<sp",      "dincm",       "(rrr)",               0,  "DINCM" },
+  { "011rrr111??????1", "r<sp",      "ddecm",       "(rrr)",               0,  "DDECM" },
+  { "011rrrRRR7777777", "",          "sw",          "rrr, (RRR + ximm7)",  0,  "SW" },
+
+  // 100: add
+  { "1001101107777771", "",          "swi",         "simm6*2",             0,  "SWI" },
+  { "1001101117777777", "",          "push",        "simm7",               0,  "PUSHI" },
+  { "1001111107777777", "",          "addm",        "addm",                8,  "ADDM8" },
+  { "1001111117777777", "",          "addm",        "addm",                9,  "ADDM9" },
+  { "100110RRR7777771", "",          "?",           "",                    0,  "" },
+  { "100rrrRRR7777777", "",          "add",         "rrr, RRR, simm7",     0,  "ADDI" },
+
+  // 101: li/addu
+  { "1011111017777771", "",          "push",        "r5",                  0,  "" },
+  { "101111nnn7777777", "n<sp",      "subm",        "subm",                3,  "SUBM3" },
+  { "1011111117777771", "",          "push",        "r1",                  0,  "" },
+  { "1011111107777777", "",          "addm",        "addm",                10, "ADDM10" },
+  { "1011111117777777", "",          "addm",        "addm",                11, "ADDM11" },
+  { "1011100999999991", "",          "j",           "simm8*2",             0,  "J" },
+  { "1011100999999990", "",          "?",           "",                    0,  "" },
+  { "101rrr0999999999", "",          "li",          "rrr, simm9",          0,  "LI" },
+  { "101rrr1999999999", "",          "addu",        "rrr, imm9",           0,  "ADDU" },
+
+  // 110: jal/lurpc/incm...
+  { "11011eeeeeeeeeee", "",          "jal",         "simm11*2",            0,  "JAL" },
+  { "110rrr1999999999", "",          "lurpc",       "rrr, imm9",           0,  "LURPC" },
+  { "1101010007777771", "",          "last",        "imm6*2",              0,  "LAST" },
+  { "110rrr000??????1", "",          "ls5r",        "rrr",                 0,  "LS5R" },
+  { "110rrr001??????1", "r<5",       "ss5r",        "rrr",                 0,  "SS5R" },
+  { "110rrr0017777771", "",          "?",           "",                    0,  "" },
+  { "110rrr01?7777771", "",          "?",           "",                    0,  "" },
+  { "110rrr0007777777", "",          "incm/incs",   "rrr, (sp + imm7)",    0,  "INCS" },
+  { "110rrr0017777777", "",          "decm/decs",   "rrr, (sp + imm7)",    0,  "DECS" },
+  { "110rrr0107777777", "",          "dincm/dincs", "rrr, (sp + imm7)",    0,  "DINCS" },
+  { "110rrr0117777777", "",          "ddecm/ddecs", "rrr, (sp + imm7)",    0,  "DDECS" },
+
+  // 111, m=00C: j<cond>, mrs, stc
+  { "111ccc0007777777", "",          "j%c",         "simm7*2",             0,  "" },
+  { "111ccc00C7777777", "c<6",       "j%c",         "simm7*2",             0,  "JCC" },
+  { "11111n001nnnnIII", "n<30",      "mrs",         "mrs",                 0,  "MRS" },
+  { "1111110011110III", "",          "stc",         "",                    0,  "STC" },
+  { "1111110011111III", "",          "?",           "",                    0,  "" },
+
+  // 111, m=01R: addm14...29
+  { "111nnn01n7777777", "",          "addm",        "addm",                14, "ADDM14" },
+
+  // 111, m=100: subm4x, zxt...
+  { "1111111001110III", "",          "mf2",         "",                    0,  "MF2" },
+  { "1111111001111III", "",          "m2f",         "",                    0,  "M2F" },
+  { "11111n10011nnIII", "",          "pop",         "rPQ",                 0,  "POP" },
+  { "111110100PPP0III", "",          "zxt",         "PPP",                 0,  "ZXT" },
+  { "111110100PPP1III", "",          "sxt",         "PPP",                 0,  "SXT" },
+  { "111111100PPP0III", "",          "cpl",         "PPP",                 0,  "CPL" },
+  { "111111100PPP1III", "",          "neg",         "PPP",                 0,  "NEG" },
+  { "111nnn1007777777", "",          "subm",        "subm",                4,  "SUBM4" },
+
+  // 111, m=101: sac...
+  { "1111101011100III", "",          "di",          "",                    0,  "DI" },
+  { "1111101011101III", "",          "ei",          "",                    0,  "EI" },
+  { "1111101011110III", "",          "reti",        "",                    0,  "RETI" },
+  { "1111101011111III", "",          "?",           "",                    0,  "" },
+  { "1111111011100III", "",          "add22adc33",  "",                    0,  "ADD22ADC33" },
+  { "1111111011101III", "",          "cadd24",      "",                    0,  "CADD24" },
+  { "1111111011110III", "",          "cadd24adc3z", "",                    0,  "CADD24ADC3Z" },
+  { "1111111011111III", "",          "csub34",      "",                    0,  "CSUB34" },
+  { "111110101PPP4444", "",          "sr",          "PPP, imm4",           0,  "SRI" },
+  { "111111101PPP4444", "",          "sl",          "PPP, imm4",           0,  "SLI" },
+  { "111rrr1011104444", "",          "asr",         "rrr, imm4",           0,  "ASRI" },
+  { "111rrr1011114444", "",          "rl",          "rrr, imm4",           0,  "RLI" },
+  { "111rrr101PPP4444", "",          "sac",         "rrr, PPP, imm4",      0,  "SAC" },
+
+  // 111, m=11w: lb/lw/sb/sw, ALU
+  { "111rrr1101100qqq", "r<sp",      "sr",          "rrr, qqq",            0,  "SR" },
+  { "111rrr1101101qqq", "r<sp",      "sl",          "rrr, qqq",            0,  "SL" },
+  { "111rrr1111100qqq", "r<sp",      "rr",          "rrr, qqq",            0,  "RR" },
+  { "111rrr1111101qqq", "r<sp",      "rl",          "rrr, qqq",            0,  "RL" },
+  { "111rrr1101110qqq", "r<sp",      "asr",         "rrr, qqq",            0,  "ASR" },
+  { "111rrr1101111qqq", "r<sp",      "xor",         "rrr, qqq",            0,  "XOR" },
+  { "111rrr1111110qqq", "r<sp",      "and",         "rrr, qqq",            0,  "AND" },
+  { "111rrr1111111qqq", "r<sp",      "or",          "rrr, qqq",            0,  "OR" },
+  { "111rrr11?11??qqq", "",          "?",           "",                    0,  "" },
+  { "111110110PPP0qqq", "",          "adc",         "PPP, qqq",            0,  "ADC" },
+  { "111110110PPP1qqq", "",          "sbb",         "PPP, qqq",            0,  "SBB" },
+  { "111111110PPP0qqq", "",          "add",         "PPP, qqq",            0,  "ADD" },
+  { "111111110PPP1qqq", "",          "sub",         "PPP, qqq",            0,  "SUB" },
+  { "111111111PPP1qqq", "",          "cmp",         "PPP, qqq",            0,  "CMP" },
+  { "111rrr110PPP1qqq", "r=P",       "mov",         "rrr, qqq",            0,  "MOV" },
+  { "111rrr111PPP1qqq", "r=P",       "msr",         "rrr, qqq",            0,  "MSR" },
+  { "111rrr110PPP0qqq", "",          "lb",          "rrr, (PPP + qqq)",    0,  "LB2" },
+  { "111rrr111PPP0qqq", "",          "lw",          "rrr, (PPP + qqq)",    0,  "LW2" },
+  { "111rrr110PPP1qqq", "",          "sb",          "rrr, (PPP + qqq)",    0,  "SB2" },
+  { "111rrr111PPP1qqq", "r<pc",      "sw",          "rrr, (PPP + qqq)",    0,  "SW2" },
+
+  { "????????????????", "",          "?",           "",                    0,  "" }
+};
+
+static const IsaSpec isa_mini[] =
+{
+  // 00w: lb/lw
+  { "000rrrRRR7777777", "r=sp",      "and",         "RRR, imm7",           0,  "ANDI" },
+  { "000rrrRRR7777777", "r=pc",      "or",          "RRR, imm7",           0,  "ORI" },
+  { "000rrrRRR7777777", "",          "lb",          "rrr, (RRR + simm7)",  0,  "LB" },
+  { "001rrrRRR7777777", "",          "lw",          "rrr, (RRR + simm7)",  0,  "LW" },
+
+  // 01w: sb/sw
+  { "010rrrRRR7777777", "r=sp",      "xor",         "RRR, imm7",           0,  "XORI" },
+  { "010rrrRRR7777777", "r=pc",      "cmp",         "RRR, simm7",          0,  "CMPI" },
+  { "010rrrRRR7777777", "",          "sb",          "rrr, (RRR + simm7)",  0,  "SB" },
+  { "011111III7777777", "",          "push",        "simm7",               0,  "PUSHI" },
+  { "011rrrRRR7777777", "",          "sw",          "rrr, (RRR + simm7)",  0,  "SW" },
+
+  // 100: add
+  { "100110III7777771", "",          "swi",         "simm6*2",             0,  "SWI" },
+  { "100rrrRRR7777777", "r=sp R=pc", "?",           "",                    0,  "" },
+  { "100rrrRRR7777777", "r=pc R>=sp", "?",          "",                    0,  "" },
+  { "100rrrRRR7777777", "",          "add",         "rrr, RRR, simm7",     0,  "ADDI" },
+
+  // 101: li/addu
+  { "101110III7777770", "",          "last",        "imm6*2",              0,  "LAST" },
+  { "101111RRR7777770", "",          "decs",        "RRR, (sp + simm6*2)", 0,  "DECS" },
+  { "101rrr9999999990", "",          "li",          "rrr, simm9",          0,  "LI" },
+  { "10111199999999?1", "",          "j",           "simm8*2",             0,  "J" },
+  { "101rrr9999999991", "",          "addu",        "rrr, imm9",           0,  "ADDU" },
+
+  // 110: jal/lurpc/MULDIVHELPER
+  { "11011eeeeeeeeeee", "",          "jal",         "simm11*2",            0,  "JAL" },
+  { "110rrr9999999990", "",          "lurpc",       "rrr, imm9",           0,  "LURPC" },
+  { "110000IIIIIIIII1", "",          "add22adc33",  "",                    0,  "ADD22ADC33" },
+  { "110001IIIIIIIII1", "",          "cadd24",      "",                    0,  "CADD24" },
+  { "110010IIIIIIIII1", "",          "cadd24adc3z", "",                    0,  "CADD24ADC3Z" },
+  { "110011IIIIIIIII1", "",          "csub34",      "",                    0,  "CSUB34" },
+  { "110100IIIIIIIII1", "",          "mf2",         "",                    0,  "MF2" },
+  { "110101IIIIIIIII1", "",          "m2f",         "",                    0,  "M2F" },
+
+  // 111
+  { "111rrrIII0001110", "",          "zxt",         "rrr",                 0,  "ZXT" },
+  { "111rrrIII1001110", "",          "sxt",         "rrr",                 0,  "SXT" },
+  { "111rrrIII0001111", "",          "cpl",         "rrr",                 0,  "CPL" },
+  { "111rrrIII1001111", "",          "neg",         "rrr",                 0,  "NEG" },
+  { "111777777700cccc", "",          "j%c",         "simm7*2",             0,  "JCC" },
+  { "111rrrRRR0011110", "",          "msr",         "RRR, rrr",            0,  "MSR" },
+  { "111rrrRRR0011111", "",          "mrs",         "rrr, RRR",            0,  "MRS" },
+  { "111rrrRRR001oooo", "",          "%o",          "rrr, RRR",            0,  "ALU" },
+  { "111rrrIII1010000", "",          "adcz",        "rrr",                 0,  "ADCZ" },
+  { "111rrrRRR1014444", "",          "sac",         "rrr, RRR, imm4",      0,  "SAC" },
+  { "111rrrIII0100000", "",          "push",        "rrr",                 0,  "PUSH" },
+  { "111rrrIII0104444", "",          "asr",         "rrr, imm4",           0,  "ASRI" },
+  { "111rrrIII1100000", "",          "pop",         "rrr",                 0,  "POP" },
+  { "111rrrIII1104444", "",          "rl",          "rrr, imm4",           0,  "RLI" },
+  { "111IIIIII0110000", "",          "reti",        "",                    0,  "RETI" },
+  { "111rrrIII0114444", "",          "sr",          "rrr, imm4",           0,  "SRI" },
+  { "111rrrRRR1110000", "",          "lw",          "rrr, (RRR + pc)",     0,  "LWP" },
+  { "111rrrRRR1110001", "",          "sw",          "rrr, (RRR + pc)",     0,  "SWP" },
+  { "111rrrIII1114444", "",          "sl",          "rrr, imm4",           0,  "SLI" },
+
+  { "????????????????", "",          "?",           "",                    0,  "" }
+};
+
+const char* const isa_regs[8] = { "r0", "r1", "r2", "r3", "r4", "r5", "sp", "pc" };
+
+const char* const isa_conds[16] =
+{
+  "c", "z", "s", "leu", "l", "le", "o", "no",
+  "nc", "nz", "ns", "gu", "ge", "g", "?", "?"
+};
+
+// The MINI's ALU rrr, RRR operations.
+const char* const isa_aluops[16] =
+{
+  "sr", "sl", "rr", "rl", "asr", "xor", "and", "or",
+  "adc", "sbb", "add", "sub", "cmp", "mov", "?", "?"
+};
+
+const IsaSpec* isatab;     // isa_full or isa_mini
+uint isacnt;               // entries in isatab
+ushort isapd[0x10000];     // predecoded instructions: isatab index per instruction word
+
+// Extracts field f of instr, optionally returning its width.
+uint isafield(const char* enc, uint instr, int f, uint* width)
+{
+  uint v = 0, w = 0, i;
+  for (i = 0; i < 16; i++)
+    if (enc[i] == f)
+    {
+      v = (v << 1) | ((instr >> (15 - i)) & 1);
+      w++;
+    }
+  if (width)
+    *width = w;
+  return v;
+}
+
+// Parses a constraint value: a number, sp, pc or a field.
+uint isawhenval(const char** p, const char* enc, uint instr)
+{
+  const char* s = *p;
+  uint v = 0;
+  if (*s >= '0' && *s <= '9')
+  {
+    while (*s >= '0' && *s <= '9')
+      v = v * 10 + *s++ - '0';
+  }
+  else if (!strncmp(s, "sp", 2) || !strncmp(s, "pc", 2))
+  {
+    v = (*s == 's') ? 6 : 7;
+    s += 2;
+  }
+  else
+    v = isafield(enc, instr, *s++, NULL);
+  *p = s;
+  return v;
+}
+
+// Checks if instr is described by the spec entry.
+int isaholds(const IsaSpec* s, uint instr)
+{
+  const char* p = s->when;
+  uint i;
+  for (i = 0; i < 16; i++)
+    if ((s->enc[i] == '0' || s->enc[i] == '1') &&
+        (uint)(s->enc[i] - '0') != ((instr >> (15 - i)) & 1))
+      return 0;
+  while (*p)
+  {
+    uint a, b;
+    char op[3] = { 0 };
+    int ok;
+    a = isafield(s->enc, instr, *p++, NULL);
+    for (i = 0; i < 2 && (*p == '=' || *p == '!' || *p == '<' || *p == '>'); i++)
+      op[i] = *p++;
+    b = isawhenval(&p, s->enc, instr);
+    if (!strcmp(op, "="))
+      ok = a == b;
+    else if (!strcmp(op, "!="))
+      ok = a != b;
+    else if (!strcmp(op, "<"))
+      ok = a < b;
+    else if (!strcmp(op, ">="))
+      ok = a >= b;
+    else
+    {
+      fprintf(stderr, "Bad constraint \"%s\" for \"%s\"\n", s->when, s->enc);
+      exit(EXIT_FAILURE);
+    }
+    if (!ok)
+      return 0;
+    while (*p == ' ')
+      p++;
+  }
+  return 1;
+}
+
+// Builds the predecoded instruction table for the variant.
+void isainit(int mini)
+{
+  uint instr;
+  isatab = mini ? isa_mini : isa_full;
+  isacnt = mini ? sizeof isa_mini / sizeof isa_mini[0] : sizeof isa_full / sizeof isa_full[0];
+  for (instr = 0; instr < 0x10000; instr++)
+  {
+    uint i = 0;
+    while (!isaholds(&isatab[i], instr))
+      i++;
+    isapd[instr] = i;
+  }
+}
+
+int isavalid(uint instr)
+{
+  return isatab[isapd[instr]].name[0] != '?';
+}
+
+// Encodes an instruction from the field values (indexed by field names).
+// Ignored bits are encoded as 1s if they're III and as 0s otherwise.
+// Returns -1 if the values don't fit or the result isn't described by
+// the entry.
+long isaenc(const IsaSpec* s, const uint f[128])
+{
+  uint instr = 0, i;
+  for (i = 0; i < 16; i++)
+  {
+    uint c = (uchar)s->enc[i], bit;
+    if (c == '0' || c == '1')
+      bit = c - '0';
+    else if (c == '?')
+      bit = 0;
+    else if (c == 'I')
+      bit = 1;
+    else
+    {
+      uint w, pos = 0, j;
+      isafield(s->enc, 0, c, &w);
+      for (j = i + 1; j < 16; j++)
+        pos += s->enc[j] == (int)c;
+      if (f[c] >> w)
+        return -1;
+      bit = (f[c] >> pos) & 1;
+    }
+    instr = (instr << 1) | bit;
+  }
+  return (&isatab[isapd[instr]] == s) ? (long)instr : -1;
+}
+
+// Sign-extends the w-bit field value v.
+int isasigned(uint v, uint w)
+{
+  return (int)(v ^ (1U << (w - 1))) - (int)(1U << (w - 1));
+}
+
+// Disassembles instr into buf (at least 64 chars).
+void isadis(uint instr, char* buf)
+{
+  const IsaSpec* s = &isatab[isapd[instr]];
+  const char* e = s->enc;
+  const char* p;
+  char* b = buf;
+
+  for (p = s->name; *p; p++)
+    if (*p == '%' && p[1] == 'c')
+      b += sprintf(b, "%s", isa_conds[isafield(e, instr, 'C', NULL) * 8 + isafield(e, instr, 'c', NULL)]), p++;
+    else if (*p == '%' && p[1] == 'o')
+      b += sprintf(b, "%s", isa_aluops[isafield(e, instr, 'o', NULL)]), p++;
+    else
+      *b++ = *p;
+
+  if (*s->ops)
+    do
+      *b++ = ' ';
+    while (b - buf < 8);
+
+  for (p = s->ops; *p; )
+  {
+    static const struct { const char* tok; char f; char kind; } toks[] =
+    {
+      // kind: r = register, u = unsigned, s = signed, U/S = doubled,
+      // x = ximm7, a = addm, m = subm, M = mrs, p = pop
+      { "simm11*2", 'e', 'S' }, { "simm8*2", '9', 'S' }, { "simm7*2", '7', 'S' },
+      { "simm6*2", '7', 'S' }, { "imm6*2", '7', 'U' },
+      { "simm7", '7', 's' }, { "simm9", '9', 's' }, { "ximm7", '7', 'x' },
+      { "imm4", '4', 'u' }, { "imm7", '7', 'u' }, { "imm9", '9', 'u' },
+      { "rrr", 'r', 'r' }, { "RRR", 'R', 'r' }, { "PPP", 'P', 'r' }, { "qqq", 'q', 'r' },
+      { "addm", 'n', 'a' }, { "subm", 'n', 'm' }, { "mrs", 'n', 'M' }, { "rPQ", 'n', 'p' }
+    };
+    uint i, n = sizeof toks / sizeof toks[0];
+    for (i = 0; i < n; i++)
+      if (!strncmp(p, toks[i].tok, strlen(toks[i].tok)))
+        break;
+    if (i == n)
+    {
+      *b++ = *p++;
+      continue;
+    }
+    p += strlen(toks[i].tok);
+    {
+      uint w, v = isafield(e, instr, toks[i].f, &w);
+      uint dst, src;
+      switch (toks[i].kind)
+      {
+      case 'r': b += sprintf(b, "%s", isa_regs[v]); break;
+      case 'u': b += sprintf(b, "%u", v); break;
+      case 's': b += sprintf(b, "%d", isasigned(v, w)); break;
+      case 'U': b += sprintf(b, "%u", v * 2); break;
+      case 'S': b += sprintf(b, "%d", 2 * isasigned(v, w)); break;
+      case 'x':
+        // unsigned if added to sp
+        if (isafield(e, instr, 'R', NULL) == 6)
+          b += sprintf(b, "%u", v);
+        else
+          b += sprintf(b, "%d", isasigned(v, w));
+        break;
+      case 'a':
+      case 'm':
+        if (toks[i].kind == 'a')
+        {
+          v += s->k;
+          dst = v / 6;
+          src = v % 6 + (v % 6 >= v / 6);
+        }
+        else
+        {
+          dst = s->k;
+          src = v + (v >= dst);
+        }
+        v = isafield(e, instr, '7', &w);
+        if (src == 6)
+          b += sprintf(b, "%s, (%s + %u)", isa_regs[dst], isa_regs[src], v);
+        else
+          b += sprintf(b, "%s, (%s + %d)", isa_regs[dst], isa_regs[src], isasigned(v, w));
+        break;
+      case 'M': b += sprintf(b, "%s, %s", isa_regs[v / 5], isa_regs[v % 5 + (v % 5 >= v / 5)]); break;
+      case 'p': b += sprintf(b, "%s", isa_regs[v]); break;
+      }
+    }
+  }
+  *b = '\0';
+}
+
+enum
+{
+  ISA_MAX_REPORT = 8 // mismatches to report per specification entry
+};
+
+// Checks the decoder ROM against the specification: every specified
+// instruction word has microcode, every reserved one has the filler row
+// unless the row is shared with specified instructions, every specified
+// one can be reencoded from its fields. idx() maps an instruction word to
+// its execute1 row. Prints up to ISA_MAX_REPORT mismatches per entry to f
+// and returns the number of mismatches.
+ulong isachkdrom(const ulong* drom, uint (*idx)(uint), ulong filler, FILE* f)
+{
+  static uchar shared[0x10000]; // rows of specified instructions
+  ulong errors = 0;
+  uint i, instr;
+
+  memset(shared, 0, sizeof shared);
+  for (instr = 0; instr < 0x10000; instr++)
+    if (isavalid(instr))
+      shared[idx(instr)] = 1;
+
+  for (i = 0; i < isacnt; i++)
+  {
+    const IsaSpec* s = &isatab[i];
+    ulong nwords = 0, nbad = 0;
+    for (instr = 0; instr < 0x10000; instr++)
+    {
+      int implemented = drom[idx(instr)] != filler;
+      const char* why = NULL;
+      if (isapd[instr] != i)
+        continue;
+      nwords++;
+      if (isavalid(instr) && !implemented)
+        why = "specified, but has no microcode";
+      else if (!isavalid(instr) && implemented && !shared[idx(instr)])
+        why = "reserved, but has microcode";
+      else if (isavalid(instr))
+      {
+        uint fv[128] = { 0 }, j;
+        long e;
+        for (j = 0; j < 16; j++)
+          fv[(uchar)s->enc[j]] = isafield(s->enc, instr, s->enc[j], NULL);
+        e = isaenc(s, fv);
+        if (e < 0)
+          why = "can't be reencoded";
+        else
+        {
+          uint ign = 0;
+          for (j = 0; j < 16; j++)
+            if (s->enc[j] == '?' || s->enc[j] == 'I')
+              ign |= 0x8000U >> j;
+          if (((uint)e ^ instr) & ~ign)
+            why = "reencodes differently";
+        }
+      }
+      if (why)
+      {
+        char dis[64];
+        if (nbad++ < ISA_MAX_REPORT)
+        {
+          isadis(instr, dis);
+          fprintf(f, "%04X  %-28s %s %s: %s\n", instr, dis, s->enc, s->name, why);
+        }
+      }
+    }
+    if (!nwords && strcmp(s->enc, "????????????????"))
+      fprintf(f, "%s %s: describes no instruction\n", s->enc, s->name), nbad++;
+    else if (nbad > ISA_MAX_REPORT)
+      fprintf(f, "%s %s: %lu more\n", s->enc, s->name, nbad - ISA_MAX_REPORT);
+    errors += nbad;
+  }
+  return errors;
+}
+
+#endif
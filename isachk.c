@@ -0,0 +1,162 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 instruction set specification checker.
+
+  Checks the decoder ROM and, optionally, a program ROM against the
+  instruction set specification in isa.h:
+  - every instruction word described by the specification has microcode
+    in the decoder ROM and every reserved one has the filler row (the
+    pc = pc + (-2) infinite loop) unless the row is shared with specified
+    instructions (the instruction compressor ignores some bits)
+  - every specified instruction word can be reencoded from its fields
+  - every instruction the program executes is specified
+
+  With -l the executed instructions are listed disassembled.
+
+  How to compile: gcc -std=c99 -O2 -Wall isachk.c -o isachk.exe
+*/
+
+#include "emu.h"
+#include "isa.h"
+
+ulong drom[DROM_CNT];
+uchar mem[MEM_SIZE];
+ulong counts[0x10000]; // executions per pc
+uint words[0x10000];   // instruction words per pc
+
+uint dromidxfull(uint instr)
+{
+  return dromidx(0, instr);
+}
+
+uint dromidxmini(uint instr)
+{
+  return dromidx(1, instr);
+}
+
+// Runs the program ROM, counting executed instructions. Returns 1 if it
+// ends at its last instruction (the test ROM's pass loop).
+int run(int mini, ulong progsize, ulong* cycles)
+{
+  static Cpu cpu;
+  Run r;
+  uint res;
+  cpuinit(&cpu, mini, drom, mem);
+  runinit(&r, progsize - 2, 100000000);
+  while ((res = runcheck(&r, &cpu)) == RUN_GOING)
+  {
+    cpucycle(&cpu);
+    if (cpu.lclk == CLK_FETCH && (cpu.lacc & ACC_FETCH))
+    {
+      counts[cpu.lla]++;
+      words[cpu.lla] = cpu.ir;
+    }
+  }
+  *cycles = cpu.cycles;
+  return res == RUN_PASSED;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, list = 0;
+  char* dromname;
+  char* progname = NULL;
+  uint i, instr;
+  ulong errors = 0;
+  int mini;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-l"))
+      list = 1;
+    else
+      goto lusage;
+  }
+  if (argc - i != 1 && argc - i != 2)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  isachk [options] <decoder_rom_file> [<program_rom_file>]\n"
+            "Options:\n"
+            "  -be  big-endian input files\n"
+            "  -l   list the instructions executed by the program\n");
+    exit(EXIT_FAILURE);
+  }
+  dromname = argv[i];
+  if (argc - i == 2)
+    progname = argv[i + 1];
+
+  mini = loaddrom(dromname, drom, bigendian);
+  isainit(mini);
+
+  // The specification vs the decoder ROM and the encoder.
+  errors += isachkdrom(drom, mini ? dromidxmini : dromidxfull, DROM_FILLER, stdout);
+
+  {
+    ulong nvalid = 0;
+    for (instr = 0; instr < 0x10000; instr++)
+      nvalid += isavalid(instr);
+    printf("%s variant: %u specification entries, %lu specified instruction words\n",
+           mini ? "MINI" : "full", isacnt, nvalid);
+  }
+
+  // The program.
+  if (progname)
+  {
+    ulong progsize = loadfile(progname, mem, ROM_SIZE, bigendian, 2), cycles;
+    ulong nexec = 0, nbadexec = 0;
+    int pass = run(mini, progsize, &cycles);
+    for (i = 0; i < 0x10000; i++)
+    {
+      char dis[64];
+      if (!counts[i])
+        continue;
+      nexec++;
+      isadis(words[i], dis);
+      if (!isavalid(words[i]))
+      {
+        nbadexec++;
+        printf("%04X: %04X  %-28s unspecified instruction executed\n", i, words[i], dis);
+      }
+      else if (list)
+        printf("%04X: %04X  %-28s %10lu\n", i, words[i], dis, counts[i]);
+    }
+    printf("%s: %s, %lu cycles, %lu distinct instructions executed, %lu unspecified\n",
+           progname, pass ? "passed" : "FAILED", cycles, nexec, nbadexec);
+    errors += nbadexec + !pass;
+  }
+
+  if (errors)
+  {
+    printf("%lu errors\n", errors);
+    return EXIT_FAILURE;
+  }
+  return 0;
+}
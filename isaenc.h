@@ -0,0 +1,147 @@
+// Generated by mkisaenc.c from isa.h, do not edit.
+// The instruction encoders the assembler macros of mktesti.c are built on.
+
+#ifndef ISAENC_H
+#define ISAENC_H
+
+#if !MINI
+
+#define ENC_ANDI(RRR,imm7)       (0x1800U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ORI(RRR,imm7)        (0x1C00U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM0(imm7)          (0x1B00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM1(imm7)          (0x1B80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM2(imm7)          (0x1F00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM3(imm7)          (0x1F80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_LB(rrr,RRR,imm7)     (0x0000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_INCM(rrr)            (0x2301U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_DECM(rrr)            (0x237FU | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_ADCZ(rrr)            (0x2381U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_LW(rrr,RRR,imm7)     (0x2000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_XORI(RRR,imm7)       (0x5800U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_CMPI(RRR,imm7)       (0x5C00U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM4(imm7)          (0x5B00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM5(imm7)          (0x5B80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM6(imm7)          (0x5F00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM7(imm7)          (0x5F80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SUBM0(n,RRR,imm7)    (0x4000U | ((unsigned)(n) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SB(rrr,RRR,imm7)     (0x4000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SUBM1(n,RRR,imm7)    (0x6000U | ((unsigned)(n) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SUBM2(n,imm7)        (0x7C00U | ((unsigned)(n) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM12(imm7)         (0x7F00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM13(imm7)         (0x7F80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_DINCM(rrr)           (0x6301U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_DDECM(rrr)           (0x6381U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_SW(rrr,RRR,imm7)     (0x6000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SWI(imm7)            (0x9B01U | ((unsigned)(imm7) & 0x3FU) << 1)
+#define ENC_PUSHI(imm7)          (0x9B80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM8(imm7)          (0x9F00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM9(imm7)          (0x9F80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDI(rrr,RRR,imm7)   (0x8000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SUBM3(n,imm7)        (0xBC00U | ((unsigned)(n) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM10(imm7)         (0xBF00U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ADDM11(imm7)         (0xBF80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_J(imm9)              (0xB801U | ((unsigned)(imm9) & 0xFFU) << 1)
+#define ENC_LI(rrr,imm9)         (0xA000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm9) & 0x1FFU))
+#define ENC_ADDU(rrr,imm9)       (0xA200U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm9) & 0x1FFU))
+#define ENC_JAL(imm11)           (0xD800U | ((unsigned)(imm11) & 0x7FFU))
+#define ENC_LURPC(rrr,imm9)      (0xC200U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm9) & 0x1FFU))
+#define ENC_LAST(imm7)           (0xD401U | ((unsigned)(imm7) & 0x3FU) << 1)
+#define ENC_LS5R(rrr)            (0xC001U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_SS5R(rrr)            (0xC081U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_INCS(rrr,imm7)       (0xC000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_DECS(rrr,imm7)       (0xC080U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_DINCS(rrr,imm7)      (0xC100U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_DDECS(rrr,imm7)      (0xC180U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_JCC(cond,C,imm7)     (0xE000U | ((unsigned)(cond) & 0x7U) << 10 | ((unsigned)(C) & 0x1U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_MRS(n)               (0xF887U | ((unsigned)(n) >> 4 & 0x1U) << 10 | ((unsigned)(n) & 0xFU) << 3)
+#define ENC_STC()                (0xFCF7U)
+#define ENC_ADDM14(n,imm7)       (0xE100U | ((unsigned)(n) >> 1 & 0x7U) << 10 | ((unsigned)(n) & 0x1U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_MF2()                (0xFE77U)
+#define ENC_M2F()                (0xFE7FU)
+#define ENC_POP(n)               (0xFA67U | ((unsigned)(n) >> 2 & 0x1U) << 10 | ((unsigned)(n) & 0x3U) << 3)
+#define ENC_ZXT(PPP)             (0xFA07U | ((unsigned)(PPP) & 0x7U) << 4)
+#define ENC_SXT(PPP)             (0xFA0FU | ((unsigned)(PPP) & 0x7U) << 4)
+#define ENC_CPL(PPP)             (0xFE07U | ((unsigned)(PPP) & 0x7U) << 4)
+#define ENC_NEG(PPP)             (0xFE0FU | ((unsigned)(PPP) & 0x7U) << 4)
+#define ENC_SUBM4(n,imm7)        (0xE200U | ((unsigned)(n) & 0x7U) << 10 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_DI()                 (0xFAE7U)
+#define ENC_EI()                 (0xFAEFU)
+#define ENC_RETI()               (0xFAF7U)
+#define ENC_ADD22ADC33()         (0xFEE7U)
+#define ENC_CADD24()             (0xFEEFU)
+#define ENC_CADD24ADC3Z()        (0xFEF7U)
+#define ENC_CSUB34()             (0xFEFFU)
+#define ENC_SRI(PPP,imm4)        (0xFA80U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(imm4) & 0xFU))
+#define ENC_SLI(PPP,imm4)        (0xFE80U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(imm4) & 0xFU))
+#define ENC_ASRI(rrr,imm4)       (0xE2E0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm4) & 0xFU))
+#define ENC_RLI(rrr,imm4)        (0xE2F0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm4) & 0xFU))
+#define ENC_SAC(rrr,PPP,imm4)    (0xE280U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(imm4) & 0xFU))
+#define ENC_SR(rrr,qqq)          (0xE360U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_SL(rrr,qqq)          (0xE368U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_RR(rrr,qqq)          (0xE3E0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_RL(rrr,qqq)          (0xE3E8U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_ASR(rrr,qqq)         (0xE370U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_XOR(rrr,qqq)         (0xE378U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_AND(rrr,qqq)         (0xE3F0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_OR(rrr,qqq)          (0xE3F8U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(qqq) & 0x7U))
+#define ENC_ADC(PPP,qqq)         (0xFB00U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_SBB(PPP,qqq)         (0xFB08U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_ADD(PPP,qqq)         (0xFF00U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_SUB(PPP,qqq)         (0xFF08U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_CMP(PPP,qqq)         (0xFF88U | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_MOV(rrr,PPP,qqq)     (0xE308U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_MSR(rrr,PPP,qqq)     (0xE388U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_LB2(rrr,PPP,qqq)     (0xE300U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_LW2(rrr,PPP,qqq)     (0xE380U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_SB2(rrr,PPP,qqq)     (0xE308U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+#define ENC_SW2(rrr,PPP,qqq)     (0xE388U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(PPP) & 0x7U) << 4 | ((unsigned)(qqq) & 0x7U))
+
+#else // MINI
+
+#define ENC_ANDI(RRR,imm7)       (0x1800U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_ORI(RRR,imm7)        (0x1C00U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_LB(rrr,RRR,imm7)     (0x0000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_LW(rrr,RRR,imm7)     (0x2000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_XORI(RRR,imm7)       (0x5800U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_CMPI(RRR,imm7)       (0x5C00U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SB(rrr,RRR,imm7)     (0x4000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_PUSHI(imm7)          (0x7F80U | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SW(rrr,RRR,imm7)     (0x6000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_SWI(imm7)            (0x9B81U | ((unsigned)(imm7) & 0x3FU) << 1)
+#define ENC_ADDI(rrr,RRR,imm7)   (0x8000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x7FU))
+#define ENC_LAST(imm7)           (0xBB80U | ((unsigned)(imm7) & 0x3FU) << 1)
+#define ENC_DECS(RRR,imm7)       (0xBC00U | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm7) & 0x3FU) << 1)
+#define ENC_LI(rrr,imm9)         (0xA000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm9) & 0x1FFU) << 1)
+#define ENC_J(imm9)              (0xBC01U | ((unsigned)(imm9) & 0xFFU) << 2)
+#define ENC_ADDU(rrr,imm9)       (0xA001U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm9) & 0x1FFU) << 1)
+#define ENC_JAL(imm11)           (0xD800U | ((unsigned)(imm11) & 0x7FFU))
+#define ENC_LURPC(rrr,imm9)      (0xC000U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm9) & 0x1FFU) << 1)
+#define ENC_ADD22ADC33()         (0xC3FFU)
+#define ENC_CADD24()             (0xC7FFU)
+#define ENC_CADD24ADC3Z()        (0xCBFFU)
+#define ENC_CSUB34()             (0xCFFFU)
+#define ENC_MF2()                (0xD3FFU)
+#define ENC_M2F()                (0xD7FFU)
+#define ENC_ZXT(rrr)             (0xE38EU | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_SXT(rrr)             (0xE3CEU | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_CPL(rrr)             (0xE38FU | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_NEG(rrr)             (0xE3CFU | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_JCC(imm7,cond)       (0xE000U | ((unsigned)(imm7) & 0x7FU) << 6 | ((unsigned)(cond) & 0xFU))
+#define ENC_MSR(rrr,RRR)         (0xE01EU | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7)
+#define ENC_MRS(rrr,RRR)         (0xE01FU | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7)
+#define ENC_ALU(rrr,RRR,op)      (0xE010U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(op) & 0xFU))
+#define ENC_ADCZ(rrr)            (0xE3D0U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_SAC(rrr,RRR,imm4)    (0xE050U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7 | ((unsigned)(imm4) & 0xFU))
+#define ENC_PUSH(rrr)            (0xE3A0U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_ASRI(rrr,imm4)       (0xE3A0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm4) & 0xFU))
+#define ENC_POP(rrr)             (0xE3E0U | ((unsigned)(rrr) & 0x7U) << 10)
+#define ENC_RLI(rrr,imm4)        (0xE3E0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm4) & 0xFU))
+#define ENC_RETI()               (0xFFB0U)
+#define ENC_SRI(rrr,imm4)        (0xE3B0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm4) & 0xFU))
+#define ENC_LWP(rrr,RRR)         (0xE070U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7)
+#define ENC_SWP(rrr,RRR)         (0xE071U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(RRR) & 0x7U) << 7)
+#define ENC_SLI(rrr,imm4)        (0xE3F0U | ((unsigned)(rrr) & 0x7U) << 10 | ((unsigned)(imm4) & 0xFU))
+
+#endif // MINI
+
+#endif
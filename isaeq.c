@@ -0,0 +1,374 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 microcode equivalence checker.
+
+  Runs every one of the 65536 instruction words from a number of CPU
+  states (-n) both in the microcode-driven model of emu.h with the given
+  decoder ROM and in the reference instruction set model of isaref.h, and
+  compares the registers, flags, the interrupt enable flag, the selectors
+  and the memory writes. The states the reference model doesn't define a
+  result for (reserved instructions and operands, unaligned words, etc)
+  are skipped, and so are the arithmetic flags it leaves unspecified.
+
+  The first states of every instruction word are edge cases (0, 1, 0x7FFF,
+  0x8000, 0xFFFF, ... in the registers, every combination of the arithmetic
+  flags), the rest are random. Every state is derived from the seed (-seed),
+  the instruction word and the state number only, so the results don't
+  depend on the number of threads (-j) the instruction words are split
+  among.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread isaeq.c -o isaeq.exe
+*/
+
+#include <pthread.h>
+#include "emu.h"
+#include "isa.h"
+#include "isaref.h"
+
+enum
+{
+  MAX_REPORT = 4 // divergent instruction words to report per specification entry
+};
+
+typedef struct
+{
+  uint first, step;
+} Job;
+
+ulong drom[DROM_CNT];
+int mini;
+uint nstates = 64;
+ulong seed = 1;
+uchar image[MEM_SIZE];      // initial memory contents
+ulong ndiv[0x10000];        // divergent states per instruction word
+ulong nres[0x10000];        // states with undefined results per instruction word
+uint firstdiv[0x10000];     // first divergent state per instruction word
+
+const uint edges[] =
+{
+  0x0000, 0x0001, 0x0002, 0x000F, 0x0010, 0x007F, 0x0080, 0x00FF,
+  0x0100, 0x3FFF, 0x4000, 0x7FFE, 0x7FFF, 0x8000, 0x8001, 0xFFFE, 0xFFFF
+};
+
+enum
+{
+  NEDGES = sizeof edges / sizeof edges[0]
+};
+
+ulong rnd(ulong* x)
+{
+  // splitmix64
+  unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (ulong)(z ^ (z >> 31));
+}
+
+// Makes state k for instruction word instr.
+void mkstate(IsaState* st, uint instr, uint k)
+{
+  ulong x = seed * 0x10001UL + instr * 0x1000193UL + k * 0x9E3779B1UL;
+  uint i;
+  rnd(&x);
+  for (i = 0; i < 8; i++)
+  {
+    ulong v = rnd(&x);
+    if (k < 2 * NEDGES)
+      st->r[i] = edges[(k + i * 5 + (k >= NEDGES) * i) % NEDGES];
+    else if (v & 3)
+      st->r[i] = (v >> 8) & 0xFFFF;
+    else
+      st->r[i] = (v >> 8) & 15; // shift counts, selector numbers
+    st->sel[i] = (rnd(&x) >> 8) & 0xFF;
+  }
+  st->r[6] &= 0xFFFE;
+  st->r[7] = (rnd(&x) >> 8) & 0xFFFE;
+  st->flags = (rnd(&x) >> 8) & 0xFFFF;
+  if (k < 16)
+    st->flags = (st->flags & ~15U) | k;
+  st->ie = rnd(&x) & 1;
+  // Mostly no IRQ to take, so the instruction gets executed.
+  if (rnd(&x) & 3)
+    st->flags &= ~0x03F0U;
+}
+
+void cpuset(Cpu* c, const IsaState* st)
+{
+  memcpy(c->r, st->r, sizeof c->r);
+  c->flags = st->flags;
+  c->ie = st->ie;
+  memcpy(c->sel, st->sel, sizeof c->sel);
+}
+
+int wcmp(const void* a, const void* b)
+{
+  const IsaWrite* x = a;
+  const IsaWrite* y = b;
+  return (x->pa > y->pa) - (x->pa < y->pa);
+}
+
+// Runs state k of instr in both models in memory m (image contents on
+// entry and exit). Returns 1 if they diverge, 0 if not, -1 if the result
+// is undefined. Describes the divergence in buf if it's not NULL.
+int check(uint instr, uint k, uchar* m, char* buf)
+{
+  IsaState st, ref;
+  IsaWrite rw[2], mw[4];
+  ulong undo[4], fpa;
+  uint nrw, nmw = 0, undef, i, ncycles = 0, fold;
+  Cpu cpu;
+  int div = 0;
+
+  mkstate(&st, instr, k);
+  ref = st;
+
+  // The instruction goes where pc points to.
+  fpa = isarefphys(&st, 1, st.r[7]);
+  fold = m[fpa] | (m[fpa + 1] << 8);
+  m[fpa] = instr & 0xFF;
+  m[fpa + 1] = instr >> 8;
+
+  if (isarefexec(&ref, m, rw, &nrw, &undef) != ISAREF_OK)
+  {
+    m[fpa] = fold & 0xFF;
+    m[fpa + 1] = fold >> 8;
+    return -1;
+  }
+
+  cpuinit(&cpu, mini, drom, m);
+  cpuset(&cpu, &st);
+  do
+  {
+    cpucycle(&cpu);
+    if ((cpu.lacc & ACC_WRITE) && nmw < 4)
+    {
+      uint w16 = (cpu.lacc & ACC_W16) != 0;
+      mw[nmw].pa = w16 ? cpu.lpa & ~1UL : cpu.lpa;
+      mw[nmw].w16 = w16;
+      mw[nmw].val = cpu.lbus & (w16 ? 0xFFFF : 0xFF);
+      undo[nmw++] = cpu.lold;
+    }
+  } while (cpu.clk != CLK_FETCH && ++ncycles < 4);
+
+  // Restore the memory.
+  for (i = nmw; i--; )
+  {
+    m[mw[i].pa] = undo[i] & 0xFF;
+    if (mw[i].w16)
+      m[mw[i].pa + 1] = undo[i] >> 8;
+  }
+  m[fpa] = fold & 0xFF;
+  m[fpa + 1] = fold >> 8;
+
+  if (buf)
+    buf += sprintf(buf, "      state:");
+  #define DIFF(what, a, b) \
+    do \
+    { \
+      div = 1; \
+      if (buf) \
+        buf += sprintf(buf, " %s=%04X (ref %04X)", what, (uint)(a), (uint)(b)); \
+    } while (0)
+  if (cpu.clk != CLK_FETCH)
+    DIFF("cycles", ncycles + 1, 0);
+  for (i = 0; i < 8; i++)
+    if (cpu.r[i] != ref.r[i])
+      DIFF(isa_regs[i], cpu.r[i], ref.r[i]);
+  if ((cpu.flags ^ ref.flags) & ~undef & 0xFFFF)
+    DIFF("flags", cpu.flags, ref.flags);
+  if (cpu.ie != ref.ie)
+    DIFF("ie", cpu.ie, ref.ie);
+  for (i = 0; i < 8; i++)
+    if (cpu.sel[i] != ref.sel[i])
+    {
+      char name[8];
+      sprintf(name, "sel%u", i);
+      DIFF(name, cpu.sel[i], ref.sel[i]);
+    }
+  qsort(mw, nmw, sizeof mw[0], wcmp);
+  qsort(rw, nrw, sizeof rw[0], wcmp);
+  if (nmw != nrw)
+    DIFF("writes", nmw, nrw);
+  else
+    for (i = 0; i < nmw; i++)
+      if (mw[i].pa != rw[i].pa || mw[i].w16 != rw[i].w16 || mw[i].val != rw[i].val)
+      {
+        div = 1;
+        if (buf)
+          buf += sprintf(buf, " [%06lX]%s=%04X (ref [%06lX]%s=%04X)",
+                         mw[i].pa, mw[i].w16 ? "w" : "b", mw[i].val,
+                         rw[i].pa, rw[i].w16 ? "w" : "b", rw[i].val);
+      }
+  #undef DIFF
+
+  if (buf && div)
+  {
+    buf += sprintf(buf, "\n      before:");
+    for (i = 0; i < 8; i++)
+      buf += sprintf(buf, " %s=%04X", isa_regs[i], st.r[i]);
+    buf += sprintf(buf, " flags=%04X ie=%u sel=", st.flags, st.ie);
+    for (i = 0; i < 8; i++)
+      buf += sprintf(buf, "%02X%s", st.sel[i], (i < 7) ? "," : "");
+  }
+  return div;
+}
+
+// Checks instruction words first, first + step, first + 2 * step, ...
+void* job(void* arg)
+{
+  Job* j = arg;
+  uint instr, k;
+  uchar* m = malloc(MEM_SIZE);
+  if (!m)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  memcpy(m, image, MEM_SIZE);
+  for (instr = j->first; instr < 0x10000; instr += j->step)
+    for (k = 0; k < nstates; k++)
+    {
+      int res = check(instr, k, m, NULL);
+      if (res < 0)
+        nres[instr]++;
+      else if (res && !ndiv[instr]++)
+        firstdiv[instr] = k;
+    }
+  free(m);
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, verbose = 0, nthreads = 4;
+  uint i, e, nentries, instr;
+  ulong x, totdiv = 0, totwords = 0, totres = 0, totruns = 0;
+  Job* jobs;
+  pthread_t* thr;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-v"))
+      verbose = 1;
+    else if (!strcmp(argv[i], "-n") && i + 1 < (uint)argc && (nstates = atoi(argv[++i])) > 0)
+      ;
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else if (!strcmp(argv[i], "-seed") && i + 1 < (uint)argc)
+      seed = strtoul(argv[++i], NULL, 0);
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  isaeq [options] <decoder_rom_file>\n"
+            "Options:\n"
+            "  -be       big-endian input file\n"
+            "  -n <n>    states per instruction word (default: 64)\n"
+            "  -seed <n> random state seed (default: 1)\n"
+            "  -j <n>    number of threads (default: 4)\n"
+            "  -v        report every divergent instruction word\n");
+    exit(EXIT_FAILURE);
+  }
+
+  mini = loaddrom(argv[i], drom, bigendian);
+  isainit(mini);
+  isarefinit();
+  x = seed;
+  for (i = 0; i < MEM_SIZE; i += 4)
+  {
+    ulong v = rnd(&x);
+    image[i] = v, image[i + 1] = v >> 8, image[i + 2] = v >> 16, image[i + 3] = v >> 24;
+  }
+
+  jobs = calloc(nthreads, sizeof *jobs);
+  thr = calloc(nthreads, sizeof *thr);
+  if (!jobs || !thr)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+  {
+    jobs[i].first = i;
+    jobs[i].step = nthreads;
+    if (pthread_create(&thr[i], NULL, job, &jobs[i]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+    pthread_join(thr[i], NULL);
+
+  // Per specification entry.
+  for (nentries = 0; strcmp(isatab[nentries].enc, "????????????????"); nentries++)
+    ;
+  printf("%-16s %-12s %-22s %6s %9s %9s %6s\n",
+         "encoding", "instruction", "operands", "words", "states", "undefined", "diverg");
+  for (e = 0; e <= nentries; e++)
+  {
+    ulong words = 0, res = 0, div = 0;
+    uint nreported = 0;
+    for (instr = 0; instr < 0x10000; instr++)
+      if (isapd[instr] == e)
+      {
+        words++;
+        res += nres[instr];
+        div += ndiv[instr] != 0;
+      }
+    if (!words)
+      continue;
+    printf("%-16s %-12s %-22s %6lu %9lu %9lu %6lu\n", isatab[e].enc, isatab[e].name, isatab[e].ops,
+           words, words * nstates, res, div);
+    totwords += words;
+    totres += res;
+    totdiv += div;
+    totruns += words * nstates;
+    for (instr = 0; instr < 0x10000; instr++)
+      if (isapd[instr] == e && ndiv[instr] && (verbose || nreported++ < MAX_REPORT))
+      {
+        static uchar m[MEM_SIZE];
+        char dis[64], desc[1024];
+        memcpy(m, image, MEM_SIZE);
+        isadis(instr, dis);
+        check(instr, firstdiv[instr], m, desc);
+        printf("  %04X %-26s %lu of %u states diverge, e.g. state %u:\n%s\n",
+               instr, dis, ndiv[instr], nstates, firstdiv[instr], desc);
+      }
+  }
+
+  printf("\n%s variant: %lu instruction words, %lu states, %lu undefined, "
+         "%lu instruction words diverge\n",
+         mini ? "MINI" : "full", totwords, totruns, totres, totdiv);
+  return totdiv ? EXIT_FAILURE : 0;
+}
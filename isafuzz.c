@@ -0,0 +1,726 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 coverage-guided instruction stream fuzzer.
+
+  Looks for divergences between the microcode-driven model of emu.h and
+  the reference instruction set model of isaref.h in sequences of up to 16
+  instructions run from given initial states (registers, flags, ie,
+  selectors). Every instruction is executed by both models and the
+  outcomes are compared like isaeq.c does; a sequence stops at the first
+  instruction whose result the reference model doesn't define.
+
+  Inputs are mutated (instruction words, registers, flags, ie, selectors,
+  splicing) and kept in the corpus if they reach new coverage: edges
+  between consecutive (decoder ROM row, arithmetic flags, selector class)
+  triples, counted in a bitmap the way AFL does. The selector class tells
+  what the row accessed: nothing, ROM, code space, data space, a selector
+  read or write.
+
+  The worker threads (-j) share the corpus and the coverage bitmap. Each
+  worker runs the inputs in its own copy of the memory snapshot and undoes
+  the memory writes after every run instead of forking a fresh copy.
+
+  The inputs causing a divergence or a hang (an instruction the microcode
+  doesn't end in 4 clock cycles) are saved as text files (one per kind of
+  divergence of a specification entry), which -r runs again, listing the
+  executed instructions.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread isafuzz.c -o isafuzz.exe
+*/
+
+#include <pthread.h>
+#include <time.h>
+#include "emu.h"
+#include "isa.h"
+#include "isaref.h"
+
+enum
+{
+  MAX_CODE    = 16,   // instruction words per input
+  MAX_UNDO    = MAX_CODE + 4 * MAX_CODE,
+  MAX_CORPUS  = 8192,
+  MAX_ENTRIES = 256,  // specification entries
+  MAP_BITS    = 16,
+  MAP_SIZE    = 1 << MAP_BITS,
+  MAX_CYCLES  = 4,    // clock cycles per instruction
+  MAX_EDGES   = MAX_CODE * MAX_CYCLES // coverage bitmap entries hit per run
+};
+
+enum
+{
+  RUN_OK,
+  RUN_DIV,
+  RUN_HANG
+};
+
+// What differs, RUN_DIV.
+enum
+{
+  DIFF_REGS   = 1 << 0,
+  DIFF_FLAGS  = 1 << 1,
+  DIFF_IE     = 1 << 2,
+  DIFF_SEL    = 1 << 3,
+  DIFF_WRITES = 1 << 4,
+  DIFF_KINDS  = 1 << 5
+};
+
+typedef struct
+{
+  IsaState st;
+  uint n;
+  uint code[MAX_CODE];
+} Input;
+
+typedef struct
+{
+  uchar* mem;
+  uchar trace[MAP_SIZE];
+  ushort touched[MAX_EDGES]; // the nonzero entries of trace[]
+  uint ntouched;
+  ulong rng;
+  ulong upa[MAX_UNDO];
+  uint uold[MAX_UNDO];
+  uchar uw16[MAX_UNDO];
+  uint nundo;
+  uint steps;   // instructions executed in the last run
+  uint instr;   // the instruction word that diverged or hung
+  uint diff;    // DIFF_*
+  char desc[2048];
+} Worker;
+
+ulong drom[DROM_CNT];
+int mini;
+ulong seed = 1;
+uchar image[MEM_SIZE];
+const char* prefix = "fuzz-";
+time_t deadline;
+ulong maxexecs;
+
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+uchar virgin[MAP_SIZE]; // hit count classes seen so far
+Input corpus[MAX_CORPUS];
+uint ncorpus;
+ulong execs, ndivs, nhangs, nsaved;
+uchar saved[MAX_ENTRIES][DIFF_KINDS + 1]; // kinds of divergences saved per entry
+
+const uint edges[] =
+{
+  0x0000, 0x0001, 0x0002, 0x000F, 0x0010, 0x007F, 0x0080, 0x00FF,
+  0x0100, 0x3FFF, 0x4000, 0x7FFE, 0x7FFF, 0x8000, 0x8001, 0xFFFE, 0xFFFF
+};
+
+ulong rnd(ulong* x)
+{
+  // splitmix64
+  unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (ulong)(z ^ (z >> 31));
+}
+
+uint rndn(ulong* x, uint n)
+{
+  return (uint)((rnd(x) >> 8) % n);
+}
+
+// A random instruction word, mostly one the reference model knows.
+uint rndinstr(ulong* x)
+{
+  uint i, instr = 0;
+  for (i = 0; i < 4; i++)
+    if (isarefpd[instr = rndn(x, 0x10000)] != REF_RESERVED)
+      break;
+  return instr;
+}
+
+uint rndvalue(ulong* x)
+{
+  switch (rndn(x, 4))
+  {
+  case 0: return edges[rndn(x, sizeof edges / sizeof edges[0])];
+  case 1: return rndn(x, 16); // shift counts, selector numbers
+  default: return rndn(x, 0x10000);
+  }
+}
+
+void rndstate(ulong* x, IsaState* st)
+{
+  uint i;
+  for (i = 0; i < 8; i++)
+  {
+    st->r[i] = rndvalue(x);
+    st->sel[i] = rndn(x, 256);
+  }
+  st->r[6] &= 0xFFFE;
+  st->r[7] &= 0xFFFE;
+  st->flags = rndn(x, 0x10000);
+  // Mostly no IRQ to take, so the instructions get executed.
+  if (rndn(x, 4))
+    st->flags &= ~0x03F0U;
+  st->ie = rndn(x, 2);
+}
+
+void mutate(ulong* x, Input* in, const Input* other)
+{
+  uint k, nops = 1 + rndn(x, 4), i;
+  for (k = 0; k < nops; k++)
+  {
+    i = rndn(x, in->n);
+    switch (rndn(x, 10))
+    {
+    case 0: in->code[i] ^= 1U << rndn(x, 16); break;
+    case 1: in->code[i] = rndinstr(x); break;
+    case 2: // insert
+      if (in->n < MAX_CODE)
+      {
+        memmove(in->code + i + 1, in->code + i, (in->n - i) * sizeof in->code[0]);
+        in->code[i] = rndn(x, 2) ? rndinstr(x) : in->code[rndn(x, in->n)];
+        in->n++;
+      }
+      break;
+    case 3: // delete
+      if (in->n > 1)
+      {
+        memmove(in->code + i, in->code + i + 1, (in->n - i - 1) * sizeof in->code[0]);
+        in->n--;
+      }
+      break;
+    case 4: in->st.r[rndn(x, 6)] = rndvalue(x); break;
+    case 5: in->st.r[6 + rndn(x, 2)] = rndvalue(x) & 0xFFFE; break;
+    case 6: in->st.flags ^= 1U << rndn(x, 16); break;
+    case 7: in->st.ie ^= 1; break;
+    case 8: in->st.sel[rndn(x, 8)] = rndn(x, 2) ? rndn(x, 256) : rndn(x, 4); break;
+    default: // splice
+      if (other && other->n)
+      {
+        uint j = rndn(x, other->n);
+        while (i < MAX_CODE && j < other->n)
+          in->code[i++] = other->code[j++];
+        if (i > in->n)
+          in->n = i;
+      }
+      break;
+    }
+  }
+}
+
+void undolog(Worker* w, ulong pa, uint w16)
+{
+  if (w->nundo == MAX_UNDO)
+  {
+    fprintf(stderr, "Undo log overflow\n");
+    exit(EXIT_FAILURE);
+  }
+  w->upa[w->nundo] = pa;
+  w->uw16[w->nundo] = w16;
+  w->uold[w->nundo++] = w16 ? w->mem[pa] | (w->mem[pa + 1] << 8) : w->mem[pa];
+}
+
+int wcmp(const void* a, const void* b)
+{
+  const IsaWrite* x = a;
+  const IsaWrite* y = b;
+  return (x->pa > y->pa) - (x->pa < y->pa);
+}
+
+// The selector class of the last clock cycle.
+uint selclass(const Cpu* c)
+{
+  if (c->lsel)
+    return (c->lsel & SELACC_READ) ? 4 : 5;
+  if (!c->lacc)
+    return 0;
+  if (c->lpa < ROM_SIZE)
+    return 1;
+  return (c->lacc & ACC_CODE) ? 2 : 3;
+}
+
+// Runs the input in w->mem (the snapshot contents on entry and exit),
+// collecting the coverage in w->trace. Lists the executed instructions
+// to log if it's not NULL.
+int run(Worker* w, const Input* in, FILE* log)
+{
+  Cpu cpu;
+  IsaState ref;
+  IsaWrite rw[2], mw[4];
+  uint i, k, prev = 0, nrw, undef, res = RUN_OK;
+  char* buf = w->desc;
+
+  for (i = 0; i < w->ntouched; i++)
+    w->trace[w->touched[i]] = 0;
+  w->ntouched = 0;
+  w->nundo = 0;
+  w->steps = 0;
+  w->diff = 0;
+  buf[0] = '\0';
+
+  // The instructions go where pc points to.
+  for (i = 0; i < in->n; i++)
+  {
+    ulong pa = isarefphys(&in->st, 1, (in->st.r[7] + 2 * i) & 0xFFFF);
+    undolog(w, pa, 1);
+    w->mem[pa] = in->code[i] & 0xFF;
+    w->mem[pa + 1] = in->code[i] >> 8;
+  }
+
+  cpuinit(&cpu, mini, drom, w->mem);
+  memcpy(cpu.r, in->st.r, sizeof cpu.r);
+  cpu.flags = in->st.flags;
+  cpu.ie = in->st.ie;
+  memcpy(cpu.sel, in->st.sel, sizeof cpu.sel);
+
+  for (k = 0; k < in->n; k++)
+  {
+    IsaState st;
+    uint nmw = 0, ncycles = 0, irq;
+    memcpy(st.r, cpu.r, sizeof st.r);
+    st.flags = cpu.flags;
+    st.ie = cpu.ie;
+    memcpy(st.sel, cpu.sel, sizeof st.sel);
+    ref = st;
+    irq = st.ie && ((st.flags >> 10) & (st.flags >> 4) & ((1U << IRQ_CNT) - 1));
+    w->instr = irq ? SWI_IRQ : memread(&cpu, cpuphys(&cpu, 1, st.r[7]), 1);
+    if (log)
+    {
+      char dis[64];
+      isadis(w->instr, dis);
+      fprintf(log, "  %04X: %04X  %s%s\n", st.r[7], w->instr, dis, irq ? " (IRQ)" : "");
+    }
+    if (isarefexec(&ref, w->mem, rw, &nrw, &undef) != ISAREF_OK)
+      break;
+    w->steps++;
+
+    cpucycle(&cpu); // fetch
+    do
+    {
+      uint fl = cpu.flags & 15, cur;
+      cpucycle(&cpu);
+      cur = (uint)((cpu.lidx * 16 + fl) * 8 + selclass(&cpu)) * 0x9E3779B1U >> (32 - MAP_BITS);
+      if (!w->trace[cur ^ prev])
+        w->touched[w->ntouched++] = cur ^ prev;
+      if (w->trace[cur ^ prev] < 255)
+        w->trace[cur ^ prev]++;
+      prev = cur >> 1;
+      if ((cpu.lacc & ACC_WRITE) && nmw < 4)
+      {
+        uint w16 = (cpu.lacc & ACC_W16) != 0;
+        ulong pa = w16 ? cpu.lpa & ~1UL : cpu.lpa;
+        mw[nmw].pa = pa;
+        mw[nmw].w16 = w16;
+        mw[nmw++].val = cpu.lbus & (w16 ? 0xFFFF : 0xFF);
+        // Log the contents memwrite() has already changed.
+        w->upa[w->nundo] = pa;
+        w->uw16[w->nundo] = w16;
+        w->uold[w->nundo++] = cpu.lold;
+      }
+    } while (cpu.clk != CLK_FETCH && ++ncycles < MAX_CYCLES);
+
+    if (cpu.clk != CLK_FETCH)
+    {
+      sprintf(buf, "      the instruction doesn't end in %u clock cycles", MAX_CYCLES);
+      res = RUN_HANG;
+      break;
+    }
+
+    buf += sprintf(buf, "      state:");
+    for (i = 0; i < 8; i++)
+      if (cpu.r[i] != ref.r[i])
+      {
+        w->diff |= DIFF_REGS;
+        buf += sprintf(buf, " %s=%04X (ref %04X)", isa_regs[i], cpu.r[i], ref.r[i]);
+      }
+    if ((cpu.flags ^ ref.flags) & ~undef & 0xFFFF)
+    {
+      w->diff |= DIFF_FLAGS;
+      buf += sprintf(buf, " flags=%04X (ref %04X)", cpu.flags, ref.flags);
+    }
+    if (cpu.ie != ref.ie)
+    {
+      w->diff |= DIFF_IE;
+      buf += sprintf(buf, " ie=%u (ref %u)", cpu.ie, ref.ie);
+    }
+    for (i = 0; i < 8; i++)
+      if (cpu.sel[i] != ref.sel[i])
+      {
+        w->diff |= DIFF_SEL;
+        buf += sprintf(buf, " sel%u=%02X (ref %02X)", i, cpu.sel[i], ref.sel[i]);
+      }
+    qsort(mw, nmw, sizeof mw[0], wcmp);
+    qsort(rw, nrw, sizeof rw[0], wcmp);
+    for (i = 0; i < nmw || i < nrw; i++)
+      if (i >= nmw || i >= nrw ||
+          mw[i].pa != rw[i].pa || mw[i].w16 != rw[i].w16 || mw[i].val != rw[i].val)
+      {
+        w->diff |= DIFF_WRITES;
+        if (i < nmw)
+          buf += sprintf(buf, " [%06lX]%s=%04X", mw[i].pa, mw[i].w16 ? "w" : "b", mw[i].val);
+        else
+          buf += sprintf(buf, " no write");
+        if (i < nrw)
+          buf += sprintf(buf, " (ref [%06lX]%s=%04X)", rw[i].pa, rw[i].w16 ? "w" : "b", rw[i].val);
+        else
+          buf += sprintf(buf, " (ref no write)");
+      }
+    if (w->diff)
+    {
+      buf += sprintf(buf, "\n      before:");
+      for (i = 0; i < 8; i++)
+        buf += sprintf(buf, " %s=%04X", isa_regs[i], st.r[i]);
+      buf += sprintf(buf, " flags=%04X ie=%u sel=", st.flags, st.ie);
+      for (i = 0; i < 8; i++)
+        buf += sprintf(buf, "%02X%s", st.sel[i], (i < 7) ? "," : "");
+      res = RUN_DIV;
+      break;
+    }
+    buf = w->desc;
+    buf[0] = '\0';
+  }
+
+  // Restore the memory.
+  for (i = w->nundo; i--; )
+  {
+    w->mem[w->upa[i]] = w->uold[i] & 0xFF;
+    if (w->uw16[i])
+      w->mem[w->upa[i] + 1] = w->uold[i] >> 8;
+  }
+  return res;
+}
+
+// Hit count classes, as in AFL.
+uint hitclass(uint n)
+{
+  if (n <= 3)
+    return n ? 1U << (n - 1) : 0;
+  if (n < 8)
+    return 8;
+  if (n < 16)
+    return 16;
+  if (n < 32)
+    return 32;
+  return (n < 128) ? 64 : 128;
+}
+
+// Merges the worker's trace into the shared bitmap. Returns 1 if it has
+// new coverage. Only the entries the run hit are looked at, and without
+// the lock: the bitmap only gains bits, so a run that adds nothing to
+// a possibly stale view of it adds nothing to the current one either.
+// The lock is taken only to add the new bits.
+int merge(const Worker* w)
+{
+  uint i;
+  int news = 0;
+  for (i = 0; i < w->ntouched; i++)
+    if (hitclass(w->trace[w->touched[i]]) & ~virgin[w->touched[i]])
+      break;
+  if (i == w->ntouched)
+    return 0;
+  pthread_mutex_lock(&lock);
+  for (; i < w->ntouched; i++)
+  {
+    uint e = w->touched[i], c = hitclass(w->trace[e]);
+    if (c & ~virgin[e])
+    {
+      virgin[e] |= c;
+      news = 1;
+    }
+  }
+  pthread_mutex_unlock(&lock);
+  return news;
+}
+
+void saveinput(FILE* f, const Input* in)
+{
+  uint i;
+  fprintf(f, "seed %lu\nstate", seed);
+  for (i = 0; i < 8; i++)
+    fprintf(f, " %04X", in->st.r[i]);
+  fprintf(f, " %04X %u", in->st.flags, in->st.ie);
+  for (i = 0; i < 8; i++)
+    fprintf(f, " %02X", in->st.sel[i]);
+  fprintf(f, "\ncode");
+  for (i = 0; i < in->n; i++)
+    fprintf(f, " %04X", in->code[i]);
+  fprintf(f, "\n");
+}
+
+int loadinput(const char* name, Input* in)
+{
+  FILE* f = fopen(name, "r");
+  char line[1024];
+  uint i, ok = 0;
+  if (!f)
+  {
+    fprintf(stderr, "Can't open file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  memset(in, 0, sizeof *in);
+  while (fgets(line, sizeof line, f))
+  {
+    char* p = line;
+    int len;
+    if (sscanf(line, "seed %lu", &seed) == 1)
+      ok |= 1;
+    else if (!strncmp(line, "state", 5))
+    {
+      p += 5;
+      for (i = 0; i < 18 && sscanf(p, "%x%n", (i < 8) ? &in->st.r[i] : (i == 8) ? &in->st.flags :
+                                   (i == 9) ? &in->st.ie : &in->st.sel[i - 10], &len) == 1; i++)
+        p += len;
+      ok |= (i == 18) << 1;
+    }
+    else if (!strncmp(line, "code", 4))
+    {
+      p += 4;
+      for (in->n = 0; in->n < MAX_CODE && sscanf(p, "%x%n", &in->code[in->n], &len) == 1; in->n++)
+        p += len;
+      ok |= (in->n > 0) << 2;
+    }
+  }
+  fclose(f);
+  return ok == 7;
+}
+
+// Saves the first input of every kind of divergence of an entry.
+void save(Worker* w, const Input* in, int res)
+{
+  uint e = isapd[w->instr], kind = (res == RUN_HANG) ? DIFF_KINDS : w->diff;
+  ulong n;
+  char name[1024], dis[64];
+  const char* p;
+  FILE* f;
+  Input t = *in;
+
+  pthread_mutex_lock(&lock);
+  if (res == RUN_HANG)
+    nhangs++;
+  else
+    ndivs++;
+  if (e >= MAX_ENTRIES || saved[e][kind])
+  {
+    pthread_mutex_unlock(&lock);
+    return;
+  }
+  saved[e][kind] = 1;
+  n = ++nsaved;
+  pthread_mutex_unlock(&lock);
+
+  t.n = w->steps; // what was executed
+  isadis(w->instr, dis);
+  snprintf(name, sizeof name, "%s%s-%04X-%lu.txt", prefix, (res == RUN_HANG) ? "hang" : "div", w->instr, n);
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f, "# %s variant, %04X %s:\n#", mini ? "MINI" : "full", w->instr, dis);
+  for (p = w->desc; *p; p++)
+    if (*p == '\n')
+      fprintf(f, "\n#");
+    else
+      fputc(*p, f);
+  fprintf(f, "\n");
+  saveinput(f, &t);
+  fclose(f);
+  printf("%s: %04X %s\n", name, w->instr, dis);
+  fflush(stdout);
+}
+
+void* job(void* arg)
+{
+  Worker* w = arg;
+  ulong n = 0;
+  Input in, other;
+
+  for (;;)
+  {
+    int res;
+    uint i;
+
+    pthread_mutex_lock(&lock);
+    execs += n;
+    n = 0;
+    if (time(NULL) >= deadline || (maxexecs && execs >= maxexecs))
+    {
+      pthread_mutex_unlock(&lock);
+      break;
+    }
+    if (ncorpus && rndn(&w->rng, 16))
+    {
+      in = corpus[rndn(&w->rng, ncorpus)];
+      other = corpus[rndn(&w->rng, ncorpus)];
+    }
+    else
+    {
+      // Now and then a fresh input.
+      rndstate(&w->rng, &in.st);
+      in.n = 1 + rndn(&w->rng, MAX_CODE);
+      for (i = 0; i < in.n; i++)
+        in.code[i] = rndinstr(&w->rng);
+      other.n = 0;
+    }
+    pthread_mutex_unlock(&lock);
+
+    // A batch of mutants of the input.
+    for (i = 0; i < 64; i++)
+    {
+      Input t = in;
+      mutate(&w->rng, &t, &other);
+      res = run(w, &t, NULL);
+      n++;
+      if (res != RUN_OK)
+        save(w, &t, res);
+      else if (merge(w))
+      {
+        pthread_mutex_lock(&lock);
+        corpus[(ncorpus < MAX_CORPUS) ? ncorpus++ : rndn(&w->rng, MAX_CORPUS)] = t;
+        pthread_mutex_unlock(&lock);
+      }
+    }
+  }
+  return NULL;
+}
+
+uint coverage(void)
+{
+  uint i, n = 0;
+  for (i = 0; i < MAP_SIZE; i++)
+    n += virgin[i] != 0;
+  return n;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, nthreads = 4;
+  ulong seconds = 60, x;
+  const char* replay = NULL;
+  uint i;
+  Worker* w;
+  pthread_t* thr;
+  time_t start;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-t") && i + 1 < (uint)argc)
+      seconds = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-n") && i + 1 < (uint)argc)
+      maxexecs = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-seed") && i + 1 < (uint)argc)
+      seed = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-o") && i + 1 < (uint)argc)
+      prefix = argv[++i];
+    else if (!strcmp(argv[i], "-r") && i + 1 < (uint)argc)
+      replay = argv[++i];
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  isafuzz [options] <decoder_rom_file>\n"
+            "Options:\n"
+            "  -be         big-endian input file\n"
+            "  -t <n>      stop after n seconds (default: 60)\n"
+            "  -n <n>      stop after n runs\n"
+            "  -seed <n>   random seed, also of the memory contents (default: 1)\n"
+            "  -o <prefix> prefix of the names of the saved inputs (default: fuzz-)\n"
+            "  -r <file>   run a saved input again\n"
+            "  -j <n>      number of threads (default: 4)\n");
+    exit(EXIT_FAILURE);
+  }
+
+  mini = loaddrom(argv[i], drom, bigendian);
+  isainit(mini);
+  isarefinit();
+
+  w = calloc(nthreads, sizeof *w);
+  thr = calloc(nthreads, sizeof *thr);
+  if (!w || !thr)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  if (replay)
+  {
+    Input in;
+    int res;
+    if (!loadinput(replay, &in))
+    {
+      fprintf(stderr, "Can't parse file \"%s\"\n", replay);
+      exit(EXIT_FAILURE);
+    }
+    x = seed;
+    for (i = 0; i < MEM_SIZE; i += 4)
+    {
+      ulong v = rnd(&x);
+      image[i] = v, image[i + 1] = v >> 8, image[i + 2] = v >> 16, image[i + 3] = v >> 24;
+    }
+    w->mem = image;
+    res = run(w, &in, stdout);
+    printf("%s\n%s\n", (res == RUN_OK) ? "no divergence" : (res == RUN_HANG) ? "hang:" : "divergence:", w->desc);
+    return (res == RUN_OK) ? 0 : EXIT_FAILURE;
+  }
+
+  x = seed;
+  for (i = 0; i < MEM_SIZE; i += 4)
+  {
+    ulong v = rnd(&x);
+    image[i] = v, image[i + 1] = v >> 8, image[i + 2] = v >> 16, image[i + 3] = v >> 24;
+  }
+
+  start = time(NULL);
+  deadline = start + seconds;
+  for (i = 0; i < (uint)nthreads; i++)
+  {
+    if ((w[i].mem = malloc(MEM_SIZE)) == NULL)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    memcpy(w[i].mem, image, MEM_SIZE);
+    w[i].rng = seed * 0x10001UL + i + 1;
+    if (pthread_create(&thr[i], NULL, job, &w[i]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+    pthread_join(thr[i], NULL);
+
+  printf("%s variant: %lu runs in %lu s, corpus %u, coverage %u edges, %lu divergences, %lu hangs, "
+         "%lu inputs saved\n",
+         mini ? "MINI" : "full", execs, (ulong)(time(NULL) - start), ncorpus, coverage(),
+         ndivs, nhangs, nsaved);
+  return (ndivs || nhangs) ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,630 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 reference instruction set model.
+
+  Executes one instruction at a time the way the ISA description in
+  SediCiPUv2.md defines it, without the decoder ROM: the instruction is
+  looked up in the isa.h tables and the operands are taken from the ops
+  template of its entry, so both variants share the semantics.
+
+  isarefexec() reports the instructions (or operand combinations) that
+  the ISA leaves reserved or whose result it doesn't define:
+  - reserved encodings and register operands the descriptions exclude
+    (e.g. sp and pc as ALU destinations, pushing/popping sp or pc, storing
+    a register relative to itself, selector numbers above 7)
+  - shift counts that are reserved (imm4 = 0, `sl r, 1`)
+  - word accesses at odd addresses
+  It also returns the arithmetic flags left unspecified (C and O after
+  (d)incm/(d)decm, O, S, Z after stc).
+
+  Memory is read from a MEM_SIZE image, the writes are returned instead
+  of being performed (an instruction writes at most 2 words).
+
+  The header is meant to be included after emu.h and isa.h.
+*/
+
+
+#ifndef ISAREF_H
+#define ISAREF_H
+
+enum
+{
+  ISAREF_OK,
+  ISAREF_RESERVED
+};
+
+typedef struct
+{
+  uint r[8];  // r0...r5, sp, pc
+  uint flags; // masks (15-10), requested IRQs (9-4), O, S, Z, C (3-0)
+  uint ie;
+  uint sel[8];
+} IsaState;
+
+typedef struct
+{
+  ulong pa;
+  uint w16;
+  uint val;
+} IsaWrite;
+
+enum
+{
+  REF_RESERVED,
+  REF_LB, REF_LW, REF_SB, REF_SW,
+  REF_AND, REF_OR, REF_XOR, REF_CMP, REF_ADD, REF_SUB, REF_ADC, REF_SBB, REF_MOV,
+  REF_SR, REF_SL, REF_RR, REF_RL, REF_ASR, REF_SAC,
+  REF_ADDM, REF_SUBM,
+  REF_INCM, REF_DECM, REF_DINCM, REF_DDECM, // (rrr) and rrr, (sp + imm)
+  REF_ADCZ, REF_ZXT, REF_SXT, REF_CPL, REF_NEG,
+  REF_PUSH, REF_POP, REF_LS5R, REF_SS5R, REF_LAST,
+  REF_LI, REF_ADDU, REF_LURPC,
+  REF_J, REF_JCC, REF_JAL, REF_SWI, REF_RETI, REF_DI, REF_EI,
+  REF_MRS, REF_MSR, REF_STC, REF_MF2, REF_M2F,
+  REF_ADD22ADC33, REF_CADD24, REF_CADD24ADC3Z, REF_CSUB34
+};
+
+typedef struct
+{
+  uint reg;   // 1: register, 0: immediate
+  uint v;     // register number or immediate value (16-bit)
+} IsaOpnd;
+
+uchar isarefpd[0x10000]; // REF_* per instruction word
+
+// Maps a mnemonic of the isa.h tables to REF_*.
+uint isarefop(const char* name)
+{
+  static const struct { const char* name; uchar op; } ops[] =
+  {
+    { "lb", REF_LB }, { "lw", REF_LW }, { "sb", REF_SB }, { "sw", REF_SW },
+    { "and", REF_AND }, { "or", REF_OR }, { "xor", REF_XOR }, { "cmp", REF_CMP },
+    { "add", REF_ADD }, { "sub", REF_SUB }, { "adc", REF_ADC }, { "sbb", REF_SBB },
+    { "mov", REF_MOV }, { "sr", REF_SR }, { "sl", REF_SL }, { "rr", REF_RR },
+    { "rl", REF_RL }, { "asr", REF_ASR }, { "sac", REF_SAC },
+    { "addm", REF_ADDM }, { "subm", REF_SUBM },
+    { "incm", REF_INCM }, { "decm", REF_DECM }, { "dincm", REF_DINCM }, { "ddecm", REF_DDECM },
+    { "incm/incs", REF_INCM }, { "decm/decs", REF_DECM },
+    { "dincm/dincs", REF_DINCM }, { "ddecm/ddecs", REF_DDECM }, { "decs", REF_DECM },
+    { "adcz", REF_ADCZ }, { "zxt", REF_ZXT }, { "sxt", REF_SXT }, { "cpl", REF_CPL },
+    { "neg", REF_NEG }, { "push", REF_PUSH }, { "pop", REF_POP },
+    { "ls5r", REF_LS5R }, { "ss5r", REF_SS5R }, { "last", REF_LAST },
+    { "li", REF_LI }, { "addu", REF_ADDU }, { "lurpc", REF_LURPC },
+    { "j", REF_J }, { "j%c", REF_JCC }, { "jal", REF_JAL }, { "swi", REF_SWI },
+    { "reti", REF_RETI }, { "di", REF_DI }, { "ei", REF_EI },
+    { "mrs", REF_MRS }, { "msr", REF_MSR }, { "stc", REF_STC },
+    { "mf2", REF_MF2 }, { "m2f", REF_M2F },
+    { "add22adc33", REF_ADD22ADC33 }, { "cadd24", REF_CADD24 },
+    { "cadd24adc3z", REF_CADD24ADC3Z }, { "csub34", REF_CSUB34 }
+  };
+  uint i;
+  for (i = 0; i < sizeof ops / sizeof ops[0]; i++)
+    if (!strcmp(name, ops[i].name))
+      return ops[i].op;
+  return REF_RESERVED;
+}
+
+// Builds isarefpd[] for the variant selected by isainit().
+void isarefinit(void)
+{
+  uint instr;
+  for (instr = 0; instr < 0x10000; instr++)
+  {
+    const IsaSpec* s = &isatab[isapd[instr]];
+    const char* name = s->name;
+    if (!strcmp(name, "%o"))
+      name = isa_aluops[isafield(s->enc, instr, 'o', NULL)];
+    isarefpd[instr] = isarefop(name);
+  }
+}
+
+// Extracts the operands of instr from the ops template of its entry:
+// registers (fields and literal names) and immediates in the order they
+// appear, register pairs expanded (addm, subm: dst, src, ximm7; mrs: r, s).
+uint isarefopnds(uint instr, IsaOpnd o[4])
+{
+  const IsaSpec* s = &isatab[isapd[instr]];
+  const char* e = s->enc;
+  const char* p = s->ops;
+  uint n = 0, i, w, v;
+
+  while (*p)
+  {
+    static const struct { const char* tok; char f; char kind; } toks[] =
+    {
+      // kind: r = register field, u = unsigned, s = signed, U/S = doubled,
+      // x = ximm7, a = addm, m = subm, M = mrs, p = pop
+      { "simm11*2", 'e', 'S' }, { "simm8*2", '9', 'S' }, { "simm7*2", '7', 'S' },
+      { "simm6*2", '7', 'S' }, { "imm6*2", '7', 'U' },
+      { "simm7", '7', 's' }, { "simm9", '9', 's' }, { "ximm7", '7', 'x' },
+      { "imm4", '4', 'u' }, { "imm7", '7', 'u' }, { "imm9", '9', 'u' },
+      { "rrr", 'r', 'r' }, { "RRR", 'R', 'r' }, { "PPP", 'P', 'r' }, { "qqq", 'q', 'r' },
+      { "addm", 'n', 'a' }, { "subm", 'n', 'm' }, { "mrs", 'n', 'M' }, { "rPQ", 'n', 'r' }
+    };
+    uint nt = sizeof toks / sizeof toks[0];
+    for (i = 0; i < nt; i++)
+      if (!strncmp(p, toks[i].tok, strlen(toks[i].tok)))
+        break;
+    if (i == nt)
+    {
+      // Literal register names: r0...r5, sp, pc.
+      for (v = 0; v < 8 && strncmp(p, isa_regs[v], 2); v++)
+        ;
+      if (v < 8)
+      {
+        o[n].reg = 1, o[n++].v = v;
+        p += 2;
+      }
+      else
+        p++;
+      continue;
+    }
+    p += strlen(toks[i].tok);
+    v = isafield(e, instr, toks[i].f, &w);
+    switch (toks[i].kind)
+    {
+    case 'r': o[n].reg = 1, o[n++].v = v; break;
+    case 'u': o[n].reg = 0, o[n++].v = v; break;
+    case 's': o[n].reg = 0, o[n++].v = sext(v, w) & 0xFFFF; break;
+    case 'U': o[n].reg = 0, o[n++].v = v * 2; break;
+    case 'S': o[n].reg = 0, o[n++].v = (sext(v, w) << 1) & 0xFFFF; break;
+    case 'x':
+      // unsigned if added to sp
+      o[n].reg = 0, o[n].v = (n && o[n - 1].reg && o[n - 1].v == 6) ? v : sext(v, w) & 0xFFFF;
+      n++;
+      break;
+    case 'a':
+    case 'm':
+    {
+      uint dst, src;
+      if (toks[i].kind == 'a')
+      {
+        v += s->k;
+        dst = v / 6;
+        src = v % 6 + (v % 6 >= v / 6);
+      }
+      else
+      {
+        dst = s->k;
+        src = v + (v >= dst);
+      }
+      v = isafield(e, instr, '7', &w);
+      o[n].reg = 1, o[n++].v = dst;
+      o[n].reg = 1, o[n++].v = src;
+      o[n].reg = 0, o[n++].v = (src == 6) ? v : sext(v, w) & 0xFFFF;
+      break;
+    }
+    case 'M':
+      o[n].reg = 1, o[n++].v = v / 5;
+      o[n].reg = 1, o[n++].v = v % 5 + (v % 5 >= v / 5);
+      break;
+    }
+  }
+  return n;
+}
+
+ulong isarefphys(const IsaState* st, uint code, uint la)
+{
+  return ((ulong)st->sel[(code ? 0 : 4) + (la >> BLOCK_BITS)] << BLOCK_BITS) | (la & (BLOCK_SIZE - 1));
+}
+
+// Logic operation flags: Z and S from the result, C and O cleared.
+uint isareflogic(uint r)
+{
+  r &= 0xFFFF;
+  return ((r >> 15) << 2) | ((r == 0) << 1);
+}
+
+// a + b + cin with the flags in *fl.
+uint isarefadd(uint a, uint b, uint cin, uint* fl)
+{
+  uint r = a + b + cin, s = r & 0xFFFF;
+  uint o = (~(a ^ b) & (a ^ s) & 0x8000) != 0;
+  *fl = (o << 3) | isareflogic(s) | (r > 0xFFFF);
+  return s;
+}
+
+// a - b - bin with the flags in *fl (C is the borrow).
+uint isarefsub(uint a, uint b, uint bin, uint* fl)
+{
+  uint s = (a - b - bin) & 0xFFFF;
+  uint o = ((a ^ b) & (a ^ s) & 0x8000) != 0;
+  *fl = (o << 3) | isareflogic(s) | (a < b + bin);
+  return s;
+}
+
+uint isarefshift(uint op, uint a, uint n)
+{
+  n &= 15;
+  switch (op)
+  {
+  case REF_SR: return a >> n;
+  case REF_SL: return (a << n) & 0xFFFF;
+  case REF_RR: return ((a >> n) | (a << (16 - n))) & 0xFFFF;
+  case REF_RL: return ((a << n) | (a >> (16 - n))) & 0xFFFF;
+  default: return ((a >> n) | ((a & 0x8000) ? (0xFFFFU << (16 - n)) : 0)) & 0xFFFF; // asr
+  }
+}
+
+int isarefcond(uint flags, uint cc)
+{
+  uint c = flags & 1, z = (flags >> 1) & 1, s = (flags >> 2) & 1, o = (flags >> 3) & 1, t;
+  switch (cc & 7)
+  {
+  case 0: t = c; break;          // c/lu
+  case 1: t = z; break;          // z/e
+  case 2: t = s; break;          // s
+  case 3: t = c | z; break;      // leu
+  case 4: t = s ^ o; break;      // l
+  case 5: t = (s ^ o) | z; break; // le
+  case 6: t = o; break;          // o
+  default: t = !o; break;        // no
+  }
+  return t ^ (cc >> 3);
+}
+
+// Executes the instruction at st->r[7] (or enters the hardware ISR if an
+// unmasked IRQ is requested and interrupts are enabled). Memory writes go
+// to w[] (their number to *nw), the unspecified arithmetic flags to *undef.
+// Returns ISAREF_RESERVED, leaving *st intact, if the result is undefined.
+int isarefexec(IsaState* st, const uchar* mem, IsaWrite w[2], uint* nw, uint* undef)
+{
+  IsaState s = *st;
+  uint pc = s.r[7], P = (pc + 2) & 0xFFFE;
+  uint instr, op, n, fl = s.flags & 15, a, b, v;
+  IsaOpnd o[4];
+  int mini = isatab == isa_mini;
+  #define RD(x) ((x).reg ? (((x).v == 7) ? P : s.r[(x).v]) : (x).v)
+  #define WR(rg, val) (s.r[rg] = ((rg) >= 6) ? ((val) & 0xFFFE) : ((val) & 0xFFFF))
+  #define LD(code, la, wide) \
+    ((wide) ? (ulong)(mem[isarefphys(&s, code, la) & ~1UL] | (mem[isarefphys(&s, code, la) | 1] << 8)) \
+            : (ulong)mem[isarefphys(&s, code, la)])
+  #define ST(code, la, wide, x) \
+    (w[*nw].pa = isarefphys(&s, code, la), w[*nw].w16 = (wide), \
+     w[*nw].val = (x) & ((wide) ? 0xFFFF : 0xFF), (*nw)++)
+  #define ODD(la, wide) ((wide) && ((la) & 1))
+
+  *nw = 0;
+  *undef = 0;
+  s.r[7] = P;
+
+  if (s.ie && ((s.flags >> 10) & (s.flags >> 4) & ((1U << IRQ_CNT) - 1)))
+  {
+    // swi 31 in place of the instruction at pc.
+    ST(0, (s.r[6] - 2) & 0xFFFF, 1, pc | s.ie);
+    s.ie = 0;
+    s.r[7] = 0x3E;
+    *st = s;
+    return ISAREF_OK;
+  }
+
+  instr = LD(1, pc, 1);
+  op = isarefpd[instr];
+  n = isarefopnds(instr, o);
+
+  switch (op)
+  {
+  case REF_LB:
+  case REF_LW:
+  case REF_SB:
+  case REF_SW:
+  {
+    uint wide = op == REF_LW || op == REF_SW;
+    uint code = (o[1].reg && o[1].v == 7) || (o[2].reg && o[2].v == 7);
+    uint la = (RD(o[1]) + RD(o[2])) & 0xFFFF;
+    if (ODD(la, wide))
+      return ISAREF_RESERVED;
+    if (op == REF_LB || op == REF_LW)
+    {
+      if (op == REF_LB && o[0].v >= 6)
+        return ISAREF_RESERVED;
+      v = LD(code, la, wide);
+      WR(o[0].v, v);
+    }
+    else
+    {
+      if (o[0].v == 7 || (op == REF_SB && o[0].v == 6) || o[0].v == o[1].v)
+        return ISAREF_RESERVED;
+      ST(code, la, wide, s.r[o[0].v]);
+    }
+    break;
+  }
+
+  case REF_AND:
+  case REF_OR:
+  case REF_XOR:
+    if (o[0].v >= 6 || (o[1].reg && o[1].v >= 6))
+      return ISAREF_RESERVED;
+    a = s.r[o[0].v];
+    b = RD(o[1]);
+    v = (op == REF_AND) ? a & b : (op == REF_OR) ? a | b : a ^ b;
+    WR(o[0].v, v);
+    fl = isareflogic(v);
+    break;
+
+  case REF_CMP:
+    if (mini && !o[1].reg && o[0].v == 7 && o[1].v == 0xFFFF)
+    {
+      // stc
+      fl = 1;
+      *undef = 14;
+      break;
+    }
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    isarefsub(s.r[o[0].v], RD(o[1]), 0, &fl);
+    break;
+
+  case REF_ADD:
+    if (n == 3)
+    {
+      // add rrr, RRR, simm7
+      v = (RD(o[1]) + o[2].v) & 0xFFFF;
+      if (o[0].v < 6)
+        isarefadd(RD(o[1]), o[2].v, 0, &fl);
+      else if (o[0].v == 7 && (o[2].v & 1))
+        s.r[5] = P; // link
+      WR(o[0].v, v);
+      break;
+    }
+    // fallthrough
+  case REF_SUB:
+  case REF_ADC:
+  case REF_SBB:
+    if (o[0].v >= 6 || ((op == REF_ADC || op == REF_SBB) && o[1].v >= 6))
+      return ISAREF_RESERVED;
+    a = s.r[o[0].v];
+    b = RD(o[1]);
+    if (op == REF_ADD || op == REF_ADC)
+      v = isarefadd(a, b, (op == REF_ADC) ? (s.flags & 1) : 0, &fl);
+    else
+      v = isarefsub(a, b, (op == REF_SBB) ? (s.flags & 1) : 0, &fl);
+    WR(o[0].v, v);
+    break;
+
+  case REF_MOV:
+    if (o[0].v >= 6 || o[1].v == 7)
+      return ISAREF_RESERVED;
+    WR(o[0].v, s.r[o[1].v]);
+    break;
+
+  case REF_SR:
+  case REF_SL:
+  case REF_RR:
+  case REF_RL:
+  case REF_ASR:
+    if (o[0].v >= 6 || (o[1].reg && o[1].v >= 6) ||
+        (!o[1].reg && (o[1].v == 0 || (op == REF_SL && o[1].v == 1))))
+      return ISAREF_RESERVED;
+    v = isarefshift(op, s.r[o[0].v], RD(o[1]));
+    WR(o[0].v, v);
+    fl = isareflogic(v);
+    break;
+
+  case REF_SAC:
+    if (o[0].v >= 6 || o[1].v >= 6 || (mini && !o[2].v))
+      return ISAREF_RESERVED;
+    v = isarefadd(s.r[o[0].v], (s.r[o[1].v] << o[2].v) & 0xFFFF, 0, &fl);
+    WR(o[0].v, v);
+    break;
+
+  case REF_ADDM:
+  case REF_SUBM:
+  {
+    uint la = (RD(o[1]) + o[2].v) & 0xFFFF;
+    if (ODD(la, 1))
+      return ISAREF_RESERVED;
+    s.r[5] = LD(0, la, 1);
+    a = s.r[o[0].v];
+    v = (op == REF_ADDM) ? isarefadd(a, s.r[5], 0, &fl) : isarefsub(a, s.r[5], 0, &fl);
+    WR(o[0].v, v);
+    break;
+  }
+
+  case REF_INCM:
+  case REF_DECM:
+  case REF_DINCM:
+  case REF_DDECM:
+  {
+    // (rrr) or rrr, (sp + imm)
+    uint la = (n == 1) ? s.r[o[0].v] : (RD(o[1]) + o[2].v) & 0xFFFF;
+    uint d = (op == REF_INCM) ? 1 : (op == REF_DECM) ? 0xFFFF : (op == REF_DINCM) ? 2 : 0xFFFE;
+    if (o[0].v >= 6 || ODD(la, 1))
+      return ISAREF_RESERVED;
+    v = LD(0, la, 1);
+    WR(o[0].v, v);
+    ST(0, la, 1, v + d);
+    fl = isareflogic(v + d);
+    *undef = 9;
+    break;
+  }
+
+  case REF_ADCZ:
+  case REF_ZXT:
+  case REF_SXT:
+  case REF_CPL:
+  case REF_NEG:
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    a = s.r[o[0].v];
+    switch (op)
+    {
+    case REF_ADCZ: v = isarefadd(a, 0, s.flags & 1, &fl); break;
+    case REF_ZXT: v = a & 0xFF; break;
+    case REF_SXT: v = sext(a, 8) & 0xFFFF; break;
+    case REF_CPL: v = ~a & 0xFFFF; break;
+    default: v = isarefsub(0, a, 0, &fl); break;
+    }
+    WR(o[0].v, v);
+    break;
+
+  case REF_PUSH:
+    if (o[0].reg && o[0].v >= 6)
+      return ISAREF_RESERVED;
+    v = RD(o[0]);
+    s.r[6] = (s.r[6] - 2) & 0xFFFE;
+    ST(0, s.r[6], 1, v);
+    break;
+
+  case REF_POP:
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    v = LD(0, s.r[6], 1);
+    s.r[6] = (s.r[6] + 2) & 0xFFFE;
+    WR(o[0].v, v);
+    break;
+
+  case REF_LS5R:
+  case REF_SS5R:
+    if (o[0].v >= 5)
+      return ISAREF_RESERVED;
+    if (op == REF_LS5R)
+    {
+      s.r[5] = LD(0, s.r[6], 1);
+      WR(o[0].v, LD(0, (s.r[6] + 2) & 0xFFFF, 1));
+    }
+    else
+    {
+      ST(0, s.r[6], 1, s.r[5]);
+      ST(0, (s.r[6] + 2) & 0xFFFF, 1, s.r[o[0].v]);
+    }
+    break;
+
+  case REF_LAST:
+    s.r[6] = (s.r[6] + o[0].v) & 0xFFFE;
+    s.r[7] = s.r[5] & 0xFFFE;
+    break;
+
+  case REF_LI:
+  case REF_LURPC:
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    WR(o[0].v, (op == REF_LI) ? o[1].v : P + (o[1].v << 7));
+    break;
+
+  case REF_ADDU:
+    if (o[0].v == 7)
+      return ISAREF_RESERVED;
+    v = isarefadd(s.r[o[0].v], (o[1].v << 7) & 0xFFFF, 0, (o[0].v == 6) ? &a : &fl);
+    WR(o[0].v, v);
+    break;
+
+  case REF_J:
+  case REF_JAL:
+    if (op == REF_JAL)
+      s.r[5] = P;
+    s.r[7] = (P + o[0].v) & 0xFFFE;
+    break;
+
+  case REF_JCC:
+  {
+    const IsaSpec* sp = &isatab[isapd[instr]];
+    uint cc = isafield(sp->enc, instr, 'C', NULL) * 8 + isafield(sp->enc, instr, 'c', NULL);
+    if (cc >= 14)
+      return ISAREF_RESERVED;
+    if (isarefcond(s.flags, cc))
+      s.r[7] = (P + o[0].v) & 0xFFFE;
+    break;
+  }
+
+  case REF_SWI:
+    ST(0, (s.r[6] - 2) & 0xFFFF, 1, pc | s.ie);
+    s.ie = 0;
+    s.r[7] = o[0].v & 0xFFFE;
+    break;
+
+  case REF_RETI:
+    v = LD(0, (s.r[6] - 2) & 0xFFFF, 1);
+    s.r[7] = v & 0xFFFE;
+    s.ie = v & 1;
+    break;
+
+  case REF_DI:
+  case REF_EI:
+    s.ie = op == REF_EI;
+    break;
+
+  case REF_MRS:
+  case REF_MSR:
+    // mrs r, s / msr s, r
+    a = o[op == REF_MRS].v; // selector number register
+    b = o[op == REF_MSR].v; // value register
+    if (a >= 6 || b >= 6 || a == b || s.r[a] > 7)
+      return ISAREF_RESERVED;
+    if (op == REF_MRS)
+      WR(b, s.sel[s.r[a]]);
+    else
+      s.sel[s.r[a]] = s.r[b] & 0xFF;
+    break;
+
+  case REF_STC:
+    fl = 1;
+    *undef = 14;
+    break;
+
+  case REF_MF2:
+    s.flags = (s.r[2] & 0xFC0F) | (s.flags & s.r[2] & 0x03F0);
+    fl = s.flags & 15;
+    break;
+
+  case REF_M2F:
+    s.r[2] = s.flags;
+    break;
+
+  case REF_ADD22ADC33:
+    s.r[2] = isarefadd(s.r[2], s.r[2], 0, &fl);
+    s.r[3] = isarefadd(s.r[3], s.r[3], fl & 1, &fl);
+    break;
+
+  case REF_CADD24:
+  case REF_CADD24ADC3Z:
+    s.r[2] = isarefadd(s.r[2], (s.flags & 1) ? s.r[4] : 0, 0, &fl);
+    if (op == REF_CADD24ADC3Z)
+      s.r[3] = isarefadd(s.r[3], 0, fl & 1, &fl);
+    break;
+
+  case REF_CSUB34:
+    s.r[3] = isarefsub(s.r[3], s.r[4], 0, &fl);
+    s.r[3] = isarefadd(s.r[3], (fl & 1) ? s.r[4] : 0, 0, &fl);
+    break;
+
+  default:
+    return ISAREF_RESERVED;
+  }
+
+  s.flags = (s.flags & ~15U) | fl;
+  *st = s;
+  return ISAREF_OK;
+
+  #undef RD
+  #undef WR
+  #undef LD
+  #undef ST
+  #undef ODD
+}
+
+#endif
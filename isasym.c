@@ -0,0 +1,1224 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 symbolic microcode checker.
+
+  Proves for every instruction word that the decoder ROM implements the
+  instruction the way the reference model of isaref.h defines it, for all
+  values of the registers, flags, interrupt enable flag, selectors and the
+  memory it reads, rather than for a sample of them like isaeq.c does.
+
+  The datapath of emu.h is modeled bit by bit with BDDs (bdd.h): 16-bit
+  symbolic registers, flags (the carry among them) and memory read values,
+  8-bit symbolic selectors. The instruction word, and so the decoder ROM
+  rows and the control signals, is concrete. Both the microcode and the
+  reference model are evaluated symbolically and every bit of the outcome
+  (registers, flags, ie, selectors, memory write addresses and values)
+  must be the same function of the initial state wherever the reference
+  model defines the result. Memory reads are matched by their physical
+  address functions and return the same fresh variables in both models.
+
+  A failed proof is reported with a counterexample (a satisfying
+  assignment of the difference). The hardware interrupt entry is proved
+  separately. The instruction words are split among threads (-j), each
+  with its own BDD manager.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread isasym.c -o isasym.exe
+*/
+
+#include <pthread.h>
+#include "emu.h"
+#include "isa.h"
+#include "isaref.h"
+#include "bdd.h"
+
+enum
+{
+  MAX_READS  = 4, // memory reads per instruction
+  MAX_WRITES = 4, // memory writes per instruction
+  MAX_REPORT = 4, // failed instruction words to report per specification entry
+  NODE_BITS  = 20 // 1M BDD nodes per thread
+};
+
+// BDD variables. The bits of the 16-bit values are interleaved, which
+// keeps adders, comparisons and shifters small.
+enum
+{
+  SLOT_FLAGS = 8, // slots 0...7: r0...r5, sp, pc
+  SLOT_MEM   = 9, // memory read values
+  SLOTS      = SLOT_MEM + MAX_READS,
+  VAR_IE     = 16 * SLOTS,
+  VAR_SEL    = VAR_IE + 1, // bit j of selector i: VAR_SEL + j * 8 + i
+  NVARS      = VAR_SEL + 64
+};
+
+#define VAR(slot, bit) ((bit) * SLOTS + (slot))
+
+enum
+{
+  PROOF_OK,
+  PROOF_RESERVED, // the reference model defines no result
+  PROOF_FAILED,
+  PROOF_NODES     // out of BDD nodes
+};
+
+// Accesses the other model doesn't make.
+enum
+{
+  MIS_READS  = 1 << 0,
+  MIS_WRITES = 1 << 1
+};
+
+typedef Bdd Vec[16];
+
+typedef struct
+{
+  Vec r[8];
+  Vec flags;
+  Bdd ie;
+  Bdd sel[8][8];
+} SymState;
+
+typedef struct
+{
+  Bdd pa[22];
+  uint w16;
+  Vec val;
+} SymAcc;
+
+typedef struct
+{
+  BddMgr m;
+  SymAcc rd[MAX_READS];   // microcode's reads
+  SymAcc wr[MAX_WRITES];  // microcode's writes
+  SymAcc rwr[MAX_WRITES]; // reference model's writes
+  uint nrd, nwr, nrwr;
+  uint mismatch;          // MIS_*
+} Sym;
+
+typedef struct
+{
+  uint first, step;
+  uint peak;
+} Job;
+
+ulong drom[DROM_CNT];
+int mini;
+uchar result[0x10000]; // PROOF_* per instruction word
+
+void vconst(Vec v, uint c)
+{
+  uint i;
+  for (i = 0; i < 16; i++)
+    v[i] = (c >> i) & 1;
+}
+
+// r = c ? a : b
+void vmux(BddMgr* m, Vec r, Bdd c, const Bdd* a, const Bdd* b)
+{
+  uint i;
+  for (i = 0; i < 16; i++)
+    r[i] = bddite(m, c, a[i], b[i]);
+}
+
+// r = a + b + c, returns the carry out. r may be a or b.
+Bdd vadd(BddMgr* m, Vec r, const Bdd* a, const Bdd* b, Bdd c)
+{
+  uint i;
+  for (i = 0; i < 16; i++)
+  {
+    Bdd x = bddxor(m, a[i], b[i]);
+    Bdd co = bddite(m, x, c, a[i]);
+    r[i] = bddxor(m, x, c);
+    c = co;
+  }
+  return c;
+}
+
+// r = a - b - c, returns the borrow out. r may be a or b.
+Bdd vsub(BddMgr* m, Vec r, const Bdd* a, const Bdd* b, Bdd c)
+{
+  uint i;
+  for (i = 0; i < 16; i++)
+  {
+    Bdd x = bddxor(m, a[i], b[i]);
+    Bdd bo = bddite(m, x, b[i], c);
+    r[i] = bddxor(m, x, c);
+    c = bo;
+  }
+  return c;
+}
+
+Bdd vaddc(BddMgr* m, Vec r, const Bdd* a, uint c)
+{
+  Vec b;
+  vconst(b, c);
+  return vadd(m, r, a, b, BDD_FALSE);
+}
+
+// 1 if v is zero.
+Bdd vzero(BddMgr* m, const Bdd* v)
+{
+  Bdd z = BDD_TRUE;
+  uint i;
+  for (i = 16; i--; )
+    z = bddand(m, z, bddnot(m, v[i]));
+  return z;
+}
+
+// 1 if the low bits of v equal c.
+Bdd veqc(BddMgr* m, const Bdd* v, uint bits, uint c)
+{
+  Bdd e = BDD_TRUE;
+  uint i;
+  for (i = bits; i--; )
+    e = bddand(m, e, ((c >> i) & 1) ? v[i] : bddnot(m, v[i]));
+  return e;
+}
+
+// 1 if the first bits of a and b differ.
+Bdd vdiff(BddMgr* m, const Bdd* a, const Bdd* b, uint bits, uint mask)
+{
+  Bdd d = BDD_FALSE;
+  uint i;
+  for (i = 0; i < bits; i++)
+    if ((mask >> i) & 1)
+      d = bddor(m, d, bddxor(m, a[i], b[i]));
+  return d;
+}
+
+// sr, sl, rr, rl, asr (ALU operations 0...4) by n & 15, a barrel shifter.
+void vshift(BddMgr* m, Vec r, uint op, const Bdd* a, const Bdd* n)
+{
+  Vec x, t;
+  uint k, i;
+  memcpy(x, a, sizeof x);
+  for (k = 0; k < 4; k++)
+  {
+    uint s = 1U << k;
+    for (i = 0; i < 16; i++)
+      switch (op)
+      {
+      case 0: t[i] = (i + s < 16) ? x[i + s] : BDD_FALSE; break;
+      case 1: t[i] = (i >= s) ? x[i - s] : BDD_FALSE; break;
+      case 2: t[i] = x[(i + s) & 15]; break;
+      case 3: t[i] = x[(i - s) & 15]; break;
+      default: t[i] = (i + s < 16) ? x[i + s] : x[15]; break;
+      }
+    vmux(m, x, n[k], t, x);
+  }
+  memcpy(r, x, sizeof x);
+}
+
+// Symbolic condtrue()/isarefcond().
+Bdd symcond(BddMgr* m, const Bdd* flags, uint cc)
+{
+  Bdd c = flags[0], z = flags[1], s = flags[2], o = flags[3], t;
+  switch (cc & 7)
+  {
+  default:
+  case 0: t = c; break;
+  case 1: t = z; break;
+  case 2: t = s; break;
+  case 3: t = bddor(m, c, z); break;
+  case 4: t = bddxor(m, s, o); break;
+  case 5: t = bddor(m, bddxor(m, s, o), z); break;
+  case 6: t = o; break;
+  case 7: t = bddnot(m, o); break;
+  }
+  return (cc >> 3) ? bddnot(m, t) : t;
+}
+
+// Symbolic cpuphys().
+void symphys(BddMgr* m, const SymState* s, uint code, const Bdd* la, uint w16, Bdd pa[22])
+{
+  const Bdd (*sel)[8] = s->sel + (code ? 0 : 4);
+  uint i;
+  for (i = 0; i < 14; i++)
+    pa[i] = la[i];
+  if (w16)
+    pa[0] = BDD_FALSE;
+  for (i = 0; i < 8; i++)
+    pa[14 + i] = bddite(m, la[15],
+                        bddite(m, la[14], sel[3][i], sel[2][i]),
+                        bddite(m, la[14], sel[1][i], sel[0][i]));
+}
+
+// The selector number v & 7 refers to, zero-extended.
+void symselrd(BddMgr* m, const SymState* s, const Bdd* v, Vec r)
+{
+  uint i, j;
+  vconst(r, 0);
+  for (j = 0; j < 8; j++)
+  {
+    Bdd b = BDD_FALSE;
+    for (i = 0; i < 8; i++)
+      b = bddite(m, veqc(m, v, 3, i), s->sel[i][j], b);
+    r[j] = b;
+  }
+}
+
+// A memory read by the microcode, returns fresh variables.
+void symread(Sym* y, const Bdd* pa, uint w16, Vec v)
+{
+  SymAcc* a = &y->rd[y->nrd];
+  uint i;
+  if (y->nrd == MAX_READS)
+  {
+    y->mismatch |= MIS_READS;
+    vconst(v, 0);
+    return;
+  }
+  for (i = 0; i < 16; i++)
+    v[i] = (i < 8 || w16) ? bddvar(&y->m, VAR(SLOT_MEM + y->nrd, i)) : BDD_FALSE;
+  memcpy(a->pa, pa, sizeof a->pa);
+  a->w16 = w16;
+  memcpy(a->val, v, sizeof a->val);
+  y->nrd++;
+}
+
+void symaddwrite(Sym* y, SymAcc* acc, uint* n, const Bdd* pa, uint w16, const Bdd* v)
+{
+  uint i;
+  if (*n == MAX_WRITES)
+  {
+    y->mismatch |= MIS_WRITES;
+    return;
+  }
+  memcpy(acc[*n].pa, pa, sizeof acc[*n].pa);
+  acc[*n].w16 = w16;
+  for (i = 0; i < 16; i++)
+    acc[*n].val[i] = (i < 8 || w16) ? v[i] : BDD_FALSE;
+  (*n)++;
+}
+
+// Symbolic cpuread()/cpuwrite().
+void symrd(const SymState* s, uint reg, uint iaddrsel, Vec v)
+{
+  memcpy(v, s->r[reg], sizeof(Vec));
+  if (reg == 7 && iaddrsel)
+    v[0] = s->ie;
+}
+
+void symwr(SymState* s, uint reg, const Bdd* v)
+{
+  memcpy(s->r[reg], v, sizeof(Vec));
+  if (reg >= 6)
+    s->r[reg][0] = BDD_FALSE;
+}
+
+// Symbolic alu().
+void symalu(BddMgr* m, uint op, const Bdd* a, const Bdd* b, Bdd cin, Vec r, Bdd fl[4])
+{
+  Bdd c = BDD_FALSE, o = BDD_FALSE;
+  uint i;
+  switch (op)
+  {
+  case 0: case 1: case 2: case 3: case 4:
+    vshift(m, r, op, a, b);
+    break;
+  default:
+    vconst(r, 0);
+    break;
+  case 7:
+    for (i = 0; i < 16; i++)
+      r[i] = bddxor(m, a[i], b[i]);
+    break;
+  case 8: case 10:
+    c = vadd(m, r, a, b, (op == 10) ? cin : BDD_FALSE);
+    o = bddand(m, bddxor(m, a[15], r[15]), bddxor(m, b[15], r[15]));
+    break;
+  case 9: case 11:
+    c = vsub(m, r, a, b, (op == 11) ? cin : BDD_FALSE);
+    o = bddand(m, bddxor(m, a[15], b[15]), bddxor(m, a[15], r[15]));
+    break;
+  case 12:
+    for (i = 0; i < 16; i++)
+      r[i] = (i < 8) ? a[i] : BDD_FALSE;
+    break;
+  case 13:
+    for (i = 0; i < 16; i++)
+      r[i] = (i < 8) ? a[i] : a[7];
+    break;
+  case 14:
+    for (i = 0; i < 16; i++)
+      r[i] = bddand(m, a[i], b[i]);
+    break;
+  case 15:
+    for (i = 0; i < 16; i++)
+      r[i] = bddor(m, a[i], b[i]);
+    break;
+  }
+  fl[0] = c;
+  fl[1] = vzero(m, r);
+  fl[2] = r[15];
+  fl[3] = o;
+}
+
+// Symbolic cpuimm().
+void symimm(BddMgr* m, const SymState* s, uint ir, uint sel, Vec v)
+{
+  Cpu c;
+  uint i;
+  c.ir = ir;
+  c.mini = mini;
+  if (sel != 3)
+  {
+    vconst(v, cpuimm(&c, sel));
+    return;
+  }
+  {
+    uint cc = mini ? ir & 15 : ((ir >> 7) & 1) * 8 + ((ir >> 10) & 7);
+    uint ofs = (sext(mini ? ir >> 6 : ir, 7) << 1) & 0xFFFF;
+    Bdd t = symcond(m, s->flags, cc);
+    for (i = 0; i < 16; i++)
+      v[i] = ((ofs >> i) & 1) ? t : BDD_FALSE;
+  }
+}
+
+// Symbolic cpucycle() for the execute cycles. Returns CRST.
+uint symcycle(Sym* y, SymState* s, uint ir, uint clk, Vec delay, uint* cspace)
+{
+  BddMgr* m = &y->m;
+  uint idx = dromidx(mini, ir) | ((clk == CLK_EXEC2) << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS));
+  ulong ctrl = drom[idx];
+  Cpu c;
+  uint op, rl, rloe, rr, rroe, ri, riwe, imm, rrbusoe, aluoe, flagsoe, flagswe;
+  uint iaddrsel, iwe, sele, seliflagssel, cnz, mwe, moe, w16, crst, now, code, i, j;
+  Vec dil, dir, res, bus, addr;
+  Bdd fl[4];
+
+  c.ir = ir;
+  c.mini = mini;
+  op = CTL(ctrl, POS_OP, 4);
+  rl = cpureg(&c, CTL(ctrl, POS_RL, 3));
+  rloe = CTL(ctrl, POS_RLOE, 1);
+  rr = cpureg(&c, CTL(ctrl, POS_RR, 3));
+  rroe = CTL(ctrl, POS_RROE, 1);
+  ri = cpureg(&c, CTL(ctrl, POS_RI, 3));
+  riwe = CTL(ctrl, POS_RIWE, 1);
+  imm = CTL(ctrl, POS_IMM, 3);
+  rrbusoe = CTL(ctrl, POS_RRBUSOE, 1);
+  aluoe = CTL(ctrl, POS_ALUOE, 1);
+  flagsoe = CTL(ctrl, POS_FLAGSOE, 1);
+  flagswe = CTL(ctrl, POS_FLAGSWE, 1);
+  iaddrsel = CTL(ctrl, POS_IADDRSEL, 1);
+  iwe = CTL(ctrl, POS_IWE, 1);
+  sele = CTL(ctrl, POS_SELE, 1);
+  seliflagssel = CTL(ctrl, POS_SELIFLAGSSEL, 1);
+  cnz = CTL(ctrl, POS_CNZ, 1);
+  mwe = CTL(ctrl, POS_MWE, 1);
+  moe = CTL(ctrl, POS_MOE, 1);
+  w16 = CTL(ctrl, POS_W16, 1);
+  crst = CTL(ctrl, POS_CRST, 1);
+
+  if (!mini && (ir >> 13) == 7 && ((ir >> 8) & 3) == 3)
+    rr = ir & 7;
+
+  if (rloe)
+    symrd(s, rl, iaddrsel, dil);
+  else
+    memcpy(dil, delay, sizeof dil);
+  if (cnz)
+    for (i = 0; i < 16; i++)
+      dil[i] = rloe ? bddand(m, dil[i], s->flags[0]) : BDD_FALSE;
+  if (rroe)
+    symrd(s, rr, iaddrsel, dir);
+  else
+    symimm(m, s, ir, imm, dir);
+  symalu(m, op, dil, dir, s->flags[0], res, fl);
+
+  now = (rl == 7) || (!mini && rr == 7);
+  memcpy(addr, iaddrsel ? delay : res, sizeof addr);
+  code = iaddrsel ? *cspace : now;
+
+  vconst(bus, 0xFFFF);
+  if (aluoe)
+    memcpy(bus, res, sizeof bus);
+  if (rrbusoe)
+    symrd(s, rr, iaddrsel, bus);
+  if (flagsoe)
+    memcpy(bus, s->flags, sizeof bus);
+  if (sele && seliflagssel)
+    symselrd(m, s, res, bus);
+  if (moe || mwe)
+  {
+    Bdd pa[22];
+    symphys(m, s, code, addr, w16, pa);
+    if (moe)
+      symread(y, pa, w16, bus);
+    else
+      symaddwrite(y, y->wr, &y->nwr, pa, w16, bus);
+  }
+
+  if (riwe)
+    symwr(s, ri, bus);
+  if (flagswe)
+  {
+    if (seliflagssel)
+      for (i = 0; i < 16; i++)
+        s->flags[i] = ((0x03F0 >> i) & 1) ? bddand(m, s->flags[i], bus[i]) : bus[i];
+    else
+      memcpy(s->flags, fl, sizeof fl);
+  }
+  if (iwe)
+    s->ie = iaddrsel ? bus[0] : (Bdd)seliflagssel;
+  if (sele && !seliflagssel)
+    for (i = 0; i < 8; i++)
+    {
+      Bdd e = veqc(m, res, 3, i);
+      for (j = 0; j < 8; j++)
+        s->sel[i][j] = bddite(m, e, bus[j], s->sel[i][j]);
+    }
+
+  memcpy(delay, res, sizeof res);
+  *cspace = now;
+  return crst;
+}
+
+// Symbolic isarefexec() helpers.
+
+void refrd(const SymState* s, const Bdd* P, const IsaOpnd* o, Vec v)
+{
+  if (!o->reg)
+    vconst(v, o->v);
+  else
+    memcpy(v, (o->v == 7) ? P : s->r[o->v], sizeof(Vec));
+}
+
+// Reads the memory the microcode has read at the same address.
+void refld(Sym* y, const SymState* s, uint code, const Bdd* la, uint wide, Vec v)
+{
+  Bdd pa[22];
+  uint i;
+  symphys(&y->m, s, code, la, wide, pa);
+  for (i = 0; i < y->nrd; i++)
+    if (y->rd[i].w16 == wide && !memcmp(y->rd[i].pa, pa, sizeof pa))
+    {
+      memcpy(v, y->rd[i].val, sizeof(Vec));
+      return;
+    }
+  y->mismatch |= MIS_READS;
+  vconst(v, 0);
+}
+
+void refst(Sym* y, const SymState* s, uint code, const Bdd* la, uint wide, const Bdd* v)
+{
+  Bdd pa[22];
+  symphys(&y->m, s, code, la, wide, pa);
+  symaddwrite(y, y->rwr, &y->nrwr, pa, wide, v);
+}
+
+void reflogic(BddMgr* m, const Bdd* v, Bdd fl[4])
+{
+  fl[0] = BDD_FALSE;
+  fl[1] = vzero(m, v);
+  fl[2] = v[15];
+  fl[3] = BDD_FALSE;
+}
+
+// isarefadd()/isarefsub(). r may be a or b.
+void refadd(BddMgr* m, Vec r, const Bdd* a, const Bdd* b, Bdd cin, Bdd fl[4])
+{
+  Bdd a15 = a[15], b15 = b[15];
+  fl[0] = vadd(m, r, a, b, cin);
+  fl[1] = vzero(m, r);
+  fl[2] = r[15];
+  fl[3] = bddand(m, bddnot(m, bddxor(m, a15, b15)), bddxor(m, a15, r[15]));
+}
+
+void refsub(BddMgr* m, Vec r, const Bdd* a, const Bdd* b, Bdd bin, Bdd fl[4])
+{
+  Bdd a15 = a[15], b15 = b[15];
+  fl[0] = vsub(m, r, a, b, bin);
+  fl[1] = vzero(m, r);
+  fl[2] = r[15];
+  fl[3] = bddand(m, bddxor(m, a15, b15), bddxor(m, a15, r[15]));
+}
+
+// Symbolic isarefexec() for instr (or the hardware interrupt entry if irq).
+// *def receives the condition under which the result is defined.
+int symref(Sym* y, SymState* st, uint instr, int irq, Bdd* def, uint* undef)
+{
+  BddMgr* m = &y->m;
+  SymState s = *st;
+  Vec P, pc, v, a, b, t, la;
+  Bdd fl[4], dummy[4];
+  uint op, n, i, j;
+  IsaOpnd o[4];
+  int isamini = isatab == isa_mini;
+
+  memcpy(pc, s.r[7], sizeof pc);
+  vaddc(m, P, pc, 2);
+  memcpy(fl, s.flags, sizeof fl);
+  memcpy(s.r[7], P, sizeof P);
+  *def = BDD_TRUE;
+  *undef = 0;
+
+  if (irq)
+  {
+    vaddc(m, t, s.r[6], 0xFFFE);
+    pc[0] = s.ie;
+    refst(y, &s, 0, t, 1, pc);
+    s.ie = BDD_FALSE;
+    vconst(s.r[7], 0x3E);
+    *st = s;
+    return ISAREF_OK;
+  }
+
+  op = isarefpd[instr];
+  n = isarefopnds(instr, o);
+
+  switch (op)
+  {
+  case REF_LB:
+  case REF_LW:
+  case REF_SB:
+  case REF_SW:
+  {
+    uint wide = op == REF_LW || op == REF_SW;
+    uint code = (o[1].reg && o[1].v == 7) || (o[2].reg && o[2].v == 7);
+    refrd(&s, P, &o[1], a);
+    refrd(&s, P, &o[2], b);
+    vadd(m, la, a, b, BDD_FALSE);
+    if (wide)
+      *def = bddnot(m, la[0]);
+    if (op == REF_LB || op == REF_LW)
+    {
+      if (op == REF_LB && o[0].v >= 6)
+        return ISAREF_RESERVED;
+      refld(y, &s, code, la, wide, v);
+      symwr(&s, o[0].v, v);
+    }
+    else
+    {
+      if (o[0].v == 7 || (op == REF_SB && o[0].v == 6) || o[0].v == o[1].v)
+        return ISAREF_RESERVED;
+      refst(y, &s, code, la, wide, s.r[o[0].v]);
+    }
+    break;
+  }
+
+  case REF_AND:
+  case REF_OR:
+  case REF_XOR:
+    if (o[0].v >= 6 || (o[1].reg && o[1].v >= 6))
+      return ISAREF_RESERVED;
+    refrd(&s, P, &o[1], b);
+    for (i = 0; i < 16; i++)
+    {
+      Bdd x = s.r[o[0].v][i];
+      v[i] = (op == REF_AND) ? bddand(m, x, b[i]) : (op == REF_OR) ? bddor(m, x, b[i]) : bddxor(m, x, b[i]);
+    }
+    symwr(&s, o[0].v, v);
+    reflogic(m, v, fl);
+    break;
+
+  case REF_CMP:
+    if (isamini && !o[1].reg && o[0].v == 7 && o[1].v == 0xFFFF)
+    {
+      // stc
+      fl[0] = BDD_TRUE, fl[1] = fl[2] = fl[3] = BDD_FALSE;
+      *undef = 14;
+      break;
+    }
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    refrd(&s, P, &o[1], b);
+    refsub(m, t, s.r[o[0].v], b, BDD_FALSE, fl);
+    break;
+
+  case REF_ADD:
+    if (n == 3)
+    {
+      // add rrr, RRR, simm7
+      refrd(&s, P, &o[1], a);
+      vconst(b, o[2].v);
+      vadd(m, v, a, b, BDD_FALSE);
+      if (o[0].v < 6)
+        refadd(m, t, a, b, BDD_FALSE, fl);
+      else if (o[0].v == 7 && (o[2].v & 1))
+        memcpy(s.r[5], P, sizeof P); // link
+      symwr(&s, o[0].v, v);
+      break;
+    }
+    // fallthrough
+  case REF_SUB:
+  case REF_ADC:
+  case REF_SBB:
+    if (o[0].v >= 6 || ((op == REF_ADC || op == REF_SBB) && o[1].v >= 6))
+      return ISAREF_RESERVED;
+    memcpy(a, s.r[o[0].v], sizeof a);
+    refrd(&s, P, &o[1], b);
+    if (op == REF_ADD || op == REF_ADC)
+      refadd(m, v, a, b, (op == REF_ADC) ? s.flags[0] : BDD_FALSE, fl);
+    else
+      refsub(m, v, a, b, (op == REF_SBB) ? s.flags[0] : BDD_FALSE, fl);
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_MOV:
+    if (o[0].v >= 6 || o[1].v == 7)
+      return ISAREF_RESERVED;
+    symwr(&s, o[0].v, s.r[o[1].v]);
+    break;
+
+  case REF_SR:
+  case REF_SL:
+  case REF_RR:
+  case REF_RL:
+  case REF_ASR:
+    if (o[0].v >= 6 || (o[1].reg && o[1].v >= 6) ||
+        (!o[1].reg && (o[1].v == 0 || (op == REF_SL && o[1].v == 1))))
+      return ISAREF_RESERVED;
+    refrd(&s, P, &o[1], b);
+    vshift(m, v, op - REF_SR, s.r[o[0].v], b);
+    symwr(&s, o[0].v, v);
+    reflogic(m, v, fl);
+    break;
+
+  case REF_SAC:
+    if (o[0].v >= 6 || o[1].v >= 6 || (isamini && !o[2].v))
+      return ISAREF_RESERVED;
+    for (i = 0; i < 16; i++)
+      b[i] = (i >= o[2].v) ? s.r[o[1].v][i - o[2].v] : BDD_FALSE;
+    refadd(m, v, s.r[o[0].v], b, BDD_FALSE, fl);
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_ADDM:
+  case REF_SUBM:
+    refrd(&s, P, &o[1], a);
+    vaddc(m, la, a, o[2].v);
+    *def = bddnot(m, la[0]);
+    refld(y, &s, 0, la, 1, s.r[5]);
+    memcpy(a, s.r[o[0].v], sizeof a);
+    if (op == REF_ADDM)
+      refadd(m, v, a, s.r[5], BDD_FALSE, fl);
+    else
+      refsub(m, v, a, s.r[5], BDD_FALSE, fl);
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_INCM:
+  case REF_DECM:
+  case REF_DINCM:
+  case REF_DDECM:
+  {
+    // (rrr) or rrr, (sp + imm)
+    uint d = (op == REF_INCM) ? 1 : (op == REF_DECM) ? 0xFFFF : (op == REF_DINCM) ? 2 : 0xFFFE;
+    if (n == 1)
+      memcpy(la, s.r[o[0].v], sizeof la);
+    else
+    {
+      refrd(&s, P, &o[1], a);
+      vaddc(m, la, a, o[2].v);
+    }
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    *def = bddnot(m, la[0]);
+    refld(y, &s, 0, la, 1, v);
+    symwr(&s, o[0].v, v);
+    vaddc(m, t, v, d);
+    refst(y, &s, 0, la, 1, t);
+    reflogic(m, t, fl);
+    *undef = 9;
+    break;
+  }
+
+  case REF_ADCZ:
+  case REF_ZXT:
+  case REF_SXT:
+  case REF_CPL:
+  case REF_NEG:
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    memcpy(a, s.r[o[0].v], sizeof a);
+    vconst(b, 0);
+    switch (op)
+    {
+    case REF_ADCZ: refadd(m, v, a, b, s.flags[0], fl); break;
+    case REF_ZXT: for (i = 0; i < 16; i++) v[i] = (i < 8) ? a[i] : BDD_FALSE; break;
+    case REF_SXT: for (i = 0; i < 16; i++) v[i] = (i < 8) ? a[i] : a[7]; break;
+    case REF_CPL: for (i = 0; i < 16; i++) v[i] = bddnot(m, a[i]); break;
+    default: refsub(m, v, b, a, BDD_FALSE, fl); break;
+    }
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_PUSH:
+    if (o[0].reg && o[0].v >= 6)
+      return ISAREF_RESERVED;
+    refrd(&s, P, &o[0], v);
+    vaddc(m, s.r[6], s.r[6], 0xFFFE);
+    refst(y, &s, 0, s.r[6], 1, v);
+    break;
+
+  case REF_POP:
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    refld(y, &s, 0, s.r[6], 1, v);
+    vaddc(m, s.r[6], s.r[6], 2);
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_LS5R:
+  case REF_SS5R:
+    if (o[0].v >= 5)
+      return ISAREF_RESERVED;
+    vaddc(m, t, s.r[6], 2);
+    if (op == REF_LS5R)
+    {
+      refld(y, &s, 0, s.r[6], 1, s.r[5]);
+      refld(y, &s, 0, t, 1, v);
+      symwr(&s, o[0].v, v);
+    }
+    else
+    {
+      refst(y, &s, 0, s.r[6], 1, s.r[5]);
+      refst(y, &s, 0, t, 1, s.r[o[0].v]);
+    }
+    break;
+
+  case REF_LAST:
+    vaddc(m, s.r[6], s.r[6], o[0].v);
+    s.r[6][0] = BDD_FALSE;
+    symwr(&s, 7, s.r[5]);
+    break;
+
+  case REF_LI:
+  case REF_LURPC:
+    if (o[0].v >= 6)
+      return ISAREF_RESERVED;
+    if (op == REF_LI)
+      vconst(v, o[1].v);
+    else
+      vaddc(m, v, P, (o[1].v << 7) & 0xFFFF);
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_ADDU:
+    if (o[0].v == 7)
+      return ISAREF_RESERVED;
+    vconst(b, (o[1].v << 7) & 0xFFFF);
+    refadd(m, v, s.r[o[0].v], b, BDD_FALSE, (o[0].v == 6) ? dummy : fl);
+    symwr(&s, o[0].v, v);
+    break;
+
+  case REF_J:
+  case REF_JAL:
+    if (op == REF_JAL)
+      memcpy(s.r[5], P, sizeof P);
+    vaddc(m, v, P, o[0].v);
+    symwr(&s, 7, v);
+    break;
+
+  case REF_JCC:
+  {
+    const IsaSpec* sp = &isatab[isapd[instr]];
+    uint cc = isafield(sp->enc, instr, 'C', NULL) * 8 + isafield(sp->enc, instr, 'c', NULL);
+    if (cc >= 14)
+      return ISAREF_RESERVED;
+    vaddc(m, v, P, o[0].v);
+    vmux(m, v, symcond(m, s.flags, cc), v, P);
+    symwr(&s, 7, v);
+    break;
+  }
+
+  case REF_SWI:
+    vaddc(m, t, s.r[6], 0xFFFE);
+    pc[0] = s.ie;
+    refst(y, &s, 0, t, 1, pc);
+    s.ie = BDD_FALSE;
+    vconst(s.r[7], o[0].v & 0xFFFE);
+    break;
+
+  case REF_RETI:
+    vaddc(m, t, s.r[6], 0xFFFE);
+    refld(y, &s, 0, t, 1, v);
+    s.ie = v[0];
+    symwr(&s, 7, v);
+    break;
+
+  case REF_DI:
+  case REF_EI:
+    s.ie = op == REF_EI;
+    break;
+
+  case REF_MRS:
+  case REF_MSR:
+  {
+    // mrs r, s / msr s, r
+    uint ra = o[op == REF_MRS].v; // selector number register
+    uint rb = o[op == REF_MSR].v; // value register
+    if (ra >= 6 || rb >= 6 || ra == rb)
+      return ISAREF_RESERVED;
+    for (i = 3; i < 16; i++)
+      *def = bddand(m, *def, bddnot(m, s.r[ra][i]));
+    if (op == REF_MRS)
+    {
+      symselrd(m, &s, s.r[ra], v);
+      symwr(&s, rb, v);
+    }
+    else
+      for (i = 0; i < 8; i++)
+      {
+        Bdd e = veqc(m, s.r[ra], 3, i);
+        for (j = 0; j < 8; j++)
+          s.sel[i][j] = bddite(m, e, s.r[rb][j], s.sel[i][j]);
+      }
+    break;
+  }
+
+  case REF_STC:
+    fl[0] = BDD_TRUE, fl[1] = fl[2] = fl[3] = BDD_FALSE;
+    *undef = 14;
+    break;
+
+  case REF_MF2:
+    for (i = 0; i < 16; i++)
+      s.flags[i] = ((0x03F0 >> i) & 1) ? bddand(m, s.flags[i], s.r[2][i]) :
+                   ((0xFC0F >> i) & 1) ? s.r[2][i] : BDD_FALSE;
+    memcpy(fl, s.flags, sizeof fl);
+    break;
+
+  case REF_M2F:
+    memcpy(s.r[2], s.flags, sizeof s.flags);
+    break;
+
+  case REF_ADD22ADC33:
+    refadd(m, s.r[2], s.r[2], s.r[2], BDD_FALSE, fl);
+    refadd(m, s.r[3], s.r[3], s.r[3], fl[0], fl);
+    break;
+
+  case REF_CADD24:
+  case REF_CADD24ADC3Z:
+    for (i = 0; i < 16; i++)
+      b[i] = bddand(m, s.flags[0], s.r[4][i]);
+    refadd(m, s.r[2], s.r[2], b, BDD_FALSE, fl);
+    if (op == REF_CADD24ADC3Z)
+    {
+      vconst(b, 0);
+      refadd(m, s.r[3], s.r[3], b, fl[0], fl);
+    }
+    break;
+
+  case REF_CSUB34:
+    refsub(m, s.r[3], s.r[3], s.r[4], BDD_FALSE, fl);
+    for (i = 0; i < 16; i++)
+      b[i] = bddand(m, fl[0], s.r[4][i]);
+    refadd(m, s.r[3], s.r[3], b, BDD_FALSE, fl);
+    break;
+
+  default:
+    return ISAREF_RESERVED;
+  }
+
+  memcpy(s.flags, fl, sizeof fl);
+  *st = s;
+  return ISAREF_OK;
+}
+
+uint veval(const BddMgr* m, const Bdd* v, uint bits, const uchar* asg)
+{
+  uint r = 0, i;
+  for (i = 0; i < bits; i++)
+    r |= (uint)bddeval(m, v[i], asg) << i;
+  return r;
+}
+
+ulong paeval(const BddMgr* m, const Bdd* pa, const uchar* asg)
+{
+  ulong r = 0;
+  uint i;
+  for (i = 0; i < 22; i++)
+    r |= (ulong)bddeval(m, pa[i], asg) << i;
+  return r;
+}
+
+// Proves that the microcode executes instr (or enters the hardware ISR if
+// irq) like the reference model. Describes the failure in buf if it's not
+// NULL.
+int prove(Sym* y, uint instr, int irq, char* buf)
+{
+  BddMgr* m = &y->m;
+  SymState s0, sm, sr;
+  Vec delay;
+  Bdd def, pend = BDD_FALSE, pre, diff = BDD_FALSE, wdiff[MAX_WRITES];
+  uint undef, i, j, cspace = 0, ir = irq ? SWI_IRQ : instr, used = 0, wmap[MAX_WRITES];
+  static uchar asgs[NVARS];
+  uchar* asg = buf ? asgs : NULL;
+
+  bddreset(m);
+  y->nrd = y->nwr = y->nrwr = 0;
+  y->mismatch = 0;
+
+  for (i = 0; i < 8; i++)
+    for (j = 0; j < 16; j++)
+      s0.r[i][j] = (i >= 6 && !j) ? BDD_FALSE : bddvar(m, VAR(i, j));
+  for (j = 0; j < 16; j++)
+    s0.flags[j] = bddvar(m, VAR(SLOT_FLAGS, j));
+  s0.ie = bddvar(m, VAR_IE);
+  for (i = 0; i < 8; i++)
+    for (j = 0; j < 8; j++)
+      s0.sel[i][j] = bddvar(m, VAR_SEL + j * 8 + i);
+
+  // The microcode: the fetch, then the execute cycles.
+  sm = s0;
+  vaddc(m, delay, sm.r[6], 0xFFFE);
+  vaddc(m, sm.r[7], sm.r[7], 2);
+  if (!symcycle(y, &sm, ir, CLK_EXEC1, delay, &cspace) &&
+      !symcycle(y, &sm, ir, CLK_EXEC2, delay, &cspace))
+  {
+    // Not reachable with a decoder ROM emu.h accepts.
+    if (buf)
+      sprintf(buf, "      no CRST in execute2\n");
+    return PROOF_FAILED;
+  }
+
+  sr = s0;
+  if (symref(y, &sr, instr, irq, &def, &undef) != ISAREF_OK)
+    return PROOF_RESERVED;
+
+  for (i = 0; i < IRQ_CNT; i++)
+    pend = bddor(m, pend, bddand(m, s0.flags[10 + i], s0.flags[4 + i]));
+  pend = bddand(m, pend, s0.ie);
+  pre = irq ? pend : bddand(m, def, bddnot(m, pend));
+  if (pre == BDD_FALSE)
+    return m->overflow ? PROOF_NODES : PROOF_RESERVED;
+
+  for (i = 0; i < 8; i++)
+    diff = bddor(m, diff, vdiff(m, sm.r[i], sr.r[i], 16, 0xFFFF));
+  diff = bddor(m, diff, vdiff(m, sm.flags, sr.flags, 16, ~undef));
+  diff = bddor(m, diff, bddxor(m, sm.ie, sr.ie));
+  for (i = 0; i < 8; i++)
+    diff = bddor(m, diff, vdiff(m, sm.sel[i], sr.sel[i], 8, 0xFF));
+
+  // Memory writes, matched by address.
+  if (y->nwr != y->nrwr)
+    y->mismatch |= MIS_WRITES;
+  for (i = 0; i < y->nrwr; i++)
+  {
+    wdiff[i] = BDD_FALSE;
+    for (j = 0; j < y->nwr; j++)
+      if (!(used & (1U << j)) && y->wr[j].w16 == y->rwr[i].w16 &&
+          !memcmp(y->wr[j].pa, y->rwr[i].pa, sizeof y->wr[j].pa))
+        break;
+    if (j == y->nwr)
+    {
+      y->mismatch |= MIS_WRITES;
+      continue;
+    }
+    used |= 1U << j;
+    wmap[i] = j;
+    wdiff[i] = vdiff(m, y->wr[j].val, y->rwr[i].val, 16, 0xFFFF);
+    diff = bddor(m, diff, wdiff[i]);
+  }
+
+  diff = bddand(m, pre, diff);
+  if (m->overflow)
+    return PROOF_NODES;
+  if (diff == BDD_FALSE && !y->mismatch)
+    return PROOF_OK;
+  if (!buf)
+    return PROOF_FAILED;
+
+  // Report a counterexample.
+  if (y->mismatch)
+  {
+    buf += sprintf(buf, "      the models access different memory:");
+    if (y->mismatch & MIS_READS)
+      buf += sprintf(buf, " reads (the microcode makes %u)", y->nrd);
+    if (y->mismatch & MIS_WRITES)
+      buf += sprintf(buf, " writes (%u, ref %u)", y->nwr, y->nrwr);
+    buf += sprintf(buf, "\n");
+    if (diff == BDD_FALSE)
+      diff = pre;
+  }
+  bddsat(m, diff, asg, NVARS);
+  buf += sprintf(buf, "      state:");
+  for (i = 0; i < 8; i++)
+    if (veval(m, sm.r[i], 16, asg) != veval(m, sr.r[i], 16, asg))
+      buf += sprintf(buf, " %s=%04X (ref %04X)", isa_regs[i],
+                     veval(m, sm.r[i], 16, asg), veval(m, sr.r[i], 16, asg));
+  if ((veval(m, sm.flags, 16, asg) ^ veval(m, sr.flags, 16, asg)) & ~undef)
+    buf += sprintf(buf, " flags=%04X (ref %04X)", veval(m, sm.flags, 16, asg), veval(m, sr.flags, 16, asg));
+  if (bddeval(m, sm.ie, asg) != bddeval(m, sr.ie, asg))
+    buf += sprintf(buf, " ie=%u (ref %u)", bddeval(m, sm.ie, asg), bddeval(m, sr.ie, asg));
+  for (i = 0; i < 8; i++)
+    if (veval(m, sm.sel[i], 8, asg) != veval(m, sr.sel[i], 8, asg))
+      buf += sprintf(buf, " sel%u=%02X (ref %02X)", i, veval(m, sm.sel[i], 8, asg), veval(m, sr.sel[i], 8, asg));
+  for (i = 0; i < y->nrwr; i++)
+    if (wdiff[i] != BDD_FALSE && bddeval(m, wdiff[i], asg))
+    {
+      const SymAcc* w = &y->wr[wmap[i]];
+      buf += sprintf(buf, " [%06lX]%s=%04X (ref %04X)", paeval(m, w->pa, asg), w->w16 ? "w" : "b",
+                     veval(m, w->val, 16, asg), veval(m, y->rwr[i].val, 16, asg));
+    }
+  buf += sprintf(buf, "\n      before:");
+  for (i = 0; i < 8; i++)
+    buf += sprintf(buf, " %s=%04X", isa_regs[i], veval(m, s0.r[i], 16, asg));
+  buf += sprintf(buf, " flags=%04X ie=%u sel=", veval(m, s0.flags, 16, asg), bddeval(m, s0.ie, asg));
+  for (i = 0; i < 8; i++)
+    buf += sprintf(buf, "%02X%s", veval(m, s0.sel[i], 8, asg), (i < 7) ? "," : "");
+  for (i = 0; i < y->nrd; i++)
+    buf += sprintf(buf, "%s[%06lX]%s=%04X", i ? ", " : "\n      memory: ", paeval(m, y->rd[i].pa, asg),
+                   y->rd[i].w16 ? "w" : "b", veval(m, y->rd[i].val, 16, asg));
+  return PROOF_FAILED;
+}
+
+// Proves instruction words first, first + step, first + 2 * step, ...
+void* job(void* arg)
+{
+  Job* j = arg;
+  Sym* y = malloc(sizeof *y);
+  uint instr;
+  if (!y)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  bddinit(&y->m, NODE_BITS);
+  for (instr = j->first; instr < 0x10000; instr += j->step)
+    result[instr] = prove(y, instr, 0, NULL);
+  bddreset(&y->m);
+  j->peak = y->m.peak;
+  bddfree(&y->m);
+  free(y);
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, verbose = 0, nthreads = 4;
+  uint i, e, nentries, instr, peak = 0, irqres;
+  ulong tot[4] = { 0 };
+  static char desc[4096];
+  Job* jobs;
+  pthread_t* thr;
+  Sym* y;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-v"))
+      verbose = 1;
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  isasym [options] <decoder_rom_file>\n"
+            "Options:\n"
+            "  -be       big-endian input file\n"
+            "  -j <n>    number of threads (default: 4)\n"
+            "  -v        report every failed instruction word\n");
+    exit(EXIT_FAILURE);
+  }
+
+  mini = loaddrom(argv[i], drom, bigendian);
+  isainit(mini);
+  isarefinit();
+
+  jobs = calloc(nthreads, sizeof *jobs);
+  thr = calloc(nthreads, sizeof *thr);
+  y = malloc(sizeof *y);
+  if (!jobs || !thr || !y)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+  {
+    jobs[i].first = i;
+    jobs[i].step = nthreads;
+    if (pthread_create(&thr[i], NULL, job, &jobs[i]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (i = 0; i < (uint)nthreads; i++)
+  {
+    pthread_join(thr[i], NULL);
+    if (jobs[i].peak > peak)
+      peak = jobs[i].peak;
+  }
+
+  bddinit(&y->m, NODE_BITS);
+
+  // Per specification entry.
+  for (nentries = 0; strcmp(isatab[nentries].enc, "????????????????"); nentries++)
+    ;
+  printf("%-16s %-12s %-22s %6s %6s %8s %6s\n",
+         "encoding", "instruction", "operands", "words", "proved", "reserved", "failed");
+  for (e = 0; e <= nentries; e++)
+  {
+    ulong cnt[4] = { 0 };
+    uint nreported = 0;
+    for (instr = 0; instr < 0x10000; instr++)
+      if (isapd[instr] == e)
+        cnt[result[instr]]++;
+    if (!(cnt[0] + cnt[1] + cnt[2] + cnt[3]))
+      continue;
+    printf("%-16s %-12s %-22s %6lu %6lu %8lu %6lu\n", isatab[e].enc, isatab[e].name, isatab[e].ops,
+           cnt[0] + cnt[1] + cnt[2] + cnt[3], cnt[PROOF_OK], cnt[PROOF_RESERVED],
+           cnt[PROOF_FAILED] + cnt[PROOF_NODES]);
+    for (i = 0; i < 4; i++)
+      tot[i] += cnt[i];
+    for (instr = 0; instr < 0x10000; instr++)
+      if (isapd[instr] == e && result[instr] >= PROOF_FAILED && (verbose || nreported++ < MAX_REPORT))
+      {
+        char dis[64];
+        isadis(instr, dis);
+        if (result[instr] == PROOF_NODES)
+          printf("  %04X %-26s out of BDD nodes\n", instr, dis);
+        else
+        {
+          prove(y, instr, 0, desc);
+          printf("  %04X %-26s fails:\n%s\n", instr, dis, desc);
+        }
+      }
+  }
+
+  irqres = prove(y, 0, 1, desc);
+  printf("\nhardware interrupt entry: %s\n", (irqres == PROOF_OK) ? "proved" :
+         (irqres == PROOF_NODES) ? "out of BDD nodes" : "fails:");
+  if (irqres == PROOF_FAILED)
+    printf("%s\n", desc);
+
+  printf("\n%s variant: %lu instruction words, %lu proved, %lu reserved, %lu failed "
+         "(%lu out of BDD nodes), peak BDD nodes per word: %u\n",
+         mini ? "MINI" : "full", tot[0] + tot[1] + tot[2] + tot[3], tot[PROOF_OK],
+         tot[PROOF_RESERVED], tot[PROOF_FAILED] + tot[PROOF_NODES], tot[PROOF_NODES], peak);
+  return (tot[PROOF_FAILED] + tot[PROOF_NODES] || irqres != PROOF_OK) ? EXIT_FAILURE : 0;
+}
@@ -71,11 +71,24 @@ enum
   POS_CRST
 };
 
+typedef unsigned char uchar;
 typedef unsigned short ushort;
 typedef unsigned uint;
 typedef unsigned long ulong;
 
+#include "isa.h"
+
+// The decoder ROM built into the emulator (written with -romh), to make
+// sure it's regenerated along with the ROM. emu.h's DROM_ROW() and
+// DROM_ROW2() check its rows when the emulator is compiled.
+#define DROM_ROW(v) (v)
+#define DROM_ROW2(v) (v)
+#include "drom_mini.h"
+
+STATIC_ASSERT(sizeof drom_mini_rom / sizeof drom_mini_rom[0] == IN_CNT);
+
 ulong rom[IN_CNT];
+ulong filler; // the reserved instructions' row
 
 uint idx0_6(uint clk, uint n0_6, uint rrr, uint L/*bit 0*/)
 {
@@ -89,6 +102,17 @@ uint idx7(uint clk, uint b6/*bit 6*/, uint b54/*bits 5,4*/, uint b30/*bits 3-0*/
          (b6 << 6) | (b54 << 4) | b30;
 }
 
+// The instruction compressor in front of the decoder ROM,
+// mapping an instruction word to its decoder ROM row index (clk=0) with
+// idx0_6() and idx7().
+uint instridx(uint instr)
+{
+  uint n = instr >> 13;
+  if (n != 7)
+    return idx0_6(0, n, (instr >> 10) & 7, instr & 1);
+  return idx7(0, (instr >> 6) & 1, (instr >> 4) & 3, instr & 15);
+}
+
 void fill(uint idx,
           ulong CRST,
           ulong MOE, ulong MWE, ulong W16,
@@ -109,33 +133,39 @@ void fill(uint idx,
              (IWE << POS_IWE) | (SELE << POS_SELE) | (SELIFLAGSSEL << POS_SELIFLAGSSEL);
 }
 
-FILE* startup(int argc, char* argv[], char** outname, int* bigendian)
+FILE* startup(int argc, char* argv[], char** outname, int* bigendian,
+              char** cpiname, char** cpihname, char** romhname)
 {
   FILE* f;
+  int i;
 
-  if (argc < 2 || argc > 3)
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      *bigendian = 1;
+    else if (!strcmp(argv[i], "-cpi") && i + 1 < argc)
+      *cpiname = argv[++i];
+    else if (!strcmp(argv[i], "-cpih") && i + 1 < argc)
+      *cpihname = argv[++i];
+    else if (!strcmp(argv[i], "-romh") && i + 1 < argc)
+      *romhname = argv[++i];
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
   {
 lusage:
     fprintf(stderr,
             "Usage:\n"
             "  mkdrom [options] <output_file>\n"
             "Options:\n"
-            "  -be   big-endian output\n");
+            "  -be           big-endian output\n"
+            "  -cpi <file>   write clock cycles per instruction (text table)\n"
+            "  -cpih <file>  write clock cycles per instruction (C header)\n"
+            "  -romh <file>  write the decoder ROM (C header for emu.c)\n");
     exit(EXIT_FAILURE);
   }
-
-  if ((*bigendian = !strcmp(argv[1], "-be")) != 0)
-  {
-    if (argc < 3)
-      goto lusage;
-    *outname = argv[2];
-  }
-  else
-  {
-    if (argc > 2)
-      goto lusage;
-    *outname = argv[1];
-  }
+  *outname = argv[i];
 
   if ((f = fopen(*outname, "wb")) == NULL)
   {
@@ -170,11 +200,121 @@ void writebytes(FILE* f, char* outname, int bigendian, int nbytes, ulong value)
   }
 }
 
+// Clock cycles taken by the instruction, including the fetch cycle.
+uint cpi(uint instr)
+{
+  return ((rom[instridx(instr)] >> POS_CRST) & 1) ? 2 : 3;
+}
+
+void closeout(FILE* f, const char* name)
+{
+  if (ferror(f) | fclose(f))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+}
+
+// Writes "instruction clocks" lines for all 65536 instruction words.
+void writecpi(const char* name)
+{
+  FILE* f;
+  uint instr;
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  for (instr = 0; instr <= 0xFFFF; instr++)
+    fprintf(f, "%04X %u\n", instr, cpi(instr));
+  closeout(f, name);
+}
+
+// Writes a C header with the same information indexed by the compressed
+// instruction (the decoder ROM index) and the compressor itself.
+void writecpih(const char* name)
+{
+  FILE* f;
+  uint idx;
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f,
+          "// Generated by mkdrom_mini.c, do not edit.\n"
+          "// Clock cycles per instruction, including the fetch cycle.\n"
+          "\n"
+          "#ifndef DROM_MINI_CPI_H\n"
+          "#define DROM_MINI_CPI_H\n"
+          "\n"
+          "static const unsigned char drom_mini_cpi_tab[%u] =\n"
+          "{\n", 1U << INSTR_BITS);
+  for (idx = 0; idx < 1U << INSTR_BITS; idx++)
+    fprintf(f, "%s%u%s", (idx % 32) ? " " : "  ", ((rom[idx] >> POS_CRST) & 1) ? 2 : 3,
+            (idx + 1 == 1U << INSTR_BITS) ? "\n" : (idx % 32 == 31) ? ",\n" : ",");
+  fprintf(f, "};\n\n");
+  fprintf(f,
+          "static inline unsigned drom_mini_idx(unsigned instr)\n"
+          "{\n"
+          "  unsigned n = instr >> 13;\n"
+          "  if (n != 7)\n"
+          "    return (n << 4) | (((instr >> 10) & 7) << 1) | (instr & 1);\n"
+          "  return (1u << 7) | (instr & 0x7F);\n"
+          "}\n"
+          "\n"
+          "static inline unsigned drom_mini_cpi(unsigned instr)\n"
+          "{\n"
+          "  return drom_mini_cpi_tab[drom_mini_idx(instr & 0xFFFF)];\n"
+          "}\n"
+          "\n"
+          "#endif\n");
+  closeout(f, name);
+}
+
+// Writes a C header with the decoder ROM for building it into the emulator.
+// DROM_ROW() and DROM_ROW2() (emu.h) check the rows at compile time.
+void writeromh(const char* name)
+{
+  FILE* f;
+  uint idx;
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f,
+          "// Generated by mkdrom_mini.c, do not edit.\n"
+          "// The decoder ROM (drom_mini.bin) built into the emulator, include after emu.h.\n"
+          "\n"
+          "#ifndef DROM_MINI_H\n"
+          "#define DROM_MINI_H\n"
+          "\n"
+          "const ulong drom_mini_rom[%u] =\n"
+          "{\n", IN_CNT);
+  for (idx = 0; idx < IN_CNT; idx++)
+  {
+    if (idx == 0 || idx == 1U << INSTR_BITS)
+      fprintf(f, "  // %s\n", idx ? "execute2" : "execute1");
+    fprintf(f, "%s%s(0x%08lXUL)%s", (idx % 4) ? " " : "  ",
+            (idx < 1U << INSTR_BITS) ? "DROM_ROW" : "DROM_ROW2", rom[idx],
+            (idx + 1 == IN_CNT) ? "\n" : (idx % 4 == 3) ? ",\n" : ",");
+  }
+  fprintf(f,
+          "};\n"
+          "\n"
+          "#endif\n");
+  closeout(f, name);
+}
+
 int main(int argc, char* argv[])
 {
   int bigendian = 0;
   char* outname = NULL;
-  FILE* f = startup(argc, argv, &outname, &bigendian);
+  char* cpiname = NULL;
+  char* cpihname = NULL;
+  char* romhname = NULL;
+  FILE* f = startup(argc, argv, &outname, &bigendian, &cpiname, &cpihname, &romhname);
   uint rrr, w, L, b6, b30;
 
 #if 0
@@ -203,6 +343,7 @@ int main(int argc, char* argv[])
            /*RRBUSOE*/0,
            /*IWE*/0, /*SELE*/0, /*SELIFLAGSSEL*/0);
     }
+    filler = rom[0];
   }
 
 /*
@@ -680,6 +821,8 @@ int main(int argc, char* argv[])
       {
         if (b30 & 1) // mrs
         {
+          // The whole s, not just s & 7, reaches the selector register block, so
+          // the block alone can give meaning to s >= 8 (see emu -perf).
           fill(/*idx*/idx,
                /*CRST*/1,
                /*MOE*/0, /*MWE*/0, /*W16*/0,
@@ -827,6 +970,21 @@ int main(int argc, char* argv[])
     }
   }
 
+  // The microcode must agree with the instruction set specification.
+  isainit(1);
+  if (isachkdrom(rom, instridx, filler, stderr))
+  {
+    fprintf(stderr, "The decoder ROM doesn't match isa.h\n");
+    exit(EXIT_FAILURE);
+  }
+
+  // The emulator's copy must be regenerated along with the ROM.
+  if (!romhname && memcmp(rom, drom_mini_rom, sizeof rom))
+  {
+    fprintf(stderr, "drom_mini.h is out of date, regenerate it with -romh drom_mini.h\n");
+    exit(EXIT_FAILURE);
+  }
+
   {
     uint idx;
     for (idx = 0; idx < IN_CNT; idx++)
@@ -837,5 +995,11 @@ int main(int argc, char* argv[])
       exit(EXIT_FAILURE);
     }
   }
+  if (cpiname)
+    writecpi(cpiname);
+  if (cpihname)
+    writecpih(cpihname);
+  if (romhname)
+    writeromh(romhname);
   return 0;
 }
@@ -0,0 +1,199 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 instruction encoder generator.
+
+  Writes isaenc.h, a C header with an encoder macro for every entry of the
+  instruction set specification (isa.h) that names one (mac). The macro
+  ENC_<mac>() takes the values of the entry's fields in the order they
+  first appear in its encoding (the fields fixed by constraints like
+  "r=sp" are left out) and yields the instruction word, with the ignored
+  bits encoded as isaenc() does. The assembler macros of mktesti.c add the
+  operand checks on top of these.
+
+  How to compile: gcc -std=c99 -O2 -Wall mkisaenc.c -o mkisaenc.exe
+*/
+
+#include "emu.h"
+#include "isa.h"
+
+// Macro parameter names of the fields.
+const char* paramname(int c)
+{
+  static const struct { char f; const char* name; } names[] =
+  {
+    { 'r', "rrr" }, { 'R', "RRR" }, { 'P', "PPP" }, { 'q', "qqq" },
+    { '4', "imm4" }, { '7', "imm7" }, { '9', "imm9" }, { 'e', "imm11" },
+    { 'c', "cond" }, { 'C', "C" }, { 'o', "op" }, { 'n', "n" }
+  };
+  uint i;
+  for (i = 0; i < sizeof names / sizeof names[0]; i++)
+    if (names[i].f == c)
+      return names[i].name;
+  return NULL;
+}
+
+// Finds the fields the constraints of s fix to a constant (e.g. "r=sp"),
+// storing their values in fixed[] (the others are left at -1).
+void fixedfields(const IsaSpec* s, long fixed[128])
+{
+  const char* p = s->when;
+  while (*p)
+  {
+    int f = (uchar)*p++;
+    int eq = *p == '=';
+    while (*p == '=' || *p == '!' || *p == '<' || *p == '>')
+      p++;
+    if (eq && ((*p >= '0' && *p <= '9') || !strncmp(p, "sp", 2) || !strncmp(p, "pc", 2)))
+      fixed[f] = isawhenval(&p, s->enc, 0);
+    else
+      isawhenval(&p, s->enc, 0);
+    while (*p == ' ')
+      p++;
+  }
+}
+
+// Writes the encoder macros of a specification table.
+void writetab(FILE* f, const IsaSpec* tab, const char* variant)
+{
+  const IsaSpec* s;
+  const IsaSpec* t;
+  for (s = tab; ; s++)
+  {
+    long fixed[128];
+    uint base = 0, i, j, w;
+    char def[64], body[512] = "";
+    char* d = def;
+    char* b = body;
+    if (*s->mac)
+    {
+      for (t = tab; t != s; t++)
+        if (!strcmp(t->mac, s->mac))
+        {
+          fprintf(stderr, "Duplicate encoder ENC_%s in the %s variant\n", s->mac, variant);
+          exit(EXIT_FAILURE);
+        }
+      for (i = 0; i < 128; i++)
+        fixed[i] = -1;
+      fixedfields(s, fixed);
+
+      d += sprintf(d, "#define ENC_%s(", s->mac);
+      for (i = 0; i < 16; i++)
+      {
+        int c = (uchar)s->enc[i];
+        if (c == '0' || c == 'I' || c == '1' || c == '?')
+        {
+          base |= (uint)(c == '1' || c == 'I') << (15 - i);
+          continue;
+        }
+        if (!paramname(c))
+        {
+          fprintf(stderr, "Unknown field '%c' in \"%s\"\n", c, s->enc);
+          exit(EXIT_FAILURE);
+        }
+        isafield(s->enc, 0, c, &w);
+        if (fixed[c] >= 0)
+        {
+          uint pos = 0;
+          if (fixed[c] >> w)
+          {
+            fprintf(stderr, "Constraint \"%s\" doesn't fit \"%s\"\n", s->when, s->enc);
+            exit(EXIT_FAILURE);
+          }
+          for (j = i + 1; j < 16; j++)
+            pos += s->enc[j] == c;
+          base |= (uint)((fixed[c] >> pos) & 1) << (15 - i);
+          continue;
+        }
+        if (strchr(s->enc, c) == &s->enc[i])
+          d += sprintf(d, "%s%s", (d[-1] == '(') ? "" : ",", paramname(c));
+
+        // A run of the field's bits: (value >> its bits after the run & mask) << position.
+        {
+          uint n = 1, after = 0;
+          while (i + n < 16 && s->enc[i + n] == c)
+            n++;
+          for (j = i + n; j < 16; j++)
+            after += s->enc[j] == c;
+          b += sprintf(b, " | ((unsigned)(%s)", paramname(c));
+          if (after)
+            b += sprintf(b, " >> %u", after);
+          b += sprintf(b, " & 0x%XU)", (1U << n) - 1);
+          if (16 - i - n)
+            b += sprintf(b, " << %u", 16 - i - n);
+          i += n - 1;
+        }
+      }
+      sprintf(d, ")");
+      fprintf(f, "%-32s (0x%04XU%s)\n", def, base, body);
+    }
+    if (!strcmp(s->enc, "????????????????"))
+      break;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  FILE* f;
+  if (argc != 2)
+  {
+    fprintf(stderr,
+            "Usage:\n"
+            "  mkisaenc <output_file>\n");
+    exit(EXIT_FAILURE);
+  }
+  if ((f = fopen(argv[1], "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", argv[1]);
+    exit(EXIT_FAILURE);
+  }
+  fprintf(f,
+          "// Generated by mkisaenc.c from isa.h, do not edit.\n"
+          "// The instruction encoders the assembler macros of mktesti.c are built on.\n"
+          "\n"
+          "#ifndef ISAENC_H\n"
+          "#define ISAENC_H\n"
+          "\n"
+          "#if !MINI\n"
+          "\n");
+  writetab(f, isa_full, "full");
+  fprintf(f,
+          "\n"
+          "#else // MINI\n"
+          "\n");
+  writetab(f, isa_mini, "MINI");
+  fprintf(f,
+          "\n"
+          "#endif // MINI\n"
+          "\n"
+          "#endif\n");
+  if (ferror(f) | fclose(f))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", argv[1]);
+    exit(EXIT_FAILURE);
+  }
+  return 0;
+}
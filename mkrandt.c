@@ -0,0 +1,401 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 random test generator.
+
+  Generates a self-checking test program in the form of mktesti.c: a C
+  file with constrained-random blocks of instructions written with the
+  mktesti.c assembler macros, each block followed by the checks of the
+  arithmetic flags (expect_c()/expect_nc() etc) and of the registers
+  (expect_r16()) that the reference instruction set model of isaref.h
+  computes. The generated file includes mktesti.c (see THIS_FILE there),
+  so compiling and running it makes the test ROM and its listing.
+
+  Every block starts from random register values and flags, the stack
+  pointer at 0x1000, and consists of ALU, shift, load/store and stack
+  instructions whose operands obey the restrictions of the RQ() checks
+  of the macros (no sp or pc destinations, no reserved shift counts,
+  etc). Loads only read memory written earlier, so the test doesn't
+  depend on the initial RAM contents.
+
+  How to compile: gcc -std=c99 -O2 -Wall mkrandt.c -o mkrandt.exe
+
+  How to use:
+    ./mkrandt.exe -seed 1 randt.c
+    gcc -std=c99 -O2 -Wall randt.c -o randt.exe
+    ./randt.exe -be randt.bin > randt.lst
+  (add -mini to the first command and -DMINI=1 to the second for the MINI
+  variant; the generated file has to be next to mktesti.c)
+*/
+
+#include "emu.h"
+#include "isa.h"
+#include "isaref.h"
+
+enum
+{
+  MAX_WORDS   = ROM_SIZE / 2, // test ROM size
+  STACK_TOP   = 0x1000,
+  STACK_MIN   = 0x0F40,
+  STACK_MAX   = 0x1040,
+  CODE_LA     = 0x0100,       // where the reference model fetches from
+  // Words per block besides the random instructions:
+  // li16(r0), addi(sp), 6 * li16(), push(r2), li16(r2), mf2(), pop(r2)
+  // 4 flag checks, 6 * expect_r16(), mov(r0, sp), expect_r16(r0)
+  BLOCK_WORDS = 2 + 1 + 6 * 2 + 1 + 2 + 1 + 1 + 4 + 6 * 5 + 1 + 5
+};
+
+// Instruction classes: a mktesti.c macro, the instruction (REF_*) and
+// the operands it takes: r = r0...r5, s = r0...r5 or sp, S = sp,
+// i = immediate, n = non-zero immediate.
+typedef struct
+{
+  const char* macro;
+  uint op;
+  const char* shape;
+  uint first, cnt; // instruction words in words[]
+} Class;
+
+Class classes[] =
+{
+  { "li", REF_LI, "ri", 0, 0 }, { "addu", REF_ADDU, "ri", 0, 0 }, { "addi", REF_ADD, "rsi", 0, 0 },
+  { "andi", REF_AND, "ri", 0, 0 }, { "ori", REF_OR, "ri", 0, 0 }, { "xori", REF_XOR, "ri", 0, 0 },
+  { "cmpi", REF_CMP, "ri", 0, 0 },
+  { "and", REF_AND, "rr", 0, 0 }, { "or", REF_OR, "rr", 0, 0 }, { "xor", REF_XOR, "rr", 0, 0 },
+  { "add", REF_ADD, "rs", 0, 0 }, { "sub", REF_SUB, "rs", 0, 0 }, { "cmp", REF_CMP, "rs", 0, 0 },
+  { "adc", REF_ADC, "rr", 0, 0 }, { "sbb", REF_SBB, "rr", 0, 0 }, { "mov", REF_MOV, "rs", 0, 0 },
+  { "sr", REF_SR, "rr", 0, 0 }, { "sl", REF_SL, "rr", 0, 0 }, { "rr", REF_RR, "rr", 0, 0 },
+  { "rl", REF_RL, "rr", 0, 0 }, { "asr", REF_ASR, "rr", 0, 0 },
+  { "sri", REF_SR, "ri", 0, 0 }, { "sli", REF_SL, "ri", 0, 0 }, { "asri", REF_ASR, "ri", 0, 0 },
+  { "rli", REF_RL, "ri", 0, 0 }, { "sac", REF_SAC, "rrn", 0, 0 },
+  { "zxt", REF_ZXT, "r", 0, 0 }, { "sxt", REF_SXT, "r", 0, 0 }, { "cpl", REF_CPL, "r", 0, 0 },
+  { "neg", REF_NEG, "r", 0, 0 }, { "adcz", REF_ADCZ, "r", 0, 0 },
+  { "add22adc33", REF_ADD22ADC33, "", 0, 0 }, { "cadd24", REF_CADD24, "", 0, 0 },
+  { "cadd24adc3z", REF_CADD24ADC3Z, "", 0, 0 }, { "csub34", REF_CSUB34, "", 0, 0 },
+  { "push", REF_PUSH, "r", 0, 0 }, { "pushi", REF_PUSH, "i", 0, 0 }, { "pop", REF_POP, "r", 0, 0 },
+  { "lw", REF_LW, "rSi", 0, 0 }, { "lb", REF_LB, "rSi", 0, 0 },
+  { "sw", REF_SW, "rSi", 0, 0 }, { "sb", REF_SB, "rSi", 0, 0 }
+};
+
+enum { NCLASSES = sizeof classes / sizeof classes[0] };
+
+ushort words[0x10000];
+
+uchar mem[MEM_SIZE]; // what the reference model reads
+uchar written[0x10000]; // data space bytes written by the test
+
+const uint edges[] =
+{
+  0x0000, 0x0001, 0x0002, 0x000F, 0x0010, 0x007F, 0x0080, 0x00FF,
+  0x0100, 0x3FFF, 0x4000, 0x7FFE, 0x7FFF, 0x8000, 0x8001, 0xFFFE, 0xFFFF
+};
+
+ulong rnd(ulong* x)
+{
+  // splitmix64
+  unsigned long long z = (*x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (ulong)(z ^ (z >> 31));
+}
+
+uint rndn(ulong* x, uint n)
+{
+  return (uint)((rnd(x) >> 8) % n);
+}
+
+uint rndvalue(ulong* x)
+{
+  switch (rndn(x, 4))
+  {
+  case 0: return edges[rndn(x, sizeof edges / sizeof edges[0])];
+  case 1: return rndn(x, 16); // shift counts
+  default: return rndn(x, 0x10000);
+  }
+}
+
+// Tells whether the operands of instr have the shape of the class.
+int fits(const Class* c, uint instr)
+{
+  IsaOpnd o[4];
+  uint n = isarefopnds(instr, o), i;
+  if (isarefpd[instr] != c->op || n != strlen(c->shape))
+    return 0;
+  for (i = 0; i < n; i++)
+    switch (c->shape[i])
+    {
+    case 'r': if (!o[i].reg || o[i].v > 5) return 0; break;
+    case 's': if (!o[i].reg || o[i].v > 6) return 0; break;
+    case 'S': if (!o[i].reg || o[i].v != 6) return 0; break;
+    case 'n': if (o[i].reg || !o[i].v) return 0; break;
+    default: if (o[i].reg) return 0; break;
+    }
+  return 1;
+}
+
+// Sorts the instruction words of the variant into the classes.
+void mkclasses(void)
+{
+  uint i, instr, n = 0;
+  for (i = 0; i < NCLASSES; i++)
+  {
+    classes[i].first = n;
+    for (instr = 0; instr < 0x10000; instr++)
+      if (fits(&classes[i], instr))
+        words[n++] = instr;
+    classes[i].cnt = n - classes[i].first;
+    if (!classes[i].cnt)
+    {
+      fprintf(stderr, "No instructions for %s()\n", classes[i].macro);
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+// Formats instr as a macro call of class c.
+void fmtinstr(const Class* c, uint instr, char* buf)
+{
+  IsaOpnd o[4];
+  uint n = isarefopnds(instr, o), i;
+  buf += sprintf(buf, "%s(", c->macro);
+  for (i = 0; i < n; i++)
+  {
+    if (o[i].reg)
+      buf += sprintf(buf, "%s%s", i ? ", " : "", isa_regs[o[i].v]);
+    else
+      buf += sprintf(buf, "%s%d", i ? ", " : "", (o[i].v & 0x8000) ? (int)o[i].v - 0x10000 : (int)o[i].v);
+  }
+  strcpy(buf, ")");
+}
+
+// Tells whether the bytes at la...la+n-1 of the data space have been
+// written, i.e. whether the test knows what a load from there gets.
+int known(uint la, uint n)
+{
+  while (n--)
+    if (!written[la++ & 0xFFFF])
+      return 0;
+  return 1;
+}
+
+// Picks a random instruction that the reference model can execute from
+// *st within the limits of the test, executes it, updating *st and mem[].
+uint rndinstr(ulong* x, IsaState* st, char* buf)
+{
+  for (;;)
+  {
+    const Class* c = &classes[rndn(x, NCLASSES)];
+    uint instr = words[c->first + rndn(x, c->cnt)];
+    IsaState s = *st;
+    IsaWrite w[2];
+    IsaOpnd o[4];
+    uint nw, undef, i;
+
+    isarefopnds(instr, o);
+    switch (c->op)
+    {
+    case REF_LW:
+    case REF_LB:
+      if (!known((s.r[6] + o[2].v) & 0xFFFF, (c->op == REF_LW) ? 2 : 1))
+        continue;
+      break;
+    case REF_POP:
+      if (!known(s.r[6], 2))
+        continue;
+      break;
+    }
+
+    s.r[7] = CODE_LA;
+    mem[isarefphys(&s, 1, CODE_LA)] = instr;
+    mem[isarefphys(&s, 1, CODE_LA) + 1] = instr >> 8;
+    if (isarefexec(&s, mem, w, &nw, &undef) != ISAREF_OK || undef ||
+        s.r[6] < STACK_MIN || s.r[6] > STACK_MAX)
+      continue;
+
+    for (i = 0; i < nw; i++)
+    {
+      uint la = (uint)(w[i].pa - isarefphys(st, 0, 0)); // data space block 0
+      if (w[i].w16)
+      {
+        mem[w[i].pa & ~1UL] = w[i].val;
+        mem[w[i].pa | 1] = w[i].val >> 8;
+        written[la & ~1U] = written[la | 1] = 1;
+      }
+      else
+      {
+        mem[w[i].pa] = w[i].val;
+        written[la] = 1;
+      }
+    }
+    *st = s;
+    fmtinstr(c, instr, buf);
+    return instr;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int mini = 0;
+  ulong seed = 1, x;
+  uint nblocks = 100, len = 16, i, j, k;
+  const char *name, *base;
+  char sansext[256], buf[64];
+  IsaState st;
+  FILE* f;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-mini"))
+      mini = 1;
+    else if (!strcmp(argv[i], "-n") && i + 1 < (uint)argc)
+      nblocks = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-len") && i + 1 < (uint)argc)
+      len = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-seed") && i + 1 < (uint)argc)
+      seed = strtoul(argv[++i], NULL, 0);
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  mkrandt [options] <output_c_file>\n"
+            "Options:\n"
+            "  -mini       generate for the MINI variant\n"
+            "  -n <n>      number of blocks (default: 100)\n"
+            "  -len <n>    random instructions per block (default: 16)\n"
+            "  -seed <n>   random seed (default: 1)\n");
+    exit(EXIT_FAILURE);
+  }
+
+  name = argv[i];
+  base = strrchr(name, '/') ? strrchr(name, '/') + 1 : name;
+  if (strlen(base) < 3 || strlen(base) >= sizeof sansext || strcmp(base + strlen(base) - 2, ".c"))
+  {
+    fprintf(stderr, "The output file name must end with .c\n");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(sansext, base);
+  sansext[strlen(base) - 2] = '\0';
+
+  if (3 + (ulong)nblocks * (BLOCK_WORDS + len) + 1 > MAX_WORDS)
+  {
+    fprintf(stderr, "The test doesn't fit into %u words of ROM\n", MAX_WORDS);
+    exit(EXIT_FAILURE);
+  }
+
+  isainit(mini);
+  isarefinit();
+  mkclasses();
+
+  if ((f = fopen(name, "w")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  fprintf(f,
+          "/*\n"
+          "  Random self-checking test for the %s variant of SediCiPU2,\n"
+          "  generated by mkrandt.c (-seed %lu -n %u -len %u).\n"
+          "\n"
+          "  How to compile:\n"
+          "    gcc -std=c99 -O2 -Wall%s %s.c -o %s.exe\n"
+          "*/\n"
+          "\n"
+          "#ifndef JUST_OPS\n"
+          "\n"
+          "#if %sMINI\n"
+          "#error \"%s.c is for the %s variant\"\n"
+          "#endif\n"
+          "\n"
+          "#define THIS_FILE \"%s.c\"\n"
+          "#define THIS_FILE_SANS_EXT \"%s\"\n"
+          "#include \"mktesti.c\"\n"
+          "\n"
+          "#else // #else of #ifndef JUST_OPS\n"
+          "\n"
+          "  // Select a 16KB block of RAM for the data space (0-16KB) and the stack.\n"
+          "  li(r0, 1),\n"
+          "  li(r1, 4),\n"
+          "  msr(r1, r0),\n",
+          mini ? "MINI" : "full", seed, nblocks, len,
+          mini ? " -DMINI=1" : "", sansext, sansext,
+          mini ? "!" : "", sansext, mini ? "MINI" : "full",
+          sansext, sansext);
+
+  memset(&st, 0, sizeof st);
+  st.sel[4] = 1;
+  x = seed;
+  for (k = 0; k < nblocks; k++)
+  {
+    fprintf(f, "\n  // Test block %u\n", k);
+    fprintf(f, "  li16(r0, 0x%04X), addi(sp, r0, 0),\n", STACK_TOP);
+    for (j = 0; j < 6; j++)
+      st.r[j] = rndvalue(&x);
+    st.r[6] = STACK_TOP - 2;
+    st.flags = rndn(&x, 16);
+    fprintf(f, "  li16(r0, 0x%04X), li16(r1, 0x%04X), li16(r2, 0x%04X),\n"
+               "  li16(r3, 0x%04X), li16(r4, 0x%04X), li16(r5, 0x%04X),\n",
+            st.r[0], st.r[1], st.r[2], st.r[3], st.r[4], st.r[5]);
+    // The flags are set last, through r2, which is restored from the stack.
+    fprintf(f, "  push(r2), li16(r2, 0x%04X), mf2(), pop(r2),\n", st.flags);
+    mem[isarefphys(&st, 0, st.r[6])] = st.r[2];
+    mem[isarefphys(&st, 0, st.r[6]) + 1] = st.r[2] >> 8;
+    written[st.r[6]] = written[st.r[6] + 1] = 1;
+    st.r[6] += 2;
+
+    for (i = 0; i < len; i++)
+    {
+      rndinstr(&x, &st, buf);
+      fprintf(f, "  %s,\n", buf);
+    }
+
+    fprintf(f, "  expect_%sc(), expect_%sz(), expect_%ss(), expect_%so(),\n",
+            (st.flags & 1) ? "" : "n", (st.flags & 2) ? "" : "n",
+            (st.flags & 4) ? "" : "n", (st.flags & 8) ? "" : "n");
+    for (j = 0; j < 6; j++)
+      fprintf(f, "  expect_r16(r%u, 0x%04X),\n", j, st.r[j]);
+    fprintf(f, "  mov(r0, sp), expect_r16(r0, 0x%04X),\n", st.r[6]);
+  }
+
+  fprintf(f,
+          "\n"
+          "  // Success.\n"
+          "  j(-1)\n"
+          "\n"
+          "#endif // #endif of #ifndef JUST_OPS\n");
+
+  if (fclose(f))
+  {
+    fprintf(stderr, "Can't write file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
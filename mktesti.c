@@ -70,226 +70,212 @@ enum
 #define RQ(V) (sizeof(char[(V)?1:-1])-1) // yields 0, requires non-zero V else fails to compile
 
 #define U(x) ((uint)(x))
-#define MU1(x) (U(x)&1U)
-#define MU2(x) (U(x)&3U)
-#define MU3(x) (U(x)&7U)
 #define MU4(x) (U(x)&0xFU)
 #define MU7(x) (U(x)&0x7FU)
-#define MU8(x) (U(x)&0xFFU)
-#define MU9(x) (U(x)&0x1FFU)
-#define MUB(x) (U(x)&0x7FFU)
 #define SXT7(imm)                (MU7(imm) - ((MU7(imm)&0x40)<<1))
 
+// The instruction encoders, generated from isa.h by mkisaenc.c.
+#include "isaenc.h"
+
 #if !MINI
 
-#define OP067(n0_6,rrr,RRR,imm7) ((MU3(n0_6)<<13) | (MU3(rrr)<<10) | (MU3(RRR)<<7) | MU7(imm7))
-#define OP069(n0_6,rrr,R,imm9)   ((MU3(n0_6)<<13) | (MU3(rrr)<<10) | (MU1(R)<<9) | MU9(imm9))
-#define OP06B(n0_6,rrr,imm11)    ((MU3(n0_6)<<13) | (MU3(rrr)<<10) | MUB(imm11))
-#define OP7(rrr,m,PPP,Q,qqq)     ((7U<<13) | (MU3(rrr)<<10) | (MU3(m)<<7) | (MU3(PPP)<<4) | (MU1(Q)<<3) | MU3(qqq))
-#define OP74(rrr,m,PPP,imm4)     ((7U<<13) | (MU3(rrr)<<10) | (MU3(m)<<7) | (MU3(PPP)<<4) | MU4(imm4))
-#define OP77(rrr,m,imm7)         ((7U<<13) | (MU3(rrr)<<10) | (MU3(m)<<7) | MU7(imm7))
 #define ADDMn(r,R)               ((r) * 6U + (R) - ((R) > (r)))
 #define SUBMn(r,R)               ((R) - ((R) > (r)))
 #define MRSn(r,s)                ((r) * 5U + (s) - ((s) > (r)))
 
-#define lb(rrr,RRR,simm7)      LINE(OP067(0,rrr,RRR,simm7) + RQ((rrr)<sp))
-#define lw(rrr,RRR,simm7)      LINE(OP067(1,rrr,RRR,simm7))
-#define andi(RRR,imm7)         LINE(OP067(0,sp,RRR,imm7) + RQ((RRR)<sp))
-#define ori(RRR,imm7)          LINE(OP067(0,pc,RRR,imm7) + RQ((RRR)<sp))
-#define addm_0(n,simm7)        (((n)==0)?OP067(0,sp,sp,simm7):0)
-#define addm_1(n,simm7)        (((n)==1)?OP067(0,sp,pc,simm7):0)
-#define addm_2(n,simm7)        (((n)==2)?OP067(0,pc,sp,simm7):0)
-#define addm_3(n,simm7)        (((n)==3)?OP067(0,pc,pc,simm7):0)
-#define incm(rrr)              LINE(OP067(1,rrr,sp,1) + RQ((rrr)<sp))
-#define decm(rrr)              LINE(OP067(1,rrr,sp,-1) + RQ((rrr)<sp))
-#define adcz(rrr)              LINE(OP067(1,rrr,pc,1) + RQ((rrr)<sp))
-#define sb(rrr,RRR,simm7)      LINE(OP067(2,rrr,RRR,simm7) + RQ((rrr)<sp) + RQ((rrr)!=(RRR)))
-#define sw(rrr,RRR,simm7)      LINE(OP067(3,rrr,RRR,simm7) + RQ((rrr)<pc) + RQ((rrr)!=(RRR)))
-#define xori(RRR,imm7)         LINE(OP067(2,sp,RRR,imm7) + RQ((RRR)<sp))
-#define cmpi(RRR,simm7)        LINE(OP067(2,pc,RRR,simm7) + RQ((RRR)<sp))
-#define addm_4(n,simm7)        (((n)==4)?OP067(2,sp,sp,simm7):0)
-#define addm_5(n,simm7)        (((n)==5)?OP067(2,sp,pc,simm7):0)
+#define lb(rrr,RRR,simm7)      LINE(ENC_LB(rrr,RRR,simm7) + RQ((rrr)<sp))
+#define lw(rrr,RRR,simm7)      LINE(ENC_LW(rrr,RRR,simm7))
+#define andi(RRR,imm7)         LINE(ENC_ANDI(RRR,imm7) + RQ((RRR)<sp))
+#define ori(RRR,imm7)          LINE(ENC_ORI(RRR,imm7) + RQ((RRR)<sp))
+#define addm_0(n,simm7)        (((n)==0)?ENC_ADDM0(simm7):0)
+#define addm_1(n,simm7)        (((n)==1)?ENC_ADDM1(simm7):0)
+#define addm_2(n,simm7)        (((n)==2)?ENC_ADDM2(simm7):0)
+#define addm_3(n,simm7)        (((n)==3)?ENC_ADDM3(simm7):0)
+#define incm(rrr)              LINE(ENC_INCM(rrr) + RQ((rrr)<sp))
+#define decm(rrr)              LINE(ENC_DECM(rrr) + RQ((rrr)<sp))
+#define adcz(rrr)              LINE(ENC_ADCZ(rrr) + RQ((rrr)<sp))
+#define sb(rrr,RRR,simm7)      LINE(ENC_SB(rrr,RRR,simm7) + RQ((rrr)<sp) + RQ((rrr)!=(RRR)))
+#define sw(rrr,RRR,simm7)      LINE(ENC_SW(rrr,RRR,simm7) + RQ((rrr)<pc) + RQ((rrr)!=(RRR)))
+#define xori(RRR,imm7)         LINE(ENC_XORI(RRR,imm7) + RQ((RRR)<sp))
+#define cmpi(RRR,simm7)        LINE(ENC_CMPI(RRR,simm7) + RQ((RRR)<sp))
+#define addm_4(n,simm7)        (((n)==4)?ENC_ADDM4(simm7):0)
+#define addm_5(n,simm7)        (((n)==5)?ENC_ADDM5(simm7):0)
 #define push_0(n)              (((n)==0)?addm_5(5,1):0)
-#define addm_6(n,simm7)        (((n)==6)?OP067(2,pc,sp,simm7):0)
-#define addm_7(n,simm7)        (((n)==7)?OP067(2,pc,pc,simm7):0)
-#define subm_0x(r,R,simm7)     (((r)==0)?OP067(2,SUBMn(r,R),SUBMn(r,R),simm7):0)
+#define addm_6(n,simm7)        (((n)==6)?ENC_ADDM6(simm7):0)
+#define addm_7(n,simm7)        (((n)==7)?ENC_ADDM7(simm7):0)
+#define subm_0x(r,R,simm7)     (((r)==0)?ENC_SUBM0(SUBMn(r,R),SUBMn(r,R),simm7):0)
 #define push_2(n)              (((n)==2)?subm_0x(0,6,1):0)
-#define subm_1x(r,R,simm7)     (((r)==1)?OP067(3,SUBMn(r,R),SUBMn(r,R),simm7):0)
+#define subm_1x(r,R,simm7)     (((r)==1)?ENC_SUBM1(SUBMn(r,R),SUBMn(r,R),simm7):0)
 #define push_3(n)              (((n)==3)?subm_1x(1,6,1):0)
-#define subm_2x(r,R,simm7)     (((r)==2)?OP067(3,pc,SUBMn(r,R),simm7):0)
+#define subm_2x(r,R,simm7)     (((r)==2)?ENC_SUBM2(SUBMn(r,R),simm7):0)
 #define push_4(n)              (((n)==4)?subm_2x(2,6,1):0)
-#define addm_12(n,simm7)       (((n)==12)?OP067(3,pc,sp,simm7):0)
-#define addm_13(n,simm7)       (((n)==13)?OP067(3,pc,pc,simm7):0)
-#define dincm(rrr)             LINE(OP067(3,rrr,sp,1) + RQ((rrr)<sp))
-#define ddecm(rrr)             LINE(OP067(3,rrr,pc,1) + RQ((rrr)<sp))
-#define addi(rrr,RRR,simm7)    LINE(OP067(4,rrr,RRR,simm7) + RQ((rrr)<sp || (RRR)<pc) + RQ((rrr)<pc || (RRR)<sp))
-#define swi(simm6)             LINE(OP067(4,sp,sp,(simm6)*2+1))
-#define pushi(simm7)           LINE(OP067(4,sp,pc,simm7))
-#define addm_8(n,simm7)        (((n)==8)?OP067(4,pc,sp,simm7):0)
-#define addm_9(n,simm7)        (((n)==9)?OP067(4,pc,pc,simm7):0)
-#define li(rrr,simm9)          LINE(OP069(5,rrr,0,simm9) + RQ((rrr)<sp))
-#define addu(rrr,imm9)         LINE(OP069(5,rrr,1,imm9) + RQ((rrr)<pc))
-#define j(simm8)               LINE(OP069(5,sp,0,MU8(simm8)*2+1))
-#define subm_3x(r,R,simm7)     (((r)==3)?OP067(5,pc,SUBMn(r,R),simm7):0)
+#define addm_12(n,simm7)       (((n)==12)?ENC_ADDM12(simm7):0)
+#define addm_13(n,simm7)       (((n)==13)?ENC_ADDM13(simm7):0)
+#define dincm(rrr)             LINE(ENC_DINCM(rrr) + RQ((rrr)<sp))
+#define ddecm(rrr)             LINE(ENC_DDECM(rrr) + RQ((rrr)<sp))
+#define addi(rrr,RRR,simm7)    LINE(ENC_ADDI(rrr,RRR,simm7) + RQ((rrr)<sp || (RRR)<pc) + RQ((rrr)<pc || (RRR)<sp))
+#define swi(simm6)             LINE(ENC_SWI(simm6))
+#define pushi(simm7)           LINE(ENC_PUSHI(simm7))
+#define addm_8(n,simm7)        (((n)==8)?ENC_ADDM8(simm7):0)
+#define addm_9(n,simm7)        (((n)==9)?ENC_ADDM9(simm7):0)
+#define li(rrr,simm9)          LINE(ENC_LI(rrr,simm9) + RQ((rrr)<sp))
+#define addu(rrr,imm9)         LINE(ENC_ADDU(rrr,imm9) + RQ((rrr)<pc))
+#define j(simm8)               LINE(ENC_J(simm8))
+#define subm_3x(r,R,simm7)     (((r)==3)?ENC_SUBM3(SUBMn(r,R),simm7):0)
 #define push_5(n)              (((n)==5)?subm_3x(3,6,1):0)
-#define addm_10(n,simm7)       (((n)==10)?OP067(5,pc,sp,simm7):0)
-#define addm_11(n,simm7)       (((n)==11)?OP067(5,pc,pc,simm7):0)
+#define addm_10(n,simm7)       (((n)==10)?ENC_ADDM10(simm7):0)
+#define addm_11(n,simm7)       (((n)==11)?ENC_ADDM11(simm7):0)
 #define push_1(n)              (((n)==1)?addm_11(11,1):0)
 #define push(r)                LINE(push_0(r)+push_1(r)+push_2(r)+push_3(r)+push_4(r)+push_5(r) + RQ((r)<sp))
-#define incs(rrr,imm7)         LINE(OP067(6,rrr,0,imm7) + RQ((rrr)<sp))
-#define decs(rrr,imm7)         LINE(OP067(6,rrr,1,imm7) + RQ((rrr)<sp))
-#define dincs(rrr,imm7)        LINE(OP067(6,rrr,2,imm7) + RQ((rrr)<sp))
-#define ddecs(rrr,imm7)        LINE(OP067(6,rrr,3,imm7) + RQ((rrr)<sp))
-#define ls5r(rrr)              LINE(OP067(6,rrr,0,1) + RQ((rrr)<=4))
-#define last(imm7)             LINE(OP067(6,5,0,(imm7)|1))
-#define ss5r(rrr)              LINE(OP067(6,rrr,1,1) + RQ((rrr)<=4))
-#define lurpc(rrr,imm9)        LINE(OP069(6,rrr,1,imm9) + RQ((rrr)<sp))
-#define jal(simm11)            LINE(OP06B(6,sp,simm11))
-#define jc(simm7)              LINE(OP067(7,0,0,simm7))
-#define jz(simm7)              LINE(OP067(7,1,0,simm7))
-#define js(simm7)              LINE(OP067(7,2,0,simm7))
-#define jleu(simm7)            LINE(OP067(7,3,0,simm7))
-#define jl(simm7)              LINE(OP067(7,4,0,simm7))
-#define jle(simm7)             LINE(OP067(7,5,0,simm7))
-#define jo(simm7)              LINE(OP067(7,6,0,simm7))
-#define jno(simm7)             LINE(OP067(7,7,0,simm7))
-#define jnc(simm7)             LINE(OP067(7,0,1,simm7))
-#define jnz(simm7)             LINE(OP067(7,1,1,simm7))
-#define jns(simm7)             LINE(OP067(7,2,1,simm7))
-#define jgu(simm7)             LINE(OP067(7,3,1,simm7))
-#define jge(simm7)             LINE(OP067(7,4,1,simm7))
-#define jg(simm7)              LINE(OP067(7,5,1,simm7))
-#define mrs(r,s)               LINE(OP7(6+MRSn(r,s)/16,1,MRSn(r,s)/2%8,MRSn(r,s)%2,7) + RQ((r)<sp) + RQ((s)<sp) + RQ((r)!=(s)))
-#define stc()                  LINE(OP7(7,1,7,0,7))
-#define addm_14_29(n,simm7)    ((((n)>=14)&&(n<=29))?OP067(7,((n)-14)/2,2+((n)-14)%2,simm7):0)
+#define incs(rrr,imm7)         LINE(ENC_INCS(rrr,imm7) + RQ((rrr)<sp))
+#define decs(rrr,imm7)         LINE(ENC_DECS(rrr,imm7) + RQ((rrr)<sp))
+#define dincs(rrr,imm7)        LINE(ENC_DINCS(rrr,imm7) + RQ((rrr)<sp))
+#define ddecs(rrr,imm7)        LINE(ENC_DDECS(rrr,imm7) + RQ((rrr)<sp))
+#define ls5r(rrr)              LINE(ENC_LS5R(rrr) + RQ((rrr)<=4))
+#define last(imm7)             LINE(ENC_LAST(U(imm7)>>1))
+#define ss5r(rrr)              LINE(ENC_SS5R(rrr) + RQ((rrr)<=4))
+#define lurpc(rrr,imm9)        LINE(ENC_LURPC(rrr,imm9) + RQ((rrr)<sp))
+#define jal(simm11)            LINE(ENC_JAL(simm11))
+#define jc(simm7)              LINE(ENC_JCC(0,0,simm7))
+#define jz(simm7)              LINE(ENC_JCC(1,0,simm7))
+#define js(simm7)              LINE(ENC_JCC(2,0,simm7))
+#define jleu(simm7)            LINE(ENC_JCC(3,0,simm7))
+#define jl(simm7)              LINE(ENC_JCC(4,0,simm7))
+#define jle(simm7)             LINE(ENC_JCC(5,0,simm7))
+#define jo(simm7)              LINE(ENC_JCC(6,0,simm7))
+#define jno(simm7)             LINE(ENC_JCC(7,0,simm7))
+#define jnc(simm7)             LINE(ENC_JCC(0,1,simm7))
+#define jnz(simm7)             LINE(ENC_JCC(1,1,simm7))
+#define jns(simm7)             LINE(ENC_JCC(2,1,simm7))
+#define jgu(simm7)             LINE(ENC_JCC(3,1,simm7))
+#define jge(simm7)             LINE(ENC_JCC(4,1,simm7))
+#define jg(simm7)              LINE(ENC_JCC(5,1,simm7))
+#define mrs(r,s)               LINE(ENC_MRS(MRSn(r,s)) + RQ((r)<sp) + RQ((s)<sp) + RQ((r)!=(s)))
+#define stc()                  LINE(ENC_STC())
+#define addm_14_29(n,simm7)    ((((n)>=14)&&(n<=29))?ENC_ADDM14((n)-14,simm7):0)
 #define addm_0_3(n,simm7)      (addm_0(n,simm7)+addm_1(n,simm7)+addm_2(n,simm7)+addm_3(n,simm7))
 #define addm_4_7(n,simm7)      (addm_4(n,simm7)+addm_5(n,simm7)+addm_6(n,simm7)+addm_7(n,simm7))
 #define addm_8_11(n,simm7)     (addm_8(n,simm7)+addm_9(n,simm7)+addm_10(n,simm7)+addm_11(n,simm7))
 #define addm_12_13(n,simm7)    (addm_12(n,simm7)+addm_13(n,simm7))
 #define addm_0_29(n,simm7)     (addm_0_3(n,simm7)+addm_4_7(n,simm7)+addm_8_11(n,simm7)+addm_12_13(n,simm7)+addm_14_29(n,simm7))
 #define addm(r,R,simm7)        LINE(addm_0_29(ADDMn(r,R),simm7) + RQ((R)<pc) + RQ((r)<r5) + RQ((R)!=(r)))
-#define subm_4x(r,R,simm7)     (((r)==4)?OP067(7,SUBMn(r,R),4,simm7):0)
+#define subm_4x(r,R,simm7)     (((r)==4)?ENC_SUBM4(SUBMn(r,R),simm7):0)
 #define subm(r,R,simm7)        LINE(subm_0x(r,R,simm7)+subm_1x(r,R,simm7)+subm_2x(r,R,simm7)+subm_3x(r,R,simm7)+subm_4x(r,R,simm7) + RQ((R)<pc) + RQ((r)<r5) + RQ((R)!=(r)))
-#define zxt(PPP)               LINE(OP7(sp,4,PPP,0,7) + RQ((PPP)<sp))
-#define sxt(PPP)               LINE(OP7(sp,4,PPP,1,7) + RQ((PPP)<sp))
-#define cpl(PPP)               LINE(OP7(pc,4,PPP,0,7) + RQ((PPP)<sp))
-#define neg(PPP)               LINE(OP7(pc,4,PPP,1,7) + RQ((PPP)<sp))
-#define pop(rPQ)               LINE(OP7(sp+(((rPQ)>>2)&1),4,sp+(((rPQ)>>1)&1),(rPQ)&1,7) + RQ((rPQ)<sp))
-#define mf2()                  LINE(OP7(pc,4,pc,0,7))
-#define m2f()                  LINE(OP7(pc,4,pc,1,7))
-#define sac(rrr,PPP,imm4)      LINE(OP74(rrr,5,PPP,imm4) + RQ((rrr)<sp) + RQ((PPP)<sp) + RQ(MU4(imm4)))
-#define sri(PPP,imm4)          LINE(OP74(sp,5,PPP,imm4) + RQ((PPP)<sp) + RQ(MU4(imm4)))
-#define sli(PPP,imm4)          LINE(OP74(pc,5,PPP,imm4) + RQ((PPP)<sp) + RQ(MU4(imm4)>=2))
-#define asri(rrr,imm4)         LINE(OP74(rrr,5,sp,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
-#define rli(rrr,imm4)          LINE(OP74(rrr,5,pc,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
-#define di()                   LINE(OP7(sp,5,sp,0,7))
-#define ei()                   LINE(OP7(sp,5,sp,1,7))
-#define reti()                 LINE(OP7(sp,5,pc,0,7))
-#define add22adc33()           LINE(OP7(pc,5,sp,0,7))
-#define cadd24()               LINE(OP7(pc,5,sp,1,7))
-#define cadd24adc3z()          LINE(OP7(pc,5,pc,0,7))
-#define csub34()               LINE(OP7(pc,5,pc,1,7))
-#define lb2(rrr,PPP,qqq)       LINE(OP7(rrr,6,PPP,0,qqq) + RQ((PPP)<sp) + RQ((rrr)<sp))
-#define lw2(rrr,PPP,qqq)       LINE(OP7(rrr,7,PPP,0,qqq) + RQ((PPP)<sp))
-#define sb2(rrr,PPP,qqq)       LINE(OP7(rrr,6,PPP,1,qqq) + RQ((PPP)<sp) + RQ((rrr)<sp) + RQ((rrr)!=(PPP)))
-#define sw2(rrr,PPP,qqq)       LINE(OP7(rrr,7,PPP,1,qqq) + RQ((PPP)<sp) + RQ((rrr)<pc) + RQ((rrr)!=(PPP)))
-#define sr(rrr,qqq)            LINE(OP7(rrr,6,sp,0,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define sl(rrr,qqq)            LINE(OP7(rrr,6,sp,1,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define rr(rrr,qqq)            LINE(OP7(rrr,7,sp,0,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define rl(rrr,qqq)            LINE(OP7(rrr,7,sp,1,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define asr(rrr,qqq)           LINE(OP7(rrr,6,pc,0,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define xor(rrr,qqq)           LINE(OP7(rrr,6,pc,1,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define and(rrr,qqq)           LINE(OP7(rrr,7,pc,0,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define or(rrr,qqq)            LINE(OP7(rrr,7,pc,1,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
-#define adc(PPP,qqq)           LINE(OP7(sp,6,PPP,0,qqq) + RQ((PPP)<sp) + RQ((qqq)<sp))
-#define sbb(PPP,qqq)           LINE(OP7(sp,6,PPP,1,qqq) + RQ((PPP)<sp) + RQ((qqq)<sp))
-#define add(PPP,qqq)           LINE(OP7(pc,6,PPP,0,qqq) + RQ((PPP)<sp)/* + RQ((qqq)<sp)*/)
-#define sub(PPP,qqq)           LINE(OP7(pc,6,PPP,1,qqq) + RQ((PPP)<sp)/* + RQ((qqq)<sp)*/)
-#define cmp(PPP,qqq)           LINE(OP7(pc,7,PPP,1,qqq) + RQ((PPP)<sp)/* + RQ((qqq)<sp)*/)
-#define mov(rrr,qqq)           LINE(OP7(rrr,6,rrr,1,qqq) + RQ((rrr)<sp) + RQ((qqq)<pc))
-#define msr(rrr,qqq)           LINE(OP7(rrr,7,rrr,1,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp) + RQ((rrr)!=(qqq)))
+#define zxt(PPP)               LINE(ENC_ZXT(PPP) + RQ((PPP)<sp))
+#define sxt(PPP)               LINE(ENC_SXT(PPP) + RQ((PPP)<sp))
+#define cpl(PPP)               LINE(ENC_CPL(PPP) + RQ((PPP)<sp))
+#define neg(PPP)               LINE(ENC_NEG(PPP) + RQ((PPP)<sp))
+#define pop(rPQ)               LINE(ENC_POP(rPQ) + RQ((rPQ)<sp))
+#define mf2()                  LINE(ENC_MF2())
+#define m2f()                  LINE(ENC_M2F())
+#define sac(rrr,PPP,imm4)      LINE(ENC_SAC(rrr,PPP,imm4) + RQ((rrr)<sp) + RQ((PPP)<sp) + RQ(MU4(imm4)))
+#define sri(PPP,imm4)          LINE(ENC_SRI(PPP,imm4) + RQ((PPP)<sp) + RQ(MU4(imm4)))
+#define sli(PPP,imm4)          LINE(ENC_SLI(PPP,imm4) + RQ((PPP)<sp) + RQ(MU4(imm4)>=2))
+#define asri(rrr,imm4)         LINE(ENC_ASRI(rrr,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
+#define rli(rrr,imm4)          LINE(ENC_RLI(rrr,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
+#define di()                   LINE(ENC_DI())
+#define ei()                   LINE(ENC_EI())
+#define reti()                 LINE(ENC_RETI())
+#define add22adc33()           LINE(ENC_ADD22ADC33())
+#define cadd24()               LINE(ENC_CADD24())
+#define cadd24adc3z()          LINE(ENC_CADD24ADC3Z())
+#define csub34()               LINE(ENC_CSUB34())
+#define lb2(rrr,PPP,qqq)       LINE(ENC_LB2(rrr,PPP,qqq) + RQ((PPP)<sp) + RQ((rrr)<sp))
+#define lw2(rrr,PPP,qqq)       LINE(ENC_LW2(rrr,PPP,qqq) + RQ((PPP)<sp))
+#define sb2(rrr,PPP,qqq)       LINE(ENC_SB2(rrr,PPP,qqq) + RQ((PPP)<sp) + RQ((rrr)<sp) + RQ((rrr)!=(PPP)))
+#define sw2(rrr,PPP,qqq)       LINE(ENC_SW2(rrr,PPP,qqq) + RQ((PPP)<sp) + RQ((rrr)<pc) + RQ((rrr)!=(PPP)))
+#define sr(rrr,qqq)            LINE(ENC_SR(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define sl(rrr,qqq)            LINE(ENC_SL(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define rr(rrr,qqq)            LINE(ENC_RR(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define rl(rrr,qqq)            LINE(ENC_RL(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define asr(rrr,qqq)           LINE(ENC_ASR(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define xor(rrr,qqq)           LINE(ENC_XOR(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define and(rrr,qqq)           LINE(ENC_AND(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define or(rrr,qqq)            LINE(ENC_OR(rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp))
+#define adc(PPP,qqq)           LINE(ENC_ADC(PPP,qqq) + RQ((PPP)<sp) + RQ((qqq)<sp))
+#define sbb(PPP,qqq)           LINE(ENC_SBB(PPP,qqq) + RQ((PPP)<sp) + RQ((qqq)<sp))
+#define add(PPP,qqq)           LINE(ENC_ADD(PPP,qqq) + RQ((PPP)<sp)/* + RQ((qqq)<sp)*/)
+#define sub(PPP,qqq)           LINE(ENC_SUB(PPP,qqq) + RQ((PPP)<sp)/* + RQ((qqq)<sp)*/)
+#define cmp(PPP,qqq)           LINE(ENC_CMP(PPP,qqq) + RQ((PPP)<sp)/* + RQ((qqq)<sp)*/)
+#define mov(rrr,qqq)           LINE(ENC_MOV(rrr,rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<pc))
+#define msr(rrr,qqq)           LINE(ENC_MSR(rrr,rrr,qqq) + RQ((rrr)<sp) + RQ((qqq)<sp) + RQ((rrr)!=(qqq)))
 
 #define lwp(rrr,PPP)           lw2(rrr,PPP,pc)
 #define swp(rrr,PPP)           sw2(rrr,PPP,pc)
 
 #else /* MINI */
 
-#define OP067(n0_6,rrr,RRR,imm7) ((MU3(n0_6)<<13) | (MU3(rrr)<<10) | (MU3(RRR)<<7) | MU7(imm7))
-#define OP069(n0_6,rrr,imm9,L)   ((MU3(n0_6)<<13) | (MU3(rrr)<<10) | (MU9(imm9)<<1) | MU1(L))
-#define OP06B(n0_6,rrr,imm11)    ((MU3(n0_6)<<13) | (MU3(rrr)<<10) | MUB(imm11))
-#define OP7J(imm7,hh,cccc)       ((7U<<13) | (MU7(imm7)<<6) | (MU2(hh)<<4) | MU4(cccc))
-#define OP7(rrr,RRR,O,hh,oooo)   ((7U<<13) | (MU3(rrr)<<10) | (MU3(RRR)<<7) | (MU1(O)<<6) | (MU2(hh)<<4) | MU4(oooo))
-
-#define lb(rrr,RRR,simm7)      LINE(OP067(0,rrr,RRR,simm7) + RQ((rrr)<sp))
-#define lw(rrr,RRR,simm7)      LINE(OP067(1,rrr,RRR,simm7))
-#define andi(RRR,imm7)         LINE(OP067(0,sp,RRR,imm7) + RQ((RRR)<sp))
-#define ori(RRR,imm7)          LINE(OP067(0,pc,RRR,imm7) + RQ((RRR)<sp))
-#define sb(rrr,RRR,simm7)      LINE(OP067(2,rrr,RRR,simm7) + RQ((rrr)<sp) + RQ((rrr)!=(RRR)))
-#define sw(rrr,RRR,simm7)      LINE(OP067(3,rrr,RRR,simm7) + RQ((rrr)<pc) + RQ((rrr)!=(RRR)))
-#define xori(RRR,imm7)         LINE(OP067(2,sp,RRR,imm7) + RQ((RRR)<sp))
-#define cmpi_(RRR,simm7)       OP067(2,pc,RRR,simm7)
+#define cmpi_(RRR,simm7)       ENC_CMPI(RRR,simm7)
+
+#define lb(rrr,RRR,simm7)      LINE(ENC_LB(rrr,RRR,simm7) + RQ((rrr)<sp))
+#define lw(rrr,RRR,simm7)      LINE(ENC_LW(rrr,RRR,simm7))
+#define andi(RRR,imm7)         LINE(ENC_ANDI(RRR,imm7) + RQ((RRR)<sp))
+#define ori(RRR,imm7)          LINE(ENC_ORI(RRR,imm7) + RQ((RRR)<sp))
+#define sb(rrr,RRR,simm7)      LINE(ENC_SB(rrr,RRR,simm7) + RQ((rrr)<sp) + RQ((rrr)!=(RRR)))
+#define sw(rrr,RRR,simm7)      LINE(ENC_SW(rrr,RRR,simm7) + RQ((rrr)<pc) + RQ((rrr)!=(RRR)))
+#define xori(RRR,imm7)         LINE(ENC_XORI(RRR,imm7) + RQ((RRR)<sp))
 #define cmpi(RRR,simm7)        LINE(cmpi_(RRR,simm7) + RQ((RRR)<sp))
-#define pushi(simm7)           LINE(OP067(3,pc,7,simm7))
-#define addi(rrr,RRR,simm7)    LINE(OP067(4,rrr,RRR,simm7) + RQ((rrr)<sp || (RRR)<pc) + RQ((rrr)<pc || (RRR)<sp))
-#define swi(simm6)             LINE(OP067(4,sp,7,(simm6)*2+1))
-#define li(rrr,simm9)          LINE(OP069(5,rrr,simm9,0) + RQ((rrr)<sp))
-#define last(imm7)             LINE(OP067(5,sp,7,(imm7)&~1U))
-#define decs(RRR,imm7)         LINE(OP067(5,pc,RRR,(imm7)&~1U) + RQ((RRR)<sp))
-#define addu(rrr,imm9)         LINE(OP069(5,rrr,imm9,1) + RQ((rrr)<pc))
-#define j(simm8)               LINE(OP069(5,pc,MU8(simm8)*2,1))
-#define jal(simm11)            LINE(OP06B(6,sp,simm11))
-#define lurpc(rrr,imm9)        LINE(OP069(6,rrr,imm9,0) + RQ((rrr)<sp))
-#define add22adc33()           LINE(OP069(6,0,-1,1))
-#define cadd24()               LINE(OP069(6,1,-1,1))
-#define cadd24adc3z()          LINE(OP069(6,2,-1,1))
-#define csub34()               LINE(OP069(6,3,-1,1))
-#define mf2()                  LINE(OP069(6,4,-1,1))
-#define m2f()                  LINE(OP069(6,5,-1,1))
-#define jc(simm7)              LINE(OP7J(simm7,0,0))
-#define jz(simm7)              LINE(OP7J(simm7,0,1))
-#define js(simm7)              LINE(OP7J(simm7,0,2))
-#define jleu(simm7)            LINE(OP7J(simm7,0,3))
-#define jl(simm7)              LINE(OP7J(simm7,0,4))
-#define jle(simm7)             LINE(OP7J(simm7,0,5))
-#define jo(simm7)              LINE(OP7J(simm7,0,6))
-#define jno(simm7)             LINE(OP7J(simm7,0,7))
-#define jnc(simm7)             LINE(OP7J(simm7,0,8))
-#define jnz(simm7)             LINE(OP7J(simm7,0,9))
-#define jns(simm7)             LINE(OP7J(simm7,0,10))
-#define jgu(simm7)             LINE(OP7J(simm7,0,11))
-#define jge(simm7)             LINE(OP7J(simm7,0,12))
-#define jg(simm7)              LINE(OP7J(simm7,0,13))
-#define zxt(rrr)               LINE(OP7(rrr,7,0,0,14) + RQ((rrr)<sp))
-#define sxt(rrr)               LINE(OP7(rrr,7,1,0,14) + RQ((rrr)<sp))
-#define cpl(rrr)               LINE(OP7(rrr,7,0,0,15) + RQ((rrr)<sp))
-#define neg(rrr)               LINE(OP7(rrr,7,1,0,15) + RQ((rrr)<sp))
-#define sr(rrr,RRR)            LINE(OP7(rrr,RRR,0,1,0) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define sl(rrr,RRR)            LINE(OP7(rrr,RRR,0,1,1) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define rr(rrr,RRR)            LINE(OP7(rrr,RRR,0,1,2) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define rl(rrr,RRR)            LINE(OP7(rrr,RRR,0,1,3) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define asr(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,4) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define xor(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,5) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define and(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,6) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define or(rrr,RRR)            LINE(OP7(rrr,RRR,0,1,7) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define adc(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,8) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define sbb(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,9) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define add(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,10) + RQ((rrr)<sp)/* + RQ((RRR)<sp)*/)
-#define sub(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,11) + RQ((rrr)<sp)/* + RQ((RRR)<sp)*/)
-#define cmp(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,12) + RQ((rrr)<sp)/* + RQ((RRR)<sp)*/)
-#define mov(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,13) + RQ((rrr)<sp) + RQ((RRR)<pc))
-#define msr(RRR,rrr)           LINE(OP7(rrr,RRR,0,1,14) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ((rrr)!=(RRR)))
-#define mrs(rrr,RRR)           LINE(OP7(rrr,RRR,0,1,15) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ((rrr)!=(RRR)))
-#define sac(rrr,RRR,imm4)      LINE(OP7(rrr,RRR,1,1,imm4) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ(MU4(imm4)))
-#define adcz(rrr)              LINE(OP7(rrr,7,1,1,0) + RQ((rrr)<sp))
-#define asri(rrr,imm4)         LINE(OP7(rrr,7,0,2,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
-#define push(rrr)              LINE(OP7(rrr,7,0,2,0) + RQ((rrr)<sp))
-#define rli(rrr,imm4)          LINE(OP7(rrr,7,1,2,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
-#define pop(rrr)               LINE(OP7(rrr,7,1,2,0) + RQ((rrr)<sp))
-#define sri(rrr,imm4)          LINE(OP7(rrr,7,0,3,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
-#define reti()                 LINE(OP7(7,7,0,3,0))
-#define sli(rrr,imm4)          LINE(OP7(rrr,7,1,3,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)>=2))
-#define lwp(rrr,RRR)           LINE(OP7(rrr,RRR,1,3,0) + RQ((rrr)<sp) + RQ((RRR)<sp))
-#define swp(rrr,RRR)           LINE(OP7(rrr,RRR,1,3,1) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ((rrr)!=(RRR)))
+#define pushi(simm7)           LINE(ENC_PUSHI(simm7))
+#define addi(rrr,RRR,simm7)    LINE(ENC_ADDI(rrr,RRR,simm7) + RQ((rrr)<sp || (RRR)<pc) + RQ((rrr)<pc || (RRR)<sp))
+#define swi(simm6)             LINE(ENC_SWI(simm6))
+#define li(rrr,simm9)          LINE(ENC_LI(rrr,simm9) + RQ((rrr)<sp))
+#define last(imm7)             LINE(ENC_LAST(U(imm7)>>1))
+#define decs(RRR,imm7)         LINE(ENC_DECS(RRR,U(imm7)>>1) + RQ((RRR)<sp))
+#define addu(rrr,imm9)         LINE(ENC_ADDU(rrr,imm9) + RQ((rrr)<pc))
+#define j(simm8)               LINE(ENC_J(simm8))
+#define jal(simm11)            LINE(ENC_JAL(simm11))
+#define lurpc(rrr,imm9)        LINE(ENC_LURPC(rrr,imm9) + RQ((rrr)<sp))
+#define add22adc33()           LINE(ENC_ADD22ADC33())
+#define cadd24()               LINE(ENC_CADD24())
+#define cadd24adc3z()          LINE(ENC_CADD24ADC3Z())
+#define csub34()               LINE(ENC_CSUB34())
+#define mf2()                  LINE(ENC_MF2())
+#define m2f()                  LINE(ENC_M2F())
+#define jc(simm7)              LINE(ENC_JCC(simm7,0))
+#define jz(simm7)              LINE(ENC_JCC(simm7,1))
+#define js(simm7)              LINE(ENC_JCC(simm7,2))
+#define jleu(simm7)            LINE(ENC_JCC(simm7,3))
+#define jl(simm7)              LINE(ENC_JCC(simm7,4))
+#define jle(simm7)             LINE(ENC_JCC(simm7,5))
+#define jo(simm7)              LINE(ENC_JCC(simm7,6))
+#define jno(simm7)             LINE(ENC_JCC(simm7,7))
+#define jnc(simm7)             LINE(ENC_JCC(simm7,8))
+#define jnz(simm7)             LINE(ENC_JCC(simm7,9))
+#define jns(simm7)             LINE(ENC_JCC(simm7,10))
+#define jgu(simm7)             LINE(ENC_JCC(simm7,11))
+#define jge(simm7)             LINE(ENC_JCC(simm7,12))
+#define jg(simm7)              LINE(ENC_JCC(simm7,13))
+#define zxt(rrr)               LINE(ENC_ZXT(rrr) + RQ((rrr)<sp))
+#define sxt(rrr)               LINE(ENC_SXT(rrr) + RQ((rrr)<sp))
+#define cpl(rrr)               LINE(ENC_CPL(rrr) + RQ((rrr)<sp))
+#define neg(rrr)               LINE(ENC_NEG(rrr) + RQ((rrr)<sp))
+#define sr(rrr,RRR)            LINE(ENC_ALU(rrr,RRR,0) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define sl(rrr,RRR)            LINE(ENC_ALU(rrr,RRR,1) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define rr(rrr,RRR)            LINE(ENC_ALU(rrr,RRR,2) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define rl(rrr,RRR)            LINE(ENC_ALU(rrr,RRR,3) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define asr(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,4) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define xor(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,5) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define and(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,6) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define or(rrr,RRR)            LINE(ENC_ALU(rrr,RRR,7) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define adc(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,8) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define sbb(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,9) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define add(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,10) + RQ((rrr)<sp)/* + RQ((RRR)<sp)*/)
+#define sub(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,11) + RQ((rrr)<sp)/* + RQ((RRR)<sp)*/)
+#define cmp(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,12) + RQ((rrr)<sp)/* + RQ((RRR)<sp)*/)
+#define mov(rrr,RRR)           LINE(ENC_ALU(rrr,RRR,13) + RQ((rrr)<sp) + RQ((RRR)<pc))
+#define msr(RRR,rrr)           LINE(ENC_MSR(rrr,RRR) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ((rrr)!=(RRR)))
+#define mrs(rrr,RRR)           LINE(ENC_MRS(rrr,RRR) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ((rrr)!=(RRR)))
+#define sac(rrr,RRR,imm4)      LINE(ENC_SAC(rrr,RRR,imm4) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ(MU4(imm4)))
+#define adcz(rrr)              LINE(ENC_ADCZ(rrr) + RQ((rrr)<sp))
+#define asri(rrr,imm4)         LINE(ENC_ASRI(rrr,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
+#define push(rrr)              LINE(ENC_PUSH(rrr) + RQ((rrr)<sp))
+#define rli(rrr,imm4)          LINE(ENC_RLI(rrr,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
+#define pop(rrr)               LINE(ENC_POP(rrr) + RQ((rrr)<sp))
+#define sri(rrr,imm4)          LINE(ENC_SRI(rrr,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)))
+#define reti()                 LINE(ENC_RETI())
+#define sli(rrr,imm4)          LINE(ENC_SLI(rrr,imm4) + RQ((rrr)<sp) + RQ(MU4(imm4)>=2))
+#define lwp(rrr,RRR)           LINE(ENC_LWP(rrr,RRR) + RQ((rrr)<sp) + RQ((RRR)<sp))
+#define swp(rrr,RRR)           LINE(ENC_SWP(rrr,RRR) + RQ((rrr)<sp) + RQ((RRR)<sp) + RQ((rrr)!=(RRR)))
 
 #define di()                   swi(2)
 #define ei()                   swi(3)
@@ -335,9 +321,67 @@ enum
 
 #define expect_r16(rrr,imm16)  addi16(rrr,-U(imm16)), jnz(-1), li16(rrr,imm16)
 
+// The tests are grouped into modules, see Start below.
+#define START                  0x17A
+#define MODULE_LA              (START + 2) // module to run alone, 0 = all
+#define TABLE_LA               (START + 4) // addresses of End and of the modules
+#define MODULE_CNT             40          // table entries
+#define SETUP_MODULE           9           // the modules after it need it
+
+// rrr = code word at addr; destroys RRR
+#define lwa(rrr,RRR,addr)      addi(RRR,pc,0), neg(RRR), addi16(RRR,(addr)-8), lwp(rrr,RRR)
+// jump to the address in entry rrr of the module table; destroys rrr, RRR
+#define jt(rrr,RRR)            add(rrr,rrr), addi(RRR,pc,0), sub(rrr,RRR), addi16(rrr,TABLE_LA-8), \
+                               lwp(RRR,rrr), addi(pc,RRR,0)
+// continue with the next module unless this one runs alone;
+// the setup module continues with the one that runs alone; destroys r0, r1
+#define end_module()           lwa(r0,r1,MODULE_LA), or(r0,r0), jz(11), \
+                               li(r1,MODULE), cmp(r1,r0), jc(1), li(r0,0), jt(r0,r1)
+
+// The multiplication, division and binary to BCD conversion subroutines
+// of modules 27-30, ending with the return to r5. SPEEDUP_MULDIV picks the
+// ..s_sub() forms (add22adc33(), cadd24(), etc) there, muldivchk.c checks
+// both forms on all inputs.
+// r2 = r3 * r4; destroys r0, r3
+#define mul16_sub()            li(r2,0), li(r0,16), \
+                               add(r2,r2), add(r3,r3), jnc(1), add(r2,r4), addi(r0,r0,-1), jnz(-6), \
+                               addi(pc,r5,0)
+#define mul16s_sub()           li(r2,0), li(r0,16), \
+                               add22adc33(), cadd24(), addi(r0,r0,-1), jnz(-4), \
+                               addi(pc,r5,0)
+// r3:r2 = r3 * r4; destroys r0
+#define mul32_sub()            li(r2,0), li(r0,16), \
+                               add(r2,r2), adc(r3,r3), jnc(2), add(r2,r4), adcz(r3), addi(r0,r0,-1), jnz(-7), \
+                               addi(pc,r5,0)
+#define mul32s_sub()           li(r2,0), li(r0,16), \
+                               add22adc33(), cadd24adc3z(), addi(r0,r0,-1), jnz(-4), \
+                               addi(pc,r5,0)
+// r2 = r2 / r4; r3 = r2 % r4; destroys r0
+#define div16_sub()            li(r3,0), li(r0,16), \
+                               add(r2,r2), adc(r3,r3), cmp(r3,r4), jc(2), sub(r3,r4), addi(r2,r2,1), \
+                               addi(r0,r0,-1), jnz(-8), \
+                               addi(pc,r5,0)
+#define div16s_sub()           li(r3,0), li(r0,16), \
+                               add22adc33(), csub34(), adcz(r2), addi(r0,r0,-1), jnz(-5), cpl(r2), \
+                               addi(pc,r5,0)
+// r3=65091 => r3=0x0006:r0=0x5091; destroys r1, r4;
+// entered BIN2BCD_ENTRY words in, after the subtrahends:
+// - r4 = 10000, r1 = -26 + the address of lwp below = the address of 1000
+// - subtract the subtrahend until it borrows, push the count (digit), next one
+// - the last digit is in r3, collect the other 4 from the stack into r0
+#define BIN2BCD_ENTRY          4
+#define bin2bcd_sub()          const16(1000), const16(100), const16(10), const16(0), \
+                               li(r1,-26), li16(r4,10000), \
+                               li(r0,-1), addi(r0,r0,1), csub34(), jnc(-3), \
+                               push(r0), lwp(r4,r1), addi(r1,r1,2), or(r4,r4), jnz(-9), \
+                               mov(r0,r3), li(r4,4), \
+                               pop(r3), rli(r0,-4), xor(r0,r3), addi(r4,r4,-1), jnz(-5), \
+                               xor(r0,r3), \
+                               addi(pc,r5,0)
+
 #else // #else of #ifndef JUST_OPS
   lw(pc, pc, 0),           // 00 // skip all ISR entry points, jump to Start...
-  const16(/*Start*/0x17A), // 02 // reserved for a distant jump like this
+  const16(START),          // 02 // reserved for a distant jump like this
   jal((0x94 - 0x06) / 2),  // 04 // jump to swi 2 handler
   jal((0xA2 - 0x08) / 2),  // 06 // jump to swi 3 handler
   jal((0xAE - 0x0A) / 2),  // 08 // jump to swi 4 handler
@@ -662,7 +706,30 @@ enum
   reti(),           // must restore interrupt enabledness
 
   // Start:
+  // The dispatcher. All modules run in order if the word at MODULE_LA is 0.
+  // Otherwise only that module runs, preceded by the setup module if it
+  // comes after it, and then execution continues at End, the last word.
+  // mktesti fills in the table and, with -m, the module number.
+#undef MODULE
+#define MODULE 0
+  j(1 + MODULE_CNT),
+  const16(0), // MODULE_LA
+  const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), // TABLE_LA
+  const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0),
+  const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0),
+  const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0),
+  const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0), const16(0),
+  lwa(r0, r1, MODULE_LA),
+  or(r0, r0),
+  jz(11), // all modules
+  li(r1, SETUP_MODULE),
+  cmp(r1, r0),
+  jnc(1),
+  mov(r0, r1), // the setup module first
+  jt(r0, r1),
 
+#undef MODULE
+#define MODULE 1
 #if 01
   // Test loading constants, arithmetic flags, comparison and conditional jumps.
   // Comparison and the conditional jumps are the foundation of tests and business logic.
@@ -695,8 +762,11 @@ enum
   cmp(r2, r2), expect_e(),
   cmp(r1, r2), expect_ne(),
   cmp(r2, r1), expect_ne(),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 2
 #if 01
   // Test loading and adding constants...
   // Start with just li and addi...
@@ -733,8 +803,11 @@ enum
   lurpc(r0, 0x123),
   addi(r1, pc, -2), addu(r1, 0x123),
   cmp(r0, r1), expect_e(),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 3
 #if 01
   // Test mov...
   li16(r0, 0x1111),
@@ -749,8 +822,11 @@ enum
   mov(r2, r3), expect_r16(r2, 0x7777),
   mov(r3, r4), expect_r16(r3, 0x9999),
   mov(r4, r0), expect_r16(r4, 0x3333),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 4
 #if 01
   // Some more tests for conditional jumps...
   li(r0, 17),
@@ -788,8 +864,11 @@ enum
   clc(),
   jc(-3),
   expect_r16(r0, 47),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 5
 #if 01
   // Test j, nop...
   li(r0, 42),
@@ -808,8 +887,11 @@ enum
   j(1),
   j(-3),
   expect_r16(r0, 70),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 6
 #if 01
   // Test jal...
   li(r0, 42),
@@ -830,8 +912,11 @@ enum
   jal(1),
   jal(-5),           // r5 points to expect_r16()
   expect_r16(r0, 62),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 7
 #if 01
   // Test basic ALU operations (reg & imm)...
   li(r1, -1),
@@ -843,8 +928,11 @@ enum
   andi(r2, 0x55), expect_z(),  expect_r16(r2, 0x0000),
   ori(r3, 0x45),  expect_nz(), expect_r16(r3, 0x7C77),
   xori(r4, 0x7A), expect_nz(), expect_r16(r4, 0x7C49),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 8
 #if 01
   // Test mrs/msr...
   // Offsets from 0 to 16KB-1 must map first 16 KB of 4 MB upon reset,
@@ -859,8 +947,13 @@ enum
   li(r1, 0x3C), li(r0, 5), msr(r0, r1), mrs(r5, r0), expect_r16(r5, 0x3C),
   li(r3, 0xF0), li(r2, 6), msr(r2, r3), mrs(r1, r2), expect_r16(r1, 0xF0),
   li(r5, 0x0F), li(r4, 7), msr(r4, r5), mrs(r3, r4), expect_r16(r3, 0x0F),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 9
+  // The setup module: the stack, the swi/reti test, then interrupts.
+
   // Select a 16KB block for boot/system data/stack
   li(r0, 1), // 16KB block 1
   li(r1, 4), // selector 4 (data; offsets 0..16KB-1)
@@ -927,7 +1020,10 @@ enum
   li(r2, -1), mf2(),
   ei(),
 #endif
+  end_module(),
 
+#undef MODULE
+#define MODULE 10
 #if 01
   // Test push/pop...
   mov(r0, sp),
@@ -975,8 +1071,11 @@ enum
   expect_r16(r5, 0x1111),
   mov(r0, sp),
   expect_r16(r0, 0x1000),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 11
 #if 01
   // Test unary operations...
   li(r0, 0x7F),
@@ -991,8 +1090,11 @@ enum
   sxt(r3), expect_r16(r3, 0x007F),
   zxt(r4), expect_r16(r4, 0x0080),
   sxt(r5), expect_r16(r5, 0xFF80),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 12
 #if 01
   // Test basic ALU operations (reg & reg)...
   li16(r1, 0x3FFC),
@@ -1006,8 +1108,11 @@ enum
   and(r3, r1), expect_r16(r3, 0x0FF0),
   or(r4, r1),  expect_r16(r4, 0xFFFF),
   xor(r5, r1), expect_r16(r5, 0xF00F),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 13
 #if 01
   // Test add/sub, adc/sbb, addi, adcz with different carry-ins...
   li(r1, 1),
@@ -1049,8 +1154,11 @@ enum
   adcz(r1), expect_r16(r1, 0x0004),
   clc(),
   adcz(r2), expect_r16(r2, 0x0003),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 14
 #if 01
   // Test cmp and conditional jumps...
   li(r1, -1),
@@ -1075,8 +1183,11 @@ enum
   cmpi(r3, -1), expect_ne(), expect_g(),  expect_ge(), expect_lu(),  expect_leu(),
   cmpi(r3, +0), expect_ne(), expect_g(),  expect_ge(), expect_gu(),  expect_geu(),
   cmpi(r3, +1), expect_e(),  expect_le(), expect_ge(), expect_leu(), expect_geu(),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 15
 #if 01
   // Test shifts...
   li(r0, -1),
@@ -1128,8 +1239,11 @@ enum
   sli(r2, 4),  expect_r16(r2, 0x7650),
   sri(r3, 4),  expect_r16(r3, 0x0876),
   asri(r4, 4), expect_r16(r4, 0xF876),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 16
 #if 01
   // Test sac...
   li(r1, 3),
@@ -1146,8 +1260,11 @@ enum
   li(r5, 9),
   sac(r2, r5, 3),
   sac(r2, r5, 1), expect_r16(r2, 0x0064),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 17
 #if 01
   // Test `add r, r, simm7` with pc being one of the operands,
   // also test linking...
@@ -1174,8 +1291,11 @@ enum
   expect_r16(r2, 0x0002),
   cmp(r5, r3),
   expect_e(),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 18
 #if 01
   // Some more load/store tests...
   addi(sp, sp, -2),
@@ -1205,8 +1325,11 @@ enum
   lw2(r1, r5, r3), expect_r16(r1, 0x0100),
 #endif
   addi(sp, sp, 2),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 19
 #if 01
   // Test pc-relative addressing in loads and stores...
   lb(r1, pc, -2), expect_r16(r1, 0x00FE),
@@ -1228,8 +1351,11 @@ enum
   swp(r1, r0), // Encoded as E471; ROM shouldn't be writable
   lw(r1, pc, -4), expect_r16(r1, 0xE471),
 #endif
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 20
 #if 01
   // Test addm/subm...
   pushi16(2048), pushi16(1024), pushi16(512), pushi16(256), pushi(8), pushi(4), pushi(2), pushi(1), pushi(0),
@@ -1314,8 +1440,11 @@ enum
   expect_r16(r4, -41),
 
   addi(sp, sp, 20),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 21
 #if !MINI
   // Test (d)incm/(d)decm...
   pushi(-10),
@@ -1340,8 +1469,11 @@ enum
   addi(r4, sp, 0), ddecm(r4), expect_nz(),
   addi(r4, sp, 0), ddecm(r4), expect_nz(), expect_r16(r4, -8),
   pop(r1), expect_r16(r1, -10),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 22
 #if !MINI
   // Test (d)incs/(d)decs...
   pushi(-1),
@@ -1365,7 +1497,10 @@ enum
   decs(r3, 0), expect_nz(), expect_r16(r3, 0), lw(r3, sp, 0), expect_r16(r3, -1),
   addi(sp, sp, 2),
 #endif
+  end_module(),
 
+#undef MODULE
+#define MODULE 23
 #if 01
   // Test subroutine prolog/epilog helpers...
   li(r0, 0),
@@ -1400,8 +1535,11 @@ enum
   lw(r3, sp, 4),
   lw(r2, sp, 6),
   last(12),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 24
 #if 01
   // Test writing to the Flags reg, focusing on the arithmetic flags...
   li(r2, -16 + 0), // -16 to keep IRQs unmasked
@@ -1434,8 +1572,11 @@ enum
   mf2(),
   m2f(),
   xor(r1, r2), rli(r1, 6), sli(r1, 6), expect_z(), expect_r16(r1, 0),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 25
 #if 01
   // Test flags preservation in flag-preserving instructions:
   // + push/pop, lx/sx, lx2/sx2, ls5r/ss5r
@@ -1554,8 +1695,11 @@ enum
     mov(r0, r2), m2f(), andi(r0, 15), addi(r0, r0, -15), expect_z(), andi(r2, 15), addi(r2, r2, -15), expect_z(),
 
   addi(sp, sp, 2 * 2),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 26
 #if 01
   // Test resultant flags in flag-modifying instructions:
   // + and/or/xor
@@ -1803,8 +1947,11 @@ enum
   expect_r16(r0, 1),
   expect_r16(r1, 0),
   expect_r16(r3, -1),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 27
 #if 01
   // Test 16-bit x 16-bit = 16-bit multiplication...
   li16(r3, 200/*00C8*/),
@@ -1819,26 +1966,16 @@ enum
   #endif
 
   // multiplication subroutine: r2 = r3 * r4; destroys r0, r3
-  li(r2, 0),
-  li(r0, 16),
-
   #if !SPEEDUP_MULDIV
-  add(r2, r2),
-  add(r3, r3),
-  jnc(1),
-  add(r2, r4),
-  addi(r0, r0, -1),
-  jnz(-6),
+  mul16_sub(),
   #else
-  add22adc33(),
-  cadd24(),
-  addi(r0, r0, -1),
-  jnz(-4),
+  mul16s_sub(),
   #endif
-
-  addi(pc, r5, 0),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 28
 #if 01
   // Test 16-bit x 16-bit = 32-bit multiplication...
   li16(r3, 65432/*FF98*/),
@@ -1854,27 +1991,16 @@ enum
   #endif
 
   // multiplication subroutine: r3:r2 = r3 * r4; destroys r0
-  li(r2, 0),
-  li(r0, 16),
-
   #if !SPEEDUP_MULDIV
-  add(r2, r2),
-  adc(r3, r3),
-  jnc(2),
-  add(r2, r4),
-  adcz(r3),
-  addi(r0, r0, -1),
-  jnz(-7),
+  mul32_sub(),
   #else
-  add22adc33(),
-  cadd24adc3z(),
-  addi(r0, r0, -1),
-  jnz(-4),
+  mul32s_sub(),
   #endif
-
-  addi(pc, r5, 0),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 29
 #if 01
   // Test `16-bit / 16-bit = 16-bit quotient : 16-bit remainder` division...
   li16(r2, 60100/*EAC4*/),
@@ -1889,30 +2015,16 @@ enum
   #endif
 
   // division subroutine: r2 = r2 / r4; r3 = r2 % r4; destroys r0
-  li(r3, 0),
-  li(r0, 16),
-
   #if !SPEEDUP_MULDIV
-  add(r2, r2),
-  adc(r3, r3),
-  cmp(r3, r4),
-  jc(2),
-  sub(r3, r4),
-  addi(r2, r2, 1),
-  addi(r0, r0, -1),
-  jnz(-8),
+  div16_sub(),
   #else
-  add22adc33(),
-  csub34(),
-  adcz(r2),
-  addi(r0, r0, -1),
-  jnz(-5),
-  cpl(r2),
+  div16s_sub(),
   #endif
-
-  addi(pc, r5, 0),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 30
 #if 01
   // Test binary to BCD conversion...
   li16(r3, 65091/*FE43*/),
@@ -1922,45 +2034,12 @@ enum
   j(25), // skip over bin2bcd sub
 
   // binary to BCD conversion subroutine: r3=65091 => r3=0x0006:r0=0x5091; destroys r1, r4
-  const16(1000), const16(100), const16(10), const16(0), // subtrahends
-  li(r1, -26), // will form address of second subtrahend (1000) in lwp below
-  li16(r4, 10000), // r4 = first subtrahend
-
-  // main loop {
-  li(r0, -1), // current digit
-
-    // digit loop {
-    addi(r0, r0, 1),
-    csub34(),
-    jnc(-3),
-    // }
-
-  push(r0), // save/push digit
-  lwp(r4, r1), // r4 = next subtrahend
-  addi(r1, r1, 2),
-  or(r4, r4),
-  jnz(-9),       // repeat if non-zero subtrahend
-  // }
-
-  // least significant digit is in r3, other 4 are on stack
-  mov(r0, r3),
-
-  li(r4, 4),
-
-  // loop to collect all digits from stack {
-  pop(r3),
-  rli(r0, -4),
-  xor(r0, r3),
-
-  addi(r4, r4, -1),
-  jnz(-5),
-  // }
-
-  xor(r0, r3),
-
-  addi(pc, r5, 0),
+  bin2bcd_sub(),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 31
 #if 01
   // Let's write to some 16KB blocks and read the data back...
   li(r0, 0),
@@ -2032,8 +2111,11 @@ enum
     jnz(-9),
 
   msr(r5, r0), // sel1 to point to ROM, selecting block 0
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 32
 #if 01
   // Test the SWI that copies words between arbitrary locations.
   // Copy a few words to block 2.
@@ -2069,8 +2151,11 @@ enum
   pop(r0), expect_r16(r0, 0x7777),
   pop(r0), expect_r16(r0, 0x8888),
   pop(r0), expect_r16(r0, 0x9999),
+  end_module(),
 #endif
 
+#undef MODULE
+#define MODULE 33
 #if 01
   // Test the SWI that transfers control to arbitrary location.
   // block 0
@@ -2120,13 +2205,69 @@ enum
   expect_r16(r2, 0x0011),
   expect_r16(r3, 0x1122),
   expect_r16(r4, 0x2200),
+  end_module(),
+#endif
+
+#undef MODULE
+#define MODULE 34
+#if 01
+  // Test the performance counters (emu -perf), mrs r, s with 8 <= s < 16.
+  // Without them (and on poc.circ with the PERFEN input low) both reads
+  // below return sel0 and the rest of the module is skipped.
+  di(), // no IRQs between the reads
+  li(r4, 8), // cycles, low half
+  mrs(r0, r4),
+  mrs(r1, r4),
+  sub(r1, r0),
+  jz(50), // no performance counters, to .skip
+  addi(r1, r1, -2), expect_z(), // one mrs
+
+  // Read the 32-bit cycle counter twice, the high half latched by
+  // the low half read, and subtract.
+  li(r5, 9), // cycles, high half
+  mrs(r0, r4), mrs(r1, r5),
+  mrs(r2, r4), mrs(r3, r5),
+  sub(r2, r0), sbb(r3, r1),
+  or(r3, r3), expect_z(),
+  addi(r2, r2, -4), expect_z(), // two mrs
+
+  // Retired instructions.
+  li(r4, 10), li(r5, 11),
+  mrs(r0, r4), mrs(r1, r5),
+  mrs(r2, r4), mrs(r3, r5),
+  sub(r2, r0), sbb(r3, r1),
+  or(r3, r3), expect_z(),
+  addi(r2, r2, -2), expect_z(), // two mrs
+
+  // Memory accesses by instructions, an lw between the reads.
+  li(r4, 12), li(r5, 13),
+  mrs(r0, r4), mrs(r1, r5),
+  lw(r3, sp, 0),
+  mrs(r2, r4), mrs(r3, r5),
+  sub(r2, r0), sbb(r3, r1),
+  or(r3, r3), expect_z(),
+  addi(r2, r2, -1), expect_z(), // lw
+
+  // IRQs taken.
+  li(r4, 14), li(r5, 15),
+  mrs(r0, r4), mrs(r1, r5),
+  mrs(r2, r4), mrs(r3, r5),
+  sub(r2, r0), sbb(r3, r1),
+  or(r3, r3), expect_z(),
+  or(r2, r2), expect_z(), // none while disabled
+
+//.skip:
+  ei(),
+  end_module(),
 #endif
 
   j(-1)
 
 #endif // #endif of #ifndef JUST_OPS
 
-#ifndef JUST_OPS
+// Other programs may define JUST_MACROS and include this file to get
+// the macros above (e.g. muldivchk.c).
+#if !defined JUST_OPS && !defined JUST_MACROS
 
 const ushort mem[] =
 {
@@ -2146,33 +2287,45 @@ const ushort linenums[] =
 #undef LINE
 };
 
-FILE* startup(int argc, char* argv[], char** outname, int* bigendian)
+// The module of every word, NO_MODULE before Start (and without modules).
+#define NO_MODULE 0xFF
+const ushort modnums[] =
+{
+#undef MODULE
+#define MODULE NO_MODULE
+#define LINE(a) MODULE
+#define JUST_OPS
+#include THIS_FILE
+#undef JUST_OPS
+#undef LINE
+};
+
+FILE* startup(int argc, char* argv[], char** outname, int* bigendian, uint* module)
 {
   FILE* f;
+  int i;
 
-  if (argc < 2 || argc > 3)
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      *bigendian = 1;
+    else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+      *module = strtoul(argv[++i], NULL, 0);
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
   {
 lusage:
     fprintf(stderr,
             "Usage:\n"
             "  " THIS_FILE_SANS_EXT " [options] <output_file>\n"
             "Options:\n"
-            "  -be   big-endian output\n");
+            "  -be     big-endian output\n"
+            "  -m <n>  run only test module n (see MODULE in " THIS_FILE ")\n");
     exit(EXIT_FAILURE);
   }
-
-  if ((*bigendian = !strcmp(argv[1], "-be")) != 0)
-  {
-    if (argc < 3)
-      goto lusage;
-    *outname = argv[2];
-  }
-  else
-  {
-    if (argc > 2)
-      goto lusage;
-    *outname = argv[1];
-  }
+  *outname = argv[i];
 
   if ((f = fopen(*outname, "wb")) == NULL)
   {
@@ -2207,15 +2360,65 @@ void writebytes(FILE* f, char* outname, int bigendian, int nbytes, ulong value)
   }
 }
 
+// Fills in the module table of the dispatcher (see Start) and the module
+// to run alone (0 = all).
+void linkmodules(ushort* rom, uint size, uint module)
+{
+  uint idx, k;
+
+  for (idx = 0; idx < size && modnums[idx] != 0; idx++)
+    ;
+  if (idx == size)
+  {
+    if (module)
+    {
+      fprintf(stderr, "No test modules in " THIS_FILE "\n");
+      exit(EXIT_FAILURE);
+    }
+    return;
+  }
+  if (idx * 2 != START)
+  {
+    fprintf(stderr, "Start is at %04X, not at START\n", idx * 2);
+    exit(EXIT_FAILURE);
+  }
+
+  for (k = 0; k < MODULE_CNT; k++)
+    rom[TABLE_LA / 2 + k] = (size - 1) * 2; // End
+  for (idx = size; idx--; )
+  {
+    if (modnums[idx] == NO_MODULE || modnums[idx] == 0)
+      continue;
+    if (modnums[idx] >= MODULE_CNT)
+    {
+      fprintf(stderr, "Module %u doesn't fit in the table\n", modnums[idx]);
+      exit(EXIT_FAILURE);
+    }
+    rom[TABLE_LA / 2 + modnums[idx]] = idx * 2;
+  }
+
+  if (module >= MODULE_CNT || (module && rom[TABLE_LA / 2 + module] == (size - 1) * 2))
+  {
+    fprintf(stderr, "No module %u\n", module);
+    exit(EXIT_FAILURE);
+  }
+  rom[MODULE_LA / 2] = module;
+}
+
 int main(int argc, char* argv[])
 {
   int bigendian = 0;
   char* outname = NULL;
-  FILE* f = startup(argc, argv, &outname, &bigendian);
+  uint module = 0;
+  FILE* f = startup(argc, argv, &outname, &bigendian, &module);
   uint size = sizeof(mem) / sizeof(mem[0]), idx, l = 1;
+  static ushort rom[sizeof(mem) / sizeof(mem[0])];
+
+  memcpy(rom, mem, sizeof rom);
+  linkmodules(rom, size, module);
 
   for (idx = 0; idx < size; idx++)
-    writebytes(f, outname, bigendian, 2, mem[idx]);
+    writebytes(f, outname, bigendian, 2, rom[idx]);
   if (fclose(f))
   {
     fprintf(stderr, "Can't write to \"%s\"", outname);
@@ -2231,7 +2434,7 @@ int main(int argc, char* argv[])
   for (idx = 0; idx < size; idx++)
   {
     int ch;
-    printf(THIS_FILE ":%-5u  %04X  %04X  ", linenums[idx], idx * 2, mem[idx]);
+    printf(THIS_FILE ":%-5u  %04X  %04X  ", linenums[idx], idx * 2, rom[idx]);
     while (l < linenums[idx])
     {
       while ((ch = fgetc(f)) != '\n');
@@ -2250,4 +2453,4 @@ int main(int argc, char* argv[])
   return 0;
 }
 
-#endif // #endif of #ifndef JUST_OPS
+#endif // #endif of #if !defined JUST_OPS && !defined JUST_MACROS
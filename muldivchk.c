@@ -0,0 +1,454 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 multiplication/division subroutine check.
+
+  Runs the subroutines of mktesti.c that other code copies, the 16-bit
+  and the 32-bit product multiplications, the division and the binary to
+  BCD conversion, in the microcode-driven model of emu.h on every input:
+  all 2^32 operand pairs (2^16 values for the conversion). The results
+  are compared with the host's arithmetic, and so are the registers the
+  subroutines must preserve. The multiplications and the division are
+  checked both in their plain form and in the SPEEDUP_MULDIV form (with
+  add22adc33(), cadd24(), etc). The subroutines are the mul16_sub(),
+  mul16s_sub(), etc macros of mktesti.c (see JUST_MACROS there), which
+  its test modules are assembled from as well.
+
+  Division by 0 has no host result, the expected one is what restoring
+  division gives: the quotient is 0xFFFF and the remainder is the
+  dividend.
+
+  The clock cycles each subroutine takes, from its first instruction to
+  its return, inclusive, are reported as minimum, mean and maximum (of
+  the calls that return).
+
+  The first operands are split among -j threads. -n checks n first
+  operands instead of all of them for a quicker run.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread muldivchk.c -o muldivchk.exe
+
+  How to compile for the MINI variant:
+    gcc -std=c99 -O2 -Wall -pthread -DMINI=1 muldivchk.c -o muldivchk_mini.exe
+*/
+
+#ifndef MINI
+#define MINI 0
+#endif
+
+#include <pthread.h>
+#include "emu.h"
+#include "isa.h"
+#include "drom.h"
+#include "drom_mini.h"
+
+#define JUST_MACROS
+#include "mktesti.c"
+#undef JUST_MACROS
+
+#define LINE(a) a
+
+enum
+{
+  CODE_LA      = 0x0100, // where the subroutine is placed
+  RET_LA       = 0x3FFE, // return address, never executed
+  STACK_LA     = 0xC000, // initial sp, data block 2 (RAM)
+  MAX_CYCLES   = 4096,   // a subroutine taking longer is stuck
+  MAX_EXAMPLES = 4       // mismatches to show per subroutine
+};
+
+enum
+{
+  MUL16,   // r2 = r3 * r4; destroys r0, r3
+  MUL32,   // r3:r2 = r3 * r4; destroys r0
+  DIV,     // r2 = r2 / r4; r3 = r2 % r4; destroys r0
+  BIN2BCD  // r3=65091 => r3=0x0006:r0=0x5091; destroys r1, r4
+};
+
+// The subroutines of mktesti.c, ending with the return.
+const ushort mul16[] = { mul16_sub() };
+const ushort mul16s[] = { mul16s_sub() };
+const ushort mul32[] = { mul32_sub() };
+const ushort mul32s[] = { mul32s_sub() };
+const ushort div16[] = { div16_sub() };
+const ushort div16s[] = { div16s_sub() };
+const ushort bin2bcd[] = { bin2bcd_sub() };
+
+typedef struct
+{
+  const char* name;
+  const char* form;
+  int kind;
+  const ushort* code;
+  uint size;  // words
+  uint entry; // word index of the first instruction
+} Routine;
+
+#define ROUTINE(name, form, kind, code, entry) \
+  { name, form, kind, code, sizeof code / sizeof code[0], entry }
+
+const Routine routines[] =
+{
+  ROUTINE("mul16", "plain", MUL16, mul16, 0),
+  ROUTINE("mul16", "speedup", MUL16, mul16s, 0),
+  ROUTINE("mul32", "plain", MUL32, mul32, 0),
+  ROUTINE("mul32", "speedup", MUL32, mul32s, 0),
+  ROUTINE("div", "plain", DIV, div16, 0),
+  ROUTINE("div", "speedup", DIV, div16s, 0),
+  ROUTINE("bin2bcd", "", BIN2BCD, bin2bcd, BIN2BCD_ENTRY),
+};
+
+enum
+{
+  NROUTINES = sizeof routines / sizeof routines[0]
+};
+
+// Register values on entry besides the operands, r5 and sp.
+const uint canary[6] = { 0xA5C3, 0x5A3C, 0xC35A, 0x3CA5, 0x6996, 0x9669 };
+
+typedef struct
+{
+  uint a, b;
+  uint got[8], exp[8], mask; // registers that differ
+  int stuck;
+} Example;
+
+typedef struct
+{
+  uint first, step;
+  unsigned long long cnt[NROUTINES], mism[NROUTINES], ret[NROUTINES], sum[NROUTINES];
+  uint min[NROUTINES], max[NROUTINES];
+  Example ex[NROUTINES][MAX_EXAMPLES];
+  int nex[NROUTINES];
+} Job;
+
+const ulong* drom;
+int mini = MINI;
+uint* alist;
+uint na;
+
+// Tells whether the subroutine takes one operand.
+int unary(int kind)
+{
+  return kind == BIN2BCD;
+}
+
+// Sets the registers on entry to the subroutine of kind from a (and b),
+// and the registers it must have on return. Returns the mask of the
+// registers to compare.
+uint setregs(int kind, uint a, uint b, uint in[8], uint out[8])
+{
+  uint i, bcd = 0, v;
+
+  for (i = 0; i < 6; i++)
+    in[i] = canary[i];
+  in[r5] = RET_LA;
+  in[sp] = STACK_LA;
+  in[pc] = RET_LA;
+
+  switch (kind)
+  {
+  case MUL16:
+  case MUL32:
+    in[r3] = a, in[r4] = b;
+    break;
+  case DIV:
+    in[r2] = a, in[r4] = b;
+    break;
+  case BIN2BCD:
+    in[r3] = a;
+    break;
+  }
+  memcpy(out, in, 8 * sizeof *out);
+
+  switch (kind)
+  {
+  case MUL16:
+    out[r2] = (a * b) & 0xFFFF;
+    return (1U << r1) | (1U << r2) | (1U << r4) | (1U << r5) | (1U << sp) | (1U << pc);
+  case MUL32:
+    out[r2] = (a * b) & 0xFFFF;
+    out[r3] = (a * b) >> 16;
+    return (1U << r1) | (1U << r2) | (1U << r3) | (1U << r4) | (1U << r5) | (1U << sp) | (1U << pc);
+  case DIV:
+    out[r2] = b ? a / b : 0xFFFF;
+    out[r3] = b ? a % b : a;
+    return (1U << r1) | (1U << r2) | (1U << r3) | (1U << r4) | (1U << r5) | (1U << sp) | (1U << pc);
+  default:
+    for (v = a % 10000, i = 0; i < 4; i++, v /= 10)
+      bcd |= (v % 10) << (i * 4);
+    out[r0] = bcd;
+    out[r3] = a / 10000;
+    return (1U << r0) | (1U << r2) | (1U << r3) | (1U << r5) | (1U << sp) | (1U << pc);
+  }
+}
+
+// Runs the subroutine loaded into cpu from registers in, returns the
+// clock cycles it takes or 0 if it doesn't return.
+uint call(Cpu* cpu, const Routine* rt, const uint in[8])
+{
+  ulong start = cpu->cycles;
+
+  memcpy(cpu->r, in, 8 * sizeof *in);
+  cpu->r[pc] = CODE_LA + rt->entry * 2;
+  cpu->clk = CLK_FETCH;
+  if (emurun(cpu, RET_LA, start + MAX_CYCLES) != RUN_PASSED)
+    return 0;
+  return cpu->cycles - start;
+}
+
+void check(Job* jb, int ri, Cpu* cpu, uint a, uint b)
+{
+  const Routine* rt = &routines[ri];
+  uint in[8], out[8], mask = setregs(rt->kind, a, b, in, out), ncycles, diff = 0, i;
+
+  ncycles = call(cpu, rt, in);
+  if (ncycles)
+  {
+    jb->ret[ri]++;
+    jb->sum[ri] += ncycles;
+    if (jb->min[ri] > ncycles)
+      jb->min[ri] = ncycles;
+    if (jb->max[ri] < ncycles)
+      jb->max[ri] = ncycles;
+    for (i = 0; i < 8; i++)
+      if ((mask >> i) & 1 && cpu->r[i] != out[i])
+        diff |= 1U << i;
+  }
+  jb->cnt[ri]++;
+
+  if (ncycles && !diff)
+    return;
+  jb->mism[ri]++;
+  if (jb->nex[ri] < MAX_EXAMPLES)
+  {
+    Example* x = &jb->ex[ri][jb->nex[ri]++];
+    x->a = a;
+    x->b = b;
+    memcpy(x->got, cpu->r, sizeof x->got);
+    memcpy(x->exp, out, sizeof x->exp);
+    x->mask = diff;
+    x->stuck = !ncycles;
+  }
+}
+
+void* job(void* arg)
+{
+  Job* jb = arg;
+  uchar* mem;
+  Cpu cpu;
+  int ri;
+  uint ai, b, i;
+
+  if ((mem = calloc(MEM_SIZE, 1)) == NULL)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  for (ri = 0; ri < NROUTINES; ri++)
+  {
+    const Routine* rt = &routines[ri];
+
+    for (i = 0; i < rt->size; i++)
+    {
+      mem[CODE_LA + i * 2] = rt->code[i] & 0xFF;
+      mem[CODE_LA + i * 2 + 1] = rt->code[i] >> 8;
+    }
+    cpuinit(&cpu, mini, drom, mem);
+    cpu.sel[4 + (STACK_LA - 2) / BLOCK_SIZE] = 2; // the stack is in RAM
+    jb->min[ri] = UINT_MAX;
+
+    if (unary(rt->kind))
+    {
+      for (b = jb->first; b < 0x10000; b += jb->step)
+        check(jb, ri, &cpu, b, 0);
+      continue;
+    }
+    for (ai = jb->first; ai < na; ai += jb->step)
+      for (b = 0; b < 0x10000; b++)
+        check(jb, ri, &cpu, alist[ai], b);
+  }
+
+  free(mem);
+  return NULL;
+}
+
+void prregs(const uint r[8], uint mask)
+{
+  uint i;
+  for (i = 0; i < 8; i++)
+    if ((mask >> i) & 1)
+      printf(" %s=%04X", isa_regs[i], r[i]);
+}
+
+int main(int argc, char* argv[])
+{
+  int nthreads = 4, bigendian = 0;
+  ulong n = 0x10000, seed = 0;
+  unsigned long long total = 0, calls = 0;
+  ulong* dromfile = NULL;
+  uint i;
+  int t, ri, e;
+  Job* jobs;
+  pthread_t* thr;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-n") && i + 1 < (uint)argc)
+      n = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-seed") && i + 1 < (uint)argc)
+      seed = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else
+      goto lusage;
+  }
+  if (argc - i > 1 || n < 1 || n > 0x10000)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  muldivchk [options] [<decoder_rom_file>]\n"
+            "Options:\n"
+            "  -be         big-endian input file\n"
+            "  -n <n>      check n first operands (default: all 65536)\n"
+            "  -seed <n>   first first operand to check (default: 0)\n"
+            "  -j <n>      number of threads (default: 4)\n"
+            "The built-in decoder ROM (drom.h or, with -DMINI=1, drom_mini.h)\n"
+            "is used if no file is given.\n");
+    exit(EXIT_FAILURE);
+  }
+
+  if (argc - i == 1)
+  {
+    if ((dromfile = malloc(DROM_CNT * sizeof *dromfile)) == NULL)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    if (loaddrom(argv[i], dromfile, bigendian) != MINI)
+    {
+      fprintf(stderr, "The decoder ROM is for the %s variant, compile with%s -DMINI=1\n",
+                      MINI ? "full" : "MINI", MINI ? "out" : "");
+      exit(EXIT_FAILURE);
+    }
+    drom = dromfile;
+  }
+  else
+  {
+    drom = MINI ? drom_mini_rom : drom_rom;
+  }
+
+  // First operands: seed, seed + 40503, ... (all of them if n = 65536).
+  na = n;
+  if ((alist = malloc(na * sizeof *alist)) == NULL)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < na; i++)
+    alist[i] = (seed + i * 40503UL) & 0xFFFF;
+
+  jobs = calloc(nthreads, sizeof *jobs);
+  thr = calloc(nthreads, sizeof *thr);
+  if (!jobs || !thr)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (t = 0; t < nthreads; t++)
+  {
+    jobs[t].first = t;
+    jobs[t].step = nthreads;
+    if (pthread_create(&thr[t], NULL, job, &jobs[t]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (t = 0; t < nthreads; t++)
+    pthread_join(thr[t], NULL);
+
+  printf("%-8s %-8s %5s %12s %12s %8s %8s %8s\n",
+         "name", "form", "words", "checked", "mismatches", "min", "mean", "max");
+  for (ri = 0; ri < NROUTINES; ri++)
+  {
+    const Routine* rt = &routines[ri];
+    unsigned long long cnt = 0, mism = 0, ret = 0, sum = 0;
+    uint mn = UINT_MAX, mx = 0;
+    for (t = 0; t < nthreads; t++)
+    {
+      cnt += jobs[t].cnt[ri];
+      mism += jobs[t].mism[ri];
+      ret += jobs[t].ret[ri];
+      sum += jobs[t].sum[ri];
+      if (mn > jobs[t].min[ri])
+        mn = jobs[t].min[ri];
+      if (mx < jobs[t].max[ri])
+        mx = jobs[t].max[ri];
+    }
+    total += mism;
+    calls += cnt;
+    if (ret)
+      printf("%-8s %-8s %5u %12llu %12llu %8u %8.2f %8u\n",
+             rt->name, rt->form, rt->size - rt->entry, cnt, mism,
+             mn, (double)sum / ret, mx);
+    else
+      printf("%-8s %-8s %5u %12llu %12llu %8s %8s %8s\n",
+             rt->name, rt->form, rt->size - rt->entry, cnt, mism, "-", "-", "-");
+  }
+
+  for (ri = 0; ri < NROUTINES; ri++)
+  {
+    const Routine* rt = &routines[ri];
+    int shown = 0;
+    for (t = 0; t < nthreads; t++)
+      for (e = 0; e < jobs[t].nex[ri] && shown < MAX_EXAMPLES; e++, shown++)
+      {
+        const Example* x = &jobs[t].ex[ri][e];
+        if (unary(rt->kind))
+          printf("%s %04X:", rt->name, x->a);
+        else
+          printf("%s %s %04X, %04X:", rt->name, rt->form, x->a, x->b);
+        if (x->stuck)
+        {
+          printf(" doesn't return in %u cycles\n", MAX_CYCLES);
+          continue;
+        }
+        prregs(x->got, x->mask);
+        printf(", expected:");
+        prregs(x->exp, x->mask);
+        printf("\n");
+      }
+  }
+
+  printf("\nChecked %llu calls of %d subroutines: %llu mismatches\n",
+         calls, NROUTINES, total);
+
+  return total ? EXIT_FAILURE : 0;
+}
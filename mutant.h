@@ -0,0 +1,166 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 decoder ROM mutants (used by drommut.c and testmin.c).
+
+  A mutant of a decoder ROM row has one control signal flipped or one
+  multi-bit field (OP, RL, RR, RI, IMM) set to another value. A test ROM
+  kills a mutant when it fails (gets stuck in a loop away from its last
+  instruction) or hangs (runs more than twice as many cycles as with the
+  original decoder ROM) with it.
+
+  The mutants are run on a pool of threads, each with its own copy of the
+  memory.
+*/
+
+#ifndef MUTANT_H
+#define MUTANT_H
+
+#include <pthread.h>
+#include "emu.h"
+
+typedef struct
+{
+  const char* name;
+  uint pos, bits;
+} Field;
+
+const Field fields[] =
+{
+  { "OP", POS_OP, 4 }, { "RL", POS_RL, 3 }, { "RLOE", POS_RLOE, 1 },
+  { "RR", POS_RR, 3 }, { "RROE", POS_RROE, 1 }, { "RI", POS_RI, 3 },
+  { "RIWE", POS_RIWE, 1 }, { "IMM", POS_IMM, 3 }, { "RRBUSOE", POS_RRBUSOE, 1 },
+  { "ALUOE", POS_ALUOE, 1 }, { "FLAGSOE", POS_FLAGSOE, 1 }, { "FLAGSWE", POS_FLAGSWE, 1 },
+  { "IADDRSEL", POS_IADDRSEL, 1 }, { "IWE", POS_IWE, 1 }, { "SELE", POS_SELE, 1 },
+  { "SELIFLAGSSEL", POS_SELIFLAGSSEL, 1 }, { "CNZ", POS_CNZ, 1 }, { "MWE", POS_MWE, 1 },
+  { "MOE", POS_MOE, 1 }, { "W16", POS_W16, 1 }, { "CRST", POS_CRST, 1 }
+};
+
+enum
+{
+  NFIELDS     = sizeof fields / sizeof fields[0],
+  MUT_PER_ROW = 64 // room for the mutants of a row
+};
+
+typedef struct
+{
+  ushort idx;   // decoder ROM row
+  uchar field;  // fields[]
+  uchar val;    // new value
+} Mutant;
+
+typedef struct
+{
+  uint first, step;
+} MutJob;
+
+// Writes the mutants of decoder ROM row idx to mu, returns their number.
+uint mutrow(const ulong* rom, uint idx, Mutant* mu)
+{
+  uint f, v, n = 0;
+  for (f = 0; f < NFIELDS; f++)
+    for (v = 0; v < 1U << fields[f].bits; v++)
+      if (v != CTL(rom[idx], fields[f].pos, fields[f].bits))
+      {
+        mu[n].idx = idx;
+        mu[n].field = f;
+        mu[n++].val = v;
+      }
+  return n;
+}
+
+// The mutated decoder ROM word.
+ulong mutword(const ulong* rom, const Mutant* mu)
+{
+  const Field* f = &fields[mu->field];
+  ulong mask = ((1UL << f->bits) - 1) << f->pos;
+  return (rom[mu->idx] & ~mask) | ((ulong)mu->val << f->pos);
+}
+
+// Runs the test ROM of progsize bytes in memory m (all RAM zero) with the
+// decoder ROM rom for at most limit clock cycles. Returns RUN_*. The RAM
+// written by the test is zeroed again afterwards using wlog (room for
+// limit entries). Counts the executions of every decoder ROM row in
+// counts and records an instruction executing it in example (either may
+// be NULL) and the clock cycles in *cycles (ditto).
+uint mutrun(const ulong* rom, int mini, uchar* m, ulong* wlog, ulong progsize,
+            ulong limit, ulong* counts, uint* example, ulong* cycles)
+{
+  Cpu cpu;
+  Run r;
+  uint res;
+  ulong nlog = 0, i;
+  cpuinit(&cpu, mini, rom, m);
+  runinit(&r, progsize - 2, limit);
+  while ((res = runcheck(&r, &cpu)) == RUN_GOING)
+  {
+    cpucycle(&cpu);
+    if ((cpu.lacc & ACC_WRITE) && cpu.lpa >= ROM_SIZE)
+      wlog[nlog++] = cpu.lpa & ~1UL;
+    if (cpu.lclk != CLK_FETCH)
+    {
+      if (counts)
+        counts[cpu.lidx]++;
+      if (example)
+        example[cpu.lidx] = cpu.ir;
+    }
+  }
+  for (i = 0; i < nlog; i++)
+    m[wlog[i]] = m[wlog[i] + 1] = 0;
+  if (cycles)
+    *cycles = cpu.cycles;
+  return res;
+}
+
+// Runs job on nthreads threads. Thread k gets a MutJob with first = k and
+// step = nthreads to pick its share of the work.
+void mutjobs(int nthreads, void* (*job)(void*))
+{
+  MutJob* jobs = calloc(nthreads, sizeof *jobs);
+  pthread_t* thr = calloc(nthreads, sizeof *thr);
+  int i;
+  if (!jobs || !thr)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < nthreads; i++)
+  {
+    jobs[i].first = i;
+    jobs[i].step = nthreads;
+    if (pthread_create(&thr[i], NULL, job, &jobs[i]))
+    {
+      fprintf(stderr, "Can't create thread\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  for (i = 0; i < nthreads; i++)
+    pthread_join(thr[i], NULL);
+  free(jobs);
+  free(thr);
+}
+
+#endif
@@ -0,0 +1,480 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 test ROM reducer.
+
+  Greedily picks a (small, not necessarily smallest) subset of the test
+  modules of a test ROM made by mktesti.c (see MODULE there) that covers
+  the decoder ROM as well as the whole test ROM and writes a test ROM that
+  runs just that subset, for quicker (smoke) runs in Logisim-evolution.
+  The modules are the smallest parts of the test ROM that can run alone,
+  the tests within one build on one another's state. The whole test ROM
+  is still the one to run to check everything. The coverage kept is:
+  - the decoder ROM rows executed and the row signals checked (a control
+    signal of a row is checked if the test kills any of its mutants, see
+    drommut.c), by default
+  - the rows executed and every mutant killed, with -exact
+  - just the rows executed, with -rows (the checks still steer the choice,
+    but the reduced test ROM kills fewer mutants)
+
+  Every module is run alone (preceded by the setup module as with
+  mktesti -m) with the original decoder ROM and with the mutants that
+  the whole test ROM kills and that mutate the rows the module executes.
+  The setup module is always kept, the other modules are picked greedily,
+  by the rows and checks not yet covered per cycle, and then the
+  modules the others make redundant are dropped again. The first words
+  of the dropped modules are replaced with a jump to the next kept
+  module. The resulting test ROM is then checked with the same mutants,
+  if running the modules after one another loses some of the coverage,
+  the modules that cover the loss are added back.
+
+  The mutants (see mutant.h) are run on a pool of threads (-j), each with
+  its own copy of the memory.
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread testmin.c -o testmin.exe
+*/
+
+#include "mutant.h"
+#include "isa.h"
+
+#define JUST_MACROS
+#include "mktesti.c"
+#undef JUST_MACROS
+
+#define LINE(a) a
+
+enum
+{
+  FULL = 0,         // image of the whole test ROM
+  FAST = MODULE_CNT // image of the reduced test ROM, images 1...MODULE_CNT-1 run module n alone
+};
+
+typedef struct
+{
+  uchar img;    // images[]
+  uint mutant;  // mutants[]
+} Task;
+
+ulong drom[DROM_CNT];
+uchar images[MODULE_CNT + 1][ROM_SIZE];
+ulong progsize;
+int mini;
+uint starts[MODULE_CNT];              // module addresses, End if there's no module
+int present[MODULE_CNT], chosen[MODULE_CNT];
+ulong cycles[MODULE_CNT + 1];
+ulong rows[MODULE_CNT + 1][DROM_CNT]; // executions per decoder ROM row of every image
+Mutant* mutants;
+ulong nmutants;
+uchar* kills;                         // [image * nmutants + mutant]
+ulong* groupof;                       // check of every mutant
+ulong ngroups;
+uchar* checks;                        // [image * ngroups + check], killed mutants
+Task* tasks;
+ulong ntasks, maxcycles;
+
+// Runs tasks first, first + step, first + 2 * step, ...
+void* job(void* arg)
+{
+  MutJob* j = arg;
+  ulong i;
+  uint img = FAST + 1;
+  uchar* m = calloc(MEM_SIZE, 1);
+  ulong* rom = malloc(sizeof drom);
+  ulong* wlog = malloc(maxcycles * sizeof *wlog);
+  if (!m || !rom || !wlog)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  memcpy(rom, drom, sizeof drom);
+  for (i = j->first; i < ntasks; i += j->step)
+  {
+    const Task* t = &tasks[i];
+    const Mutant* mu = &mutants[t->mutant];
+    if (t->img != img)
+      memcpy(m, images[img = t->img], ROM_SIZE);
+    rom[mu->idx] = mutword(drom, mu);
+    kills[t->img * nmutants + t->mutant] =
+      mutrun(rom, mini, m, wlog, progsize, 2 * cycles[t->img], NULL, NULL, NULL) != RUN_PASSED;
+    rom[mu->idx] = drom[mu->idx];
+  }
+  free(m);
+  free(rom);
+  free(wlog);
+  return NULL;
+}
+
+// Runs the tasks on nthreads threads.
+void runtasks(int nthreads)
+{
+  mutjobs(nthreads, job);
+  ntasks = 0;
+}
+
+// Runs image img with the original decoder ROM, recording its rows and cycles.
+void runbase(uint img)
+{
+  static uchar* m;
+  static ulong* wlog;
+  if (!m && (!(m = calloc(MEM_SIZE, 1)) || !(wlog = malloc(100000000UL / 16 * sizeof *wlog))))
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  memcpy(m, images[img], ROM_SIZE);
+  memset(rows[img], 0, sizeof rows[img]);
+  if (mutrun(drom, mini, m, wlog, progsize, 100000000UL / 16, rows[img], NULL, &cycles[img]) !=
+      RUN_PASSED)
+  {
+    if (img == FULL || img == FAST)
+      fprintf(stderr, "The %s test ROM fails with the original decoder ROM\n",
+              (img == FULL) ? "whole" : "reduced");
+    else
+      fprintf(stderr, "Module %u fails with the original decoder ROM\n", img);
+    exit(EXIT_FAILURE);
+  }
+}
+
+// Queues the mutants that the whole test ROM kills and that mutate the
+// rows image img executes.
+void addtasks(uint img)
+{
+  ulong i;
+  for (i = 0; i < nmutants; i++)
+  {
+    kills[img * nmutants + i] = 0;
+    if (kills[FULL * nmutants + i] && rows[img][mutants[i].idx])
+    {
+      tasks[ntasks].img = img;
+      tasks[ntasks++].mutant = i;
+    }
+  }
+}
+
+// Finds the checks of image img from its killed mutants.
+void mkchecks(uint img)
+{
+  ulong i;
+  memset(checks + img * ngroups, 0, ngroups);
+  for (i = 0; i < nmutants; i++)
+    checks[img * ngroups + groupof[i]] |= kills[img * nmutants + i];
+}
+
+// The number of the rows and (unless rowsonly) the checks of the whole
+// test ROM that image img covers and that aren't covered yet (counts per
+// row and check).
+ulong gain(uint img, const ulong* rcov, const ulong* gcov, int rowsonly)
+{
+  ulong n = 0, i;
+  for (i = 0; i < DROM_CNT; i++)
+    n += rows[FULL][i] && rows[img][i] && !rcov[i];
+  for (i = 0; i < ngroups * !rowsonly; i++)
+    n += checks[img * ngroups + i] && !gcov[i];
+  return n;
+}
+
+// Adds image img to (d = 1) or removes it from (d = -1) the counts.
+void count(uint img, int d, ulong* rcov, ulong* gcov)
+{
+  ulong i;
+  for (i = 0; i < DROM_CNT; i++)
+    if (rows[FULL][i] && rows[img][i])
+      rcov[i] += d;
+  for (i = 0; i < ngroups; i++)
+    if (checks[img * ngroups + i])
+      gcov[i] += d;
+}
+
+// The cycles module k adds to a run, not counting the setup module.
+ulong cost(uint k)
+{
+  return (k > SETUP_MODULE) ? cycles[k] - cycles[SETUP_MODULE] : cycles[k];
+}
+
+// Makes the reduced test ROM of the chosen modules: every dropped module
+// begins with a jump to the next chosen one (or to End).
+void mkfast(void)
+{
+  uint k, n;
+  memcpy(images[FAST], images[FULL], ROM_SIZE);
+  for (k = 1; k < MODULE_CNT; k++)
+  {
+    static const ushort jump[] = { lw(pc, pc, 0) };
+    uint la = starts[k], to;
+    if (!present[k] || chosen[k])
+      continue;
+    for (n = k + 1; n < MODULE_CNT && !(present[n] && chosen[n]); n++)
+      ;
+    to = (n < MODULE_CNT) ? starts[n] : progsize - 2;
+    images[FAST][la] = jump[0] & 0xFF;
+    images[FAST][la + 1] = jump[0] >> 8;
+    images[FAST][la + 2] = to & 0xFF;
+    images[FAST][la + 3] = to >> 8;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int bigendian = 0, exact = 0, rowsonly = 0, nthreads = 4;
+  char* dromname;
+  char* progname;
+  char* fastname;
+  uint ninstr, idx, i, k;
+  ulong n, nrows = 0, nkills = 0, nchecks = 0, frows, fkills, fchecks, lost;
+  ulong* rcov;
+  ulong* gcov;
+  FILE* fout;
+
+  for (i = 1; i < (uint)argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-be"))
+      bigendian = 1;
+    else if (!strcmp(argv[i], "-exact"))
+      exact = 1;
+    else if (!strcmp(argv[i], "-rows"))
+      rowsonly = 1;
+    else if (!strcmp(argv[i], "-j") && i + 1 < (uint)argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else
+      goto lusage;
+  }
+  if (argc - i != 3)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  testmin [options] <decoder_rom_file> <program_rom_file> <output_file>\n"
+            "Options:\n"
+            "  -be     big-endian input and output files\n"
+            "  -exact  keep every killed mutant killed, not just every checked row signal\n"
+            "  -rows   keep just the executed rows, the checks only steer the choice\n"
+            "  -j <n>  number of threads (default: 4)\n");
+    exit(EXIT_FAILURE);
+  }
+  dromname = argv[i];
+  progname = argv[i + 1];
+  fastname = argv[i + 2];
+
+  mini = loaddrom(dromname, drom, bigendian);
+  progsize = loadfile(progname, images[FULL], ROM_SIZE, bigendian, 2);
+  ninstr = 1U << (mini ? DROM_MINI_INSTR_BITS : DROM_INSTR_BITS);
+
+  // The modules, from the table that mktesti fills in.
+  if (progsize <= TABLE_LA + 2 * MODULE_CNT ||
+      images[FULL][MODULE_LA] | images[FULL][MODULE_LA + 1])
+  {
+    fprintf(stderr, "\"%s\" isn't a test ROM running all the modules\n", progname);
+    exit(EXIT_FAILURE);
+  }
+  for (k = 1; k < MODULE_CNT; k++)
+  {
+    starts[k] = images[FULL][TABLE_LA + 2 * k] | (images[FULL][TABLE_LA + 2 * k + 1] << 8);
+    present[k] = starts[k] != progsize - 2;
+    if (present[k])
+    {
+      memcpy(images[k], images[FULL], ROM_SIZE);
+      images[k][MODULE_LA] = k;
+    }
+  }
+  if (!present[SETUP_MODULE])
+  {
+    fprintf(stderr, "No setup module in \"%s\"\n", progname);
+    exit(EXIT_FAILURE);
+  }
+  chosen[SETUP_MODULE] = 1;
+
+  runbase(FULL);
+  maxcycles = 2 * cycles[FULL];
+  for (k = 1; k < MODULE_CNT; k++)
+    if (present[k])
+    {
+      runbase(k);
+      if (maxcycles < 2 * cycles[k])
+        maxcycles = 2 * cycles[k];
+    }
+
+  // Mutants of the used rows the whole test ROM executes, grouped into
+  // checks: a row's control signal (field) or, with -exact, every mutant.
+  mutants = malloc(2 * ninstr * MUT_PER_ROW * sizeof *mutants);
+  groupof = malloc(2 * ninstr * MUT_PER_ROW * sizeof *groupof);
+  if (!mutants || !groupof)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (idx = 0; idx < 2 * ninstr; idx++)
+  {
+    if (!rows[FULL][idx])
+      continue;
+    nrows++;
+    for (i = 0, n = mutrow(drom, idx, &mutants[nmutants]); i < n; i++, nmutants++)
+    {
+      if (exact || !i || mutants[nmutants].field != mutants[nmutants - 1].field)
+        ngroups++;
+      groupof[nmutants] = ngroups - 1;
+    }
+  }
+  kills = malloc((FAST + 1) * nmutants);
+  checks = malloc((FAST + 1) * ngroups);
+  tasks = malloc(MODULE_CNT * nmutants * sizeof *tasks);
+  rcov = malloc(DROM_CNT * sizeof *rcov);
+  gcov = malloc(ngroups * sizeof *gcov);
+  if (!kills || !checks || !tasks || !rcov || !gcov)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  // The mutants the whole test ROM kills, then those every module kills.
+  for (i = 0; i < nmutants; i++)
+  {
+    tasks[ntasks].img = FULL;
+    tasks[ntasks++].mutant = i;
+  }
+  runtasks(nthreads);
+  mkchecks(FULL);
+  for (i = 0; i < nmutants; i++)
+    nkills += kills[FULL * nmutants + i];
+  for (i = 0; i < ngroups; i++)
+    nchecks += checks[FULL * ngroups + i];
+  for (k = 1; k < MODULE_CNT; k++)
+    if (present[k])
+      addtasks(k);
+  runtasks(nthreads);
+  for (k = 1; k < MODULE_CNT; k++)
+    if (present[k])
+      mkchecks(k);
+
+  // Greedy choice, then drop the redundant modules, most costly first
+  // (with -rows those that add no rows).
+  memset(rcov, 0, DROM_CNT * sizeof *rcov);
+  memset(gcov, 0, ngroups * sizeof *gcov);
+  count(SETUP_MODULE, 1, rcov, gcov);
+  for (;;)
+  {
+    uint best = 0;
+    double bestratio = 0;
+    for (k = 1; k < MODULE_CNT; k++)
+      if (present[k] && !chosen[k] && (n = gain(k, rcov, gcov, 0)) != 0 &&
+          (double)n / cost(k) > bestratio)
+        best = k, bestratio = (double)n / cost(k);
+    if (!best)
+      break;
+    chosen[best] = 1;
+    count(best, 1, rcov, gcov);
+  }
+  for (;;)
+  {
+    uint worst = 0;
+    for (k = 1; k < MODULE_CNT; k++)
+      if (chosen[k] && k != SETUP_MODULE && (!worst || cost(k) > cost(worst)))
+      {
+        count(k, -1, rcov, gcov);
+        if (!gain(k, rcov, gcov, rowsonly))
+          worst = k;
+        count(k, 1, rcov, gcov);
+      }
+    if (!worst)
+      break;
+    chosen[worst] = 0;
+    count(worst, -1, rcov, gcov);
+  }
+
+  // Check the reduced test ROM, add modules back if it loses coverage.
+  for (;;)
+  {
+    uint best = 0;
+    ulong bestn = 0;
+    mkfast();
+    runbase(FAST);
+    addtasks(FAST);
+    runtasks(nthreads);
+    mkchecks(FAST);
+    frows = fkills = fchecks = 0;
+    for (idx = 0; idx < DROM_CNT; idx++)
+    {
+      rcov[idx] = rows[FAST][idx] != 0;
+      frows += rows[FULL][idx] && rows[FAST][idx];
+    }
+    for (i = 0; i < nmutants; i++)
+      fkills += kills[FAST * nmutants + i];
+    for (i = 0; i < ngroups; i++)
+      fchecks += gcov[i] = checks[FAST * ngroups + i];
+    lost = (nrows - frows) + (rowsonly ? 0 : nchecks - fchecks);
+    if (!lost)
+      break;
+    for (k = 1; k < MODULE_CNT; k++)
+      if (present[k] && !chosen[k] && (n = gain(k, rcov, gcov, rowsonly)) > bestn)
+        best = k, bestn = n;
+    if (!best)
+      break;
+    chosen[best] = 1;
+  }
+
+  printf("%-8s %10s %8s %8s  %s\n", "module", "cycles", "rows", "killed", "kept");
+  for (k = 1; k < MODULE_CNT; k++)
+    if (present[k])
+    {
+      ulong r = 0, m = 0;
+      for (idx = 0; idx < DROM_CNT; idx++)
+        r += rows[k][idx] != 0;
+      for (i = 0; i < nmutants; i++)
+        m += kills[k * nmutants + i];
+      printf("%-8u %10lu %8lu %8lu  %s\n", k, cycles[k], r, m,
+             chosen[k] ? ((k == SETUP_MODULE) ? "yes (setup)" : "yes") : "");
+    }
+
+  printf("\n%s variant, %s: %lu cycles, %lu decoder ROM rows executed,\n"
+         "  %lu of %lu mutants killed, %lu %s checked\n"
+         "%s: %lu cycles (%.1f%%), %lu of the rows executed,\n"
+         "  %lu of the killed mutants killed, %lu of the %s checked\n",
+         mini ? "MINI" : "full", progname, cycles[FULL], nrows,
+         nkills, nmutants, nchecks, exact ? "mutants" : "row signals",
+         fastname, cycles[FAST], 100.0 * cycles[FAST] / cycles[FULL], frows,
+         fkills, fchecks, exact ? "mutants" : "row signals");
+  if (lost)
+    printf("The reduced test ROM loses %lu of the rows and checks\n", lost);
+
+  if ((fout = fopen(fastname, "wb")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", fastname);
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < progsize; i += 2)
+  {
+    uchar b[2];
+    b[bigendian] = images[FAST][i];
+    b[!bigendian] = images[FAST][i + 1];
+    fwrite(b, 1, 2, fout);
+  }
+  if (ferror(fout) | fclose(fout))
+  {
+    fprintf(stderr, "Can't write to \"%s\"\n", fastname);
+    exit(EXIT_FAILURE);
+  }
+
+  return lost ? EXIT_FAILURE : 0;
+}
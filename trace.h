@@ -0,0 +1,712 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 binary execution trace: writer (used by emu.c) and reader
+  (used by trdump.c).
+
+  All multibyte values are little-endian. The file is:
+
+    header:  "SCT2", u8 version (1), u8 flags (bit 0: MINI), u16 0
+    chunk 0
+    ...
+    chunk n-1
+    index:   per chunk: u64 file offset, u64 first instruction, u64 first cycle
+    trailer: u64 index file offset, u32 chunk count, "SCTI"
+
+  Every chunk starts with a snapshot of the state, so chunks can be decoded
+  independently of one another (e.g. in parallel):
+
+    u32 payload size, u32 record count, u64 first instruction,
+    u64 first cycle, u16 pc, u16 r0...sp, u16 flags, u8 ie, u8 sel0...sel7
+
+  The payload is a sequence of records, one per executed instruction.
+  The snapshot pc is the pc expected for the first record. A record is
+  a tag byte (TR_*) followed by the fields that the tag calls for, in
+  this order:
+
+    TR_PC:    varint zigzag(pc - expected pc), expected pc = previous pc + 2
+    TR_REGS:  u8 mask of changed registers r0...sp, u16 per changed register
+    TR_FLAGS: u16 new flags
+    TR_MEM:   u8 count, per write: varint (zigzag(physical address -
+              previous write's physical address) << 1 | 16-bit write),
+              u8 or u16 value (only the writes that change memory)
+    TR_MSR:   u8 count, per msr: u8 selector, u8 value
+
+  TR_IE (the interrupt enable flag toggled), TR_IRQ (an IRQ was taken
+  instead of executing the instruction at pc) and TR_3CLK (3 clock cycles
+  instead of 2) carry no data.
+
+  How to compile programs that write traces: add -pthread.
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <pthread.h>
+#include "emu.h"
+
+typedef unsigned long long ullong;
+
+enum
+{
+  TR_PC    = 1 << 0,
+  TR_REGS  = 1 << 1,
+  TR_FLAGS = 1 << 2,
+  TR_IE    = 1 << 3,
+  TR_MEM   = 1 << 4,
+  TR_MSR   = 1 << 5,
+  TR_IRQ   = 1 << 6,
+  TR_3CLK  = 1 << 7
+};
+
+enum
+{
+  TR_FILE_HDR_SIZE  = 8,
+  TR_CHUNK_HDR_SIZE = 4 + 4 + 8 + 8 + 2 + 7 * 2 + 2 + 1 + 8,
+  TR_IDX_ENTRY_SIZE = 3 * 8,
+  TR_TRAILER_SIZE   = 8 + 4 + 4,
+  TR_CHUNK_SIZE     = 64 * 1024, // chunk payload size to aim for
+  TR_REC_MAX        = 64,        // max record size
+  TR_NBUF           = 4,         // instruction batches, one is filled while others are encoded
+  TR_BATCH          = 4096,      // instructions per batch
+  TR_MAX_EV         = 2          // max memory writes or msrs per instruction
+};
+
+void trput(uchar* p, ullong v, int n)
+{
+  while (n--)
+  {
+    *p++ = v & 0xFF;
+    v >>= 8;
+  }
+}
+
+ullong trget(const uchar* p, int n)
+{
+  ullong v = 0;
+  while (n--)
+    v = (v << 8) | p[n];
+  return v;
+}
+
+uchar* trputvar(uchar* p, ulong v)
+{
+  while (v >= 0x80)
+  {
+    *p++ = (v & 0x7F) | 0x80;
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+ulong trzigzag(long v)
+{
+  return (v < 0) ? ((ulong)~v << 1) | 1 : (ulong)v << 1;
+}
+
+long trunzigzag(ulong v)
+{
+  return (v & 1) ? ~(long)(v >> 1) : (long)(v >> 1);
+}
+
+/*
+  Writer. The emulator thread only captures the state after every
+  instruction (trcycle()), the encoding thread encodes the captured
+  instructions into chunks (trrecord()) and writes them to the file.
+*/
+
+// An executed instruction as captured by the emulator thread.
+typedef struct
+{
+  uint r[7], flags, ie;
+  ushort pc;
+  uchar irq, clks, nmem, nmsr;
+  uchar mw16[TR_MAX_EV], msrno[TR_MAX_EV], msrval[TR_MAX_EV];
+  ushort mval[TR_MAX_EV];
+  ulong mpa[TR_MAX_EV];
+} TraceInsn;
+
+typedef struct
+{
+  FILE* f;
+  const char* name;
+  int err;
+
+  // Batches of captured instructions. The emulator fills batch[cur],
+  // the encoding thread encodes queued batches in order, starting with
+  // batch[tail].
+  TraceInsn* batch[TR_NBUF];
+  uint cnt[TR_NBUF];
+  uint cur, tail, queued;
+  int done;
+  pthread_t thr;
+  pthread_mutex_t mtx;
+  pthread_cond_t cv;
+
+  // The instruction being executed, the cycle of its fetch.
+  TraceInsn* ti;
+  ulong fetch;
+
+  // Encoder state (the encoding thread's): the chunk being encoded and
+  // the state as of the last record.
+  uchar* buf;
+  uchar* p;
+  ulong nrec;
+  ullong insn, cycle;
+  uint xpc, r[7], flags, ie, sel[8];
+  ulong lastpa;
+
+  // Index, appended to by the encoding thread.
+  ullong pos;
+  ullong* idx;
+  ulong nchunks, maxchunks;
+} TraceWriter;
+
+void trfail(const char* name)
+{
+  fprintf(stderr, "Can't write to \"%s\"\n", name);
+  exit(EXIT_FAILURE);
+}
+
+// Begins a new chunk with a snapshot of the encoder state.
+void trchunkbegin(TraceWriter* w)
+{
+  uchar* p = w->buf;
+  int i;
+  trput(p + 8, w->insn, 8);
+  trput(p + 16, w->cycle, 8);
+  trput(p + 24, w->xpc, 2);
+  for (i = 0; i < 7; i++)
+    trput(p + 26 + i * 2, w->r[i], 2);
+  trput(p + 40, w->flags, 2);
+  p[42] = w->ie;
+  for (i = 0; i < 8; i++)
+    p[43 + i] = w->sel[i];
+  w->p = p + TR_CHUNK_HDR_SIZE;
+  w->nrec = 0;
+  w->lastpa = 0;
+}
+
+// Writes out the current chunk and adds it to the index.
+void trchunkend(TraceWriter* w)
+{
+  uchar* p = w->buf;
+  ulong len = w->p - p;
+  trput(p, len - TR_CHUNK_HDR_SIZE, 4);
+  trput(p + 4, w->nrec, 4);
+  if (w->err)
+    return;
+  if (w->nchunks == w->maxchunks)
+  {
+    w->maxchunks = w->maxchunks * 2 + 64;
+    if ((w->idx = realloc(w->idx, w->maxchunks * 3 * sizeof *w->idx)) == NULL)
+    {
+      w->err = 1;
+      return;
+    }
+  }
+  w->idx[w->nchunks * 3] = w->pos;
+  w->idx[w->nchunks * 3 + 1] = trget(p + 8, 8);
+  w->idx[w->nchunks * 3 + 2] = trget(p + 16, 8);
+  w->nchunks++;
+  if (fwrite(p, 1, len, w->f) != len)
+    w->err = 1;
+  w->pos += len;
+}
+
+// Encodes an executed instruction.
+void trrecord(TraceWriter* w, const TraceInsn* t)
+{
+  uchar* p = w->p;
+  uchar* tag = p++;
+  uint i, mask = 0;
+
+  *tag = 0;
+  if (t->pc != w->xpc)
+  {
+    *tag |= TR_PC;
+    p = trputvar(p, trzigzag((short)(t->pc - w->xpc)));
+  }
+  w->xpc = (t->pc + 2) & 0xFFFE;
+
+  if (memcmp(t->r, w->r, sizeof w->r))
+  {
+    for (i = 0; i < 7; i++)
+      if (t->r[i] != w->r[i])
+        mask |= 1U << i;
+    *tag |= TR_REGS;
+    *p++ = mask;
+    for (i = 0; i < 7; i++)
+      if (mask & (1U << i))
+      {
+        w->r[i] = t->r[i];
+        trput(p, w->r[i], 2);
+        p += 2;
+      }
+  }
+
+  if (t->flags != w->flags)
+  {
+    *tag |= TR_FLAGS;
+    w->flags = t->flags;
+    trput(p, w->flags, 2);
+    p += 2;
+  }
+
+  if (t->ie != w->ie)
+  {
+    *tag |= TR_IE;
+    w->ie = t->ie;
+  }
+
+  if (t->nmem)
+  {
+    *tag |= TR_MEM;
+    *p++ = t->nmem;
+    for (i = 0; i < t->nmem; i++)
+    {
+      p = trputvar(p, (trzigzag((long)t->mpa[i] - (long)w->lastpa) << 1) | t->mw16[i]);
+      w->lastpa = t->mpa[i];
+      trput(p, t->mval[i], 1 + t->mw16[i]);
+      p += 1 + t->mw16[i];
+    }
+  }
+
+  if (t->nmsr)
+  {
+    *tag |= TR_MSR;
+    *p++ = t->nmsr;
+    for (i = 0; i < t->nmsr; i++)
+    {
+      w->sel[t->msrno[i]] = t->msrval[i];
+      *p++ = t->msrno[i];
+      *p++ = t->msrval[i];
+    }
+  }
+
+  if (t->irq)
+    *tag |= TR_IRQ;
+  if (t->clks == 3)
+    *tag |= TR_3CLK;
+
+  w->p = p;
+  w->nrec++;
+  w->insn++;
+  w->cycle += t->clks;
+
+  if (w->p - w->buf >= TR_CHUNK_HDR_SIZE + TR_CHUNK_SIZE)
+  {
+    trchunkend(w);
+    trchunkbegin(w);
+  }
+}
+
+void* trencoder(void* arg)
+{
+  TraceWriter* w = arg;
+  for (;;)
+  {
+    uint b, i;
+    pthread_mutex_lock(&w->mtx);
+    while (!w->queued && !w->done)
+      pthread_cond_wait(&w->cv, &w->mtx);
+    if (!w->queued)
+    {
+      pthread_mutex_unlock(&w->mtx);
+      break;
+    }
+    b = w->tail;
+    pthread_mutex_unlock(&w->mtx);
+
+    for (i = 0; i < w->cnt[b]; i++)
+      trrecord(w, &w->batch[b][i]);
+
+    pthread_mutex_lock(&w->mtx);
+    w->tail = (w->tail + 1) % TR_NBUF;
+    w->queued--;
+    pthread_cond_signal(&w->cv);
+    pthread_mutex_unlock(&w->mtx);
+  }
+  if (w->nrec)
+    trchunkend(w);
+  return NULL;
+}
+
+// Hands the current batch over to the encoding thread.
+void trbatchend(TraceWriter* w, uint n)
+{
+  pthread_mutex_lock(&w->mtx);
+  w->cnt[w->cur] = n;
+  w->queued++;
+  pthread_cond_signal(&w->cv);
+  w->cur = (w->cur + 1) % TR_NBUF;
+  while (w->queued == TR_NBUF)
+    pthread_cond_wait(&w->cv, &w->mtx);
+  pthread_mutex_unlock(&w->mtx);
+  w->ti = w->batch[w->cur];
+}
+
+void tropenw(TraceWriter* w, const char* name, const Cpu* c)
+{
+  uchar hdr[TR_FILE_HDR_SIZE] = { 'S', 'C', 'T', '2', 1, 0, 0, 0 };
+  int i;
+
+  memset(w, 0, sizeof *w);
+  w->name = name;
+  if ((w->f = fopen(name, "wb")) == NULL)
+  {
+    fprintf(stderr, "Can't create file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+  hdr[5] = c->mini;
+  if (fwrite(hdr, 1, sizeof hdr, w->f) != sizeof hdr)
+    trfail(name);
+  w->pos = sizeof hdr;
+
+  for (i = 0; i < TR_NBUF; i++)
+    if ((w->batch[i] = malloc(TR_BATCH * sizeof *w->batch[i])) == NULL)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+  if ((w->buf = malloc(TR_CHUNK_HDR_SIZE + TR_CHUNK_SIZE + TR_REC_MAX)) == NULL)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  w->ti = w->batch[0];
+
+  w->insn = 0;
+  w->cycle = c->cycles;
+  w->xpc = c->r[7];
+  memcpy(w->r, c->r, sizeof w->r);
+  w->flags = c->flags;
+  w->ie = c->ie;
+  memcpy(w->sel, c->sel, sizeof w->sel);
+  trchunkbegin(w);
+
+  pthread_mutex_init(&w->mtx, NULL);
+  pthread_cond_init(&w->cv, NULL);
+  if (pthread_create(&w->thr, NULL, trencoder, w))
+  {
+    fprintf(stderr, "Can't create thread\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+// To be called after every clock cycle.
+void trcycle(TraceWriter* w, const Cpu* c)
+{
+  TraceInsn* t = w->ti;
+
+  if (c->lclk == CLK_FETCH)
+  {
+    t->pc = (c->r[7] - 2) & 0xFFFE;
+    t->irq = !(c->lacc & ACC_FETCH);
+    t->nmem = t->nmsr = 0;
+    w->fetch = c->cycles - 1;
+  }
+
+  if ((c->lacc & ACC_WRITE) && t->nmem < TR_MAX_EV)
+  {
+    uint w16 = (c->lacc & ACC_W16) != 0;
+    uint v = memread(c, c->lpa, w16);
+    if (v != c->lold)
+    {
+      t->mpa[t->nmem] = c->lpa & (w16 ? ~1UL : ~0UL);
+      t->mval[t->nmem] = v;
+      t->mw16[t->nmem] = w16;
+      t->nmem++;
+    }
+  }
+
+  if ((c->lsel & SELACC_WRITE) && t->nmsr < TR_MAX_EV)
+  {
+    t->msrno[t->nmsr] = c->lselno;
+    t->msrval[t->nmsr] = c->sel[c->lselno];
+    t->nmsr++;
+  }
+
+  if (c->clk == CLK_FETCH)
+  {
+    memcpy(t->r, c->r, sizeof t->r);
+    t->flags = c->flags;
+    t->ie = c->ie;
+    t->clks = c->cycles - w->fetch;
+    if (++w->ti - w->batch[w->cur] == TR_BATCH)
+      trbatchend(w, TR_BATCH);
+  }
+}
+
+void trclosew(TraceWriter* w)
+{
+  uchar t[TR_TRAILER_SIZE];
+  ulong i;
+
+  if (w->ti != w->batch[w->cur])
+    trbatchend(w, w->ti - w->batch[w->cur]);
+  pthread_mutex_lock(&w->mtx);
+  w->done = 1;
+  pthread_cond_signal(&w->cv);
+  pthread_mutex_unlock(&w->mtx);
+  pthread_join(w->thr, NULL);
+  pthread_mutex_destroy(&w->mtx);
+  pthread_cond_destroy(&w->cv);
+
+  if (w->err)
+    trfail(w->name);
+  for (i = 0; i < w->nchunks * 3; i++)
+  {
+    uchar e[8];
+    trput(e, w->idx[i], 8);
+    if (fwrite(e, 1, 8, w->f) != 8)
+      trfail(w->name);
+  }
+  trput(t, w->pos, 8);
+  trput(t + 8, w->nchunks, 4);
+  memcpy(t + 12, "SCTI", 4);
+  if (fwrite(t, 1, sizeof t, w->f) != sizeof t || fclose(w->f))
+    trfail(w->name);
+
+  for (i = 0; i < TR_NBUF; i++)
+    free(w->batch[i]);
+  free(w->buf);
+  free(w->idx);
+}
+
+/*
+  Reader. Use one TraceReader per thread. Once a chunk is loaded
+  (trload()), it can be decoded (trdecinit(), trnext()) independently.
+*/
+
+typedef struct
+{
+  FILE* f;
+  int mini;
+  ulong nchunks;
+  ullong* idx; // per chunk: file offset, first instruction, first cycle
+} TraceReader;
+
+typedef struct
+{
+  const uchar* p;
+  const uchar* end;
+  ulong nrec;
+
+  // The last decoded instruction/record and the state after it.
+  ullong insn, cycle; // number of the instruction, cycle at its fetch
+  uint tag, pc, clks;
+  uint r[7], flags, ie, sel[8];
+  uint nmem, nmsr;
+  ulong mpa[TR_MAX_EV];
+  uint mval[TR_MAX_EV], mw16[TR_MAX_EV], msrno[TR_MAX_EV], msrval[TR_MAX_EV];
+
+  uint xpc;
+  ulong lastpa;
+} TraceDec;
+
+// fseek() with a 64-bit offset (long is 32 bits on Windows).
+// Returns 0 on success.
+int trseek(FILE* f, long long ofs, int whence)
+{
+#ifdef _WIN32
+  return _fseeki64(f, ofs, whence);
+#else
+  if (ofs > LONG_MAX || ofs < LONG_MIN)
+    return -1;
+  return fseek(f, (long)ofs, whence);
+#endif
+}
+
+// Returns 0 on success.
+int tropenr(TraceReader* r, const char* name)
+{
+  uchar h[TR_FILE_HDR_SIZE], t[TR_TRAILER_SIZE];
+  ullong idxpos;
+  ulong i;
+
+  memset(r, 0, sizeof *r);
+  if ((r->f = fopen(name, "rb")) == NULL)
+    return -1;
+  if (fread(h, 1, sizeof h, r->f) != sizeof h || memcmp(h, "SCT2", 4) || h[4] != 1 ||
+      trseek(r->f, -(long long)sizeof t, SEEK_END) ||
+      fread(t, 1, sizeof t, r->f) != sizeof t || memcmp(t + 12, "SCTI", 4))
+    goto lerr;
+  r->mini = h[5] & 1;
+  idxpos = trget(t, 8);
+  r->nchunks = trget(t + 8, 4);
+  if ((r->idx = malloc((r->nchunks * 3 + 1) * sizeof *r->idx)) == NULL ||
+      trseek(r->f, idxpos, SEEK_SET))
+    goto lerr;
+  for (i = 0; i < r->nchunks * 3; i++)
+  {
+    uchar e[8];
+    if (fread(e, 1, 8, r->f) != 8)
+      goto lerr;
+    r->idx[i] = trget(e, 8);
+  }
+  return 0;
+
+lerr:
+  fclose(r->f);
+  free(r->idx);
+  r->f = NULL;
+  r->idx = NULL;
+  return -1;
+}
+
+void trcloser(TraceReader* r)
+{
+  if (r->f)
+    fclose(r->f);
+  free(r->idx);
+}
+
+// Loads chunk i. Returns a malloc()'d buffer or NULL on error.
+uchar* trload(TraceReader* r, ulong i, ulong* size)
+{
+  uchar h[TR_CHUNK_HDR_SIZE];
+  uchar* buf;
+  ulong n;
+  if (i >= r->nchunks ||
+      trseek(r->f, r->idx[i * 3], SEEK_SET) ||
+      fread(h, 1, sizeof h, r->f) != sizeof h)
+    return NULL;
+  n = TR_CHUNK_HDR_SIZE + trget(h, 4);
+  if ((buf = malloc(n)) == NULL)
+    return NULL;
+  memcpy(buf, h, sizeof h);
+  if (fread(buf + sizeof h, 1, n - sizeof h, r->f) != n - sizeof h)
+  {
+    free(buf);
+    return NULL;
+  }
+  *size = n;
+  return buf;
+}
+
+void trdecinit(TraceDec* d, const uchar* chunk)
+{
+  int i;
+  memset(d, 0, sizeof *d);
+  d->p = chunk + TR_CHUNK_HDR_SIZE;
+  d->end = d->p + trget(chunk, 4);
+  d->nrec = trget(chunk + 4, 4);
+  d->insn = trget(chunk + 8, 8) - 1;
+  d->cycle = trget(chunk + 16, 8);
+  d->xpc = trget(chunk + 24, 2);
+  for (i = 0; i < 7; i++)
+    d->r[i] = trget(chunk + 26 + i * 2, 2);
+  d->flags = trget(chunk + 40, 2);
+  d->ie = chunk[42];
+  for (i = 0; i < 8; i++)
+    d->sel[i] = chunk[43 + i];
+}
+
+ulong trgetvar(TraceDec* d)
+{
+  ulong v = 0;
+  int s = 0;
+  while (d->p < d->end)
+  {
+    uint b = *d->p++;
+    v |= (ulong)(b & 0x7F) << s;
+    if (!(b & 0x80))
+      break;
+    s += 7;
+  }
+  return v;
+}
+
+// Decodes the next record. Returns 0 on success, -1 at the end of the chunk.
+int trnext(TraceDec* d)
+{
+  uint i, n;
+  if (d->p >= d->end)
+    return -1;
+
+  d->cycle += d->clks; // the previous instruction's clocks
+  d->insn++;
+  d->tag = *d->p++;
+  d->pc = d->xpc;
+  if (d->tag & TR_PC)
+    d->pc = (d->pc + trunzigzag(trgetvar(d))) & 0xFFFE;
+  d->xpc = (d->pc + 2) & 0xFFFE;
+  d->clks = (d->tag & TR_3CLK) ? 3 : 2;
+
+  if (d->tag & TR_REGS)
+  {
+    uint mask = *d->p++;
+    for (i = 0; i < 7; i++)
+      if (mask & (1U << i))
+      {
+        d->r[i] = trget(d->p, 2);
+        d->p += 2;
+      }
+  }
+  if (d->tag & TR_FLAGS)
+  {
+    d->flags = trget(d->p, 2);
+    d->p += 2;
+  }
+  if (d->tag & TR_IE)
+    d->ie ^= 1;
+
+  d->nmem = 0;
+  if (d->tag & TR_MEM)
+  {
+    n = *d->p++;
+    for (i = 0; i < n && i < TR_MAX_EV; i++)
+    {
+      ulong v = trgetvar(d);
+      d->mw16[i] = v & 1;
+      d->lastpa += trunzigzag(v >> 1);
+      d->mpa[i] = d->lastpa;
+      d->mval[i] = trget(d->p, 1 + d->mw16[i]);
+      d->p += 1 + d->mw16[i];
+    }
+    d->nmem = i;
+  }
+
+  d->nmsr = 0;
+  if (d->tag & TR_MSR)
+  {
+    n = *d->p++;
+    for (i = 0; i < n && i < TR_MAX_EV; i++)
+    {
+      d->msrno[i] = d->p[0] & 7;
+      d->msrval[i] = d->p[1];
+      d->sel[d->msrno[i]] = d->msrval[i];
+      d->p += 2;
+    }
+    d->nmsr = i;
+  }
+
+  return (d->p <= d->end) ? 0 : -1;
+}
+
+#endif
@@ -0,0 +1,222 @@
+/*
+Copyright (c) 2024, Alexey Frunze
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  SediCiPU2 binary execution trace dumper (see trace.h).
+
+  How to compile: gcc -std=c99 -O2 -Wall -pthread trdump.c -o trdump.exe
+*/
+
+#include "trace.h"
+
+typedef struct
+{
+  const char* name;
+  ulong first, step;
+  ullong insns, cycles, memwrites, msrs, irqs;
+  int err;
+} StatJob;
+
+const char* regnames[7] = { "r0", "r1", "r2", "r3", "r4", "r5", "sp" };
+
+void dumprec(const TraceDec* d, const uint* prevr)
+{
+  uint i;
+  printf("%10llu %10llu  %04X %c", d->insn, d->cycle, d->pc, (d->tag & TR_IRQ) ? 'I' : ' ');
+  for (i = 0; i < 7; i++)
+    if (d->r[i] != prevr[i])
+      printf(" %s=%04X", regnames[i], d->r[i]);
+  if (d->tag & TR_FLAGS)
+    printf(" flags=%04X", d->flags);
+  if (d->tag & TR_IE)
+    printf(" ie=%u", d->ie);
+  for (i = 0; i < d->nmem; i++)
+    printf(d->mw16[i] ? " [%06lX]=%04X" : " [%06lX]=%02X", d->mpa[i], d->mval[i]);
+  for (i = 0; i < d->nmsr; i++)
+    printf(" sel%u=%02X", d->msrno[i], d->msrval[i]);
+  printf("\n");
+}
+
+int dumpchunk(TraceReader* r, ulong i)
+{
+  ulong size;
+  uchar* buf = trload(r, i, &size);
+  TraceDec d;
+  uint prevr[7];
+  if (!buf)
+    return -1;
+  trdecinit(&d, buf);
+  memcpy(prevr, d.r, sizeof prevr);
+  while (!trnext(&d))
+  {
+    dumprec(&d, prevr);
+    memcpy(prevr, d.r, sizeof prevr);
+  }
+  free(buf);
+  return 0;
+}
+
+// Decodes chunks first, first + step, first + 2 * step, ...
+void* statjob(void* arg)
+{
+  StatJob* j = arg;
+  TraceReader r;
+  ulong i;
+
+  if (tropenr(&r, j->name))
+  {
+    j->err = 1;
+    return NULL;
+  }
+  for (i = j->first; i < r.nchunks; i += j->step)
+  {
+    ulong size, n = 0;
+    uchar* buf = trload(&r, i, &size);
+    TraceDec d;
+    if (!buf)
+    {
+      j->err = 1;
+      break;
+    }
+    trdecinit(&d, buf);
+    while (!trnext(&d))
+    {
+      n++;
+      j->cycles += d.clks;
+      j->memwrites += d.nmem;
+      j->msrs += d.nmsr;
+      j->irqs += (d.tag & TR_IRQ) != 0;
+    }
+    // The chunk must end where the next one begins.
+    if (n != d.nrec ||
+        (i + 1 < r.nchunks &&
+         (d.insn + 1 != r.idx[(i + 1) * 3 + 1] || d.cycle + d.clks != r.idx[(i + 1) * 3 + 2])))
+      j->err = 1;
+    j->insns += n;
+    free(buf);
+  }
+  trcloser(&r);
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  int stat = 0, nthreads = 4;
+  long chunk = -1;
+  char* name;
+  TraceReader r;
+  int i;
+
+  for (i = 1; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (!strcmp(argv[i], "-stat"))
+      stat = 1;
+    else if (!strcmp(argv[i], "-j") && i + 1 < argc && (nthreads = atoi(argv[++i])) > 0)
+      ;
+    else if (!strcmp(argv[i], "-chunk") && i + 1 < argc)
+      chunk = atol(argv[++i]);
+    else
+      goto lusage;
+  }
+  if (argc - i != 1)
+  {
+lusage:
+    fprintf(stderr,
+            "Usage:\n"
+            "  trdump [options] <trace_file>\n"
+            "Options:\n"
+            "  -chunk <n>  dump chunk n only\n"
+            "  -stat       decode all chunks in parallel and print totals only\n"
+            "  -j <n>      number of threads for -stat (default: 4)\n");
+    exit(EXIT_FAILURE);
+  }
+  name = argv[i];
+
+  if (tropenr(&r, name))
+  {
+    fprintf(stderr, "Can't read trace file \"%s\"\n", name);
+    exit(EXIT_FAILURE);
+  }
+
+  if (stat)
+  {
+    StatJob* jobs = calloc(nthreads, sizeof *jobs);
+    pthread_t* thr = calloc(nthreads, sizeof *thr);
+    ullong insns = 0, cycles = 0, memwrites = 0, msrs = 0, irqs = 0;
+    int err = 0;
+    if (!jobs || !thr)
+    {
+      fprintf(stderr, "Out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+    for (i = 0; i < nthreads; i++)
+    {
+      jobs[i].name = name;
+      jobs[i].first = i;
+      jobs[i].step = nthreads;
+      if (pthread_create(&thr[i], NULL, statjob, &jobs[i]))
+      {
+        fprintf(stderr, "Can't create thread\n");
+        exit(EXIT_FAILURE);
+      }
+    }
+    for (i = 0; i < nthreads; i++)
+    {
+      pthread_join(thr[i], NULL);
+      insns += jobs[i].insns;
+      cycles += jobs[i].cycles;
+      memwrites += jobs[i].memwrites;
+      msrs += jobs[i].msrs;
+      irqs += jobs[i].irqs;
+      err |= jobs[i].err;
+    }
+    printf("%s variant, %lu chunks, %llu instructions, %llu cycles, "
+           "%llu memory writes, %llu msrs, %llu IRQs\n",
+           r.mini ? "MINI" : "full", r.nchunks, insns, cycles, memwrites, msrs, irqs);
+    if (err)
+    {
+      fprintf(stderr, "Corrupted trace file \"%s\"\n", name);
+      exit(EXIT_FAILURE);
+    }
+    free(jobs);
+    free(thr);
+  }
+  else
+  {
+    ulong first = (chunk >= 0) ? (ulong)chunk : 0;
+    ulong last = (chunk >= 0) ? (ulong)chunk + 1 : r.nchunks;
+    ulong n;
+    printf("%10s %10s  %-4s\n", "insn", "cycle", "pc");
+    for (n = first; n < last; n++)
+      if (dumpchunk(&r, n))
+      {
+        fprintf(stderr, "Corrupted trace file \"%s\"\n", name);
+        exit(EXIT_FAILURE);
+      }
+  }
+
+  trcloser(&r);
+  return 0;
+}